@@ -0,0 +1,3 @@
+#pragma once
+#define GIT_COMMIT "98631fd9565ecacdfb3ed859c23938b519e52c00"
+#define GIT_DIRTY 1
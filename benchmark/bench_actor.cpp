@@ -266,7 +266,7 @@ class QueryBench : public td::Benchmark {
   td::ActorOwn<ServerActor> server_;
 };
 
-int main() {
+BENCH_SUITE(actor) {
   SET_VERBOSITY_LEVEL(VERBOSITY_NAME(DEBUG));
   bench(RingBench<4>(504, 0));
   bench(RingBench<3>(504, 0));
@@ -286,5 +286,4 @@ int main() {
   bench(RingBench<0>(504, 2));
   bench(RingBench<1>(504, 2));
   bench(RingBench<2>(504, 2));
-  return 0;
 }
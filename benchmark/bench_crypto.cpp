@@ -195,7 +195,7 @@ class Crc64Bench : public td::Benchmark {
   }
 };
 
-int main() {
+BENCH_SUITE(crypto) {
   td::bench(Pbkdf2Bench());
   td::bench(RandBench());
   td::bench(CppRandBench());
@@ -209,5 +209,4 @@ int main() {
   td::bench(AESBench());
   td::bench(Crc32Bench());
   td::bench(Crc64Bench());
-  return 0;
 }
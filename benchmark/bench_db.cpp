@@ -10,15 +10,18 @@
 #include "td/db/BinlogKeyValue.h"
 #include "td/db/SeqKeyValue.h"
 #include "td/db/SqliteDb.h"
+#include "td/db/SqliteKeyValue.h"
 #include "td/db/SqliteKeyValueAsync.h"
 
 #include "td/utils/benchmark.h"
 #include "td/utils/format.h"
 #include "td/utils/logging.h"
+#include "td/utils/Random.h"
 #include "td/utils/Status.h"
 #include "td/utils/StringBuilder.h"
 
 #include <memory>
+#include <vector>
 
 template <class KeyValueT>
 class TdKvBench : public td::Benchmark {
@@ -124,6 +127,95 @@ class SqliteKVBench : public td::Benchmark {
   }
 };
 
+// random point reads from a table with 100000 rows, opened with default or server database options
+template <bool is_encrypted, bool use_server_options>
+class SqliteRandomReadBench : public td::Benchmark {
+  static constexpr int ROW_COUNT = 100000;
+
+  td::SqliteDb db;
+
+  td::string get_description() const override {
+    return PSTRING() << "SqliteDb random read " << td::tag("is_encrypted", is_encrypted)
+                     << td::tag("use_server_options", use_server_options);
+  }
+  void start_up() override {
+    td::string path = "testdb.sqlite";
+    td::SqliteDb::destroy(path).ignore();
+    auto key = is_encrypted ? td::DbKey::password("cucumber") : td::DbKey::empty();
+    auto options = use_server_options ? td::SqliteDb::Options::server() : td::SqliteDb::Options();
+    db = td::SqliteDb::open_with_key(path, key, options).move_as_ok();
+    db.exec("PRAGMA journal_mode=WAL").ensure();
+    db.exec("CREATE TABLE IF NOT EXISTS KV (k INT PRIMARY KEY, v BLOB)").ensure();
+
+    auto stmt = db.get_statement("INSERT INTO KV (k, v) VALUES(?1, ?2)").move_as_ok();
+    td::string value(200, 'a');
+    db.exec("BEGIN TRANSACTION").ensure();
+    for (int i = 0; i < ROW_COUNT; i++) {
+      stmt.bind_int32(1, i).ensure();
+      stmt.bind_blob(2, value).ensure();
+      stmt.step().ensure();
+      stmt.reset();
+    }
+    db.exec("COMMIT TRANSACTION").ensure();
+  }
+  void run(int n) override {
+    auto stmt = db.get_statement("SELECT v FROM KV WHERE k = ?1").move_as_ok();
+    for (int i = 0; i < n; i++) {
+      stmt.bind_int32(1, td::Random::fast(0, ROW_COUNT - 1)).ensure();
+      stmt.step().ensure();
+      CHECK(stmt.has_row());
+      stmt.reset();
+    }
+  }
+  void tear_down() override {
+    db.close();
+    td::SqliteDb::destroy("testdb.sqlite").ignore();
+  }
+};
+
+// loads 10000 users by their database keys, like ContactsManager does
+template <bool use_get_multi>
+class SqliteKeyValueLoadBench : public td::Benchmark {
+  static constexpr int USER_COUNT = 10000;
+
+  td::SqliteKeyValue kv;
+  std::vector<td::string> keys;
+
+  td::string get_description() const override {
+    return PSTRING() << "SqliteKeyValue load " << USER_COUNT << " users " << td::tag("use_get_multi", use_get_multi);
+  }
+  void start_up() override {
+    td::string path = "testdb.sqlite";
+    td::SqliteDb::destroy(path).ignore();
+    auto db = td::SqliteDb::open_with_key(path, td::DbKey::empty()).move_as_ok();
+    db.exec("PRAGMA journal_mode=WAL").ensure();
+    kv.init_with_connection(std::move(db), "common").ensure();
+
+    kv.begin_transaction().ensure();
+    for (int i = 0; i < USER_COUNT; i++) {
+      keys.push_back(PSTRING() << "us" << i);
+      kv.set(keys.back(), td::string(200, static_cast<char>('a' + i % 26)));
+    }
+    kv.commit_transaction().ensure();
+  }
+  void run(int n) override {
+    for (int i = 0; i < n; i++) {
+      if (use_get_multi) {
+        auto values = kv.get_multi(keys);
+        CHECK(values.size() == keys.size());
+      } else {
+        for (auto &key : keys) {
+          CHECK(!kv.get(key).empty());
+        }
+      }
+    }
+  }
+  void tear_down() override {
+    kv.close_and_destroy();
+    keys.clear();
+  }
+};
+
 static td::Status init_db(td::SqliteDb &db) {
   TRY_STATUS(db.exec("PRAGMA encoding=\"UTF-8\""));
   TRY_STATUS(db.exec("PRAGMA journal_mode=WAL"));
@@ -223,15 +315,20 @@ class BinlogKeyValueBench : public td::Benchmark {
   }
 };
 
-int main() {
+BENCH_SUITE(db) {
   SET_VERBOSITY_LEVEL(VERBOSITY_NAME(WARNING));
   bench(BinlogKeyValueBench<true>());
   bench(BinlogKeyValueBench<false>());
   bench(SqliteKVBench<false>());
   bench(SqliteKVBench<true>());
+  bench(SqliteRandomReadBench<false, false>());
+  bench(SqliteRandomReadBench<false, true>());
+  bench(SqliteRandomReadBench<true, false>());
+  bench(SqliteRandomReadBench<true, true>());
+  bench(SqliteKeyValueLoadBench<false>());
+  bench(SqliteKeyValueLoadBench<true>());
   bench(SqliteKeyValueAsyncBench());
   bench(TdKvBench<td::BinlogKeyValue<td::Binlog>>("BinlogKeyValue<Binlog>"));
   bench(TdKvBench<td::BinlogKeyValue<td::ConcurrentBinlog>>("BinlogKeyValue<ConcurrentBinlog>"));
   bench(SeqKvBench());
-  return 0;
 }
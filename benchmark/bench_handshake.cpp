@@ -9,9 +9,12 @@
 #include "td/mtproto/crypto.h"
 
 #include "td/utils/base64.h"
+#include "td/utils/BigNum.h"
 #include "td/utils/logging.h"
+#include "td/utils/port/thread.h"
 #include "td/utils/Slice.h"
 
+#include <atomic>
 #include <map>
 
 #if TD_LINUX || TD_ANDROID || TD_TIZEN
@@ -27,9 +30,21 @@ static string prime_base64 =
     "WC2xF40WnGvEZbDW_5yjko_vW5rk5Bj8Feg-vqD4f6n_Xu1wBQ3tKEn0e_lZ2VaFDOkphR8NgRX2NbEF7i5OFdBLJFS_b0-t8DSxBAMRnNjjuS_MW"
     "w";
 
+// each iteration is one DH handshake, so ops/sec is the number of handshakes per second
 class HandshakeBench : public Benchmark {
+ public:
+  explicit HandshakeBench(bool use_precomputed_keys) : use_precomputed_keys_(use_precomputed_keys) {
+  }
+
+ private:
+  bool use_precomputed_keys_;
+#if !TD_THREAD_UNSUPPORTED
+  std::atomic<bool> stop_flag_{false};
+  td::thread worker_;
+#endif
+
   std::string get_description() const override {
-    return "Handshake";
+    return use_precomputed_keys_ ? "Handshake with precomputed keys" : "Handshake";
   }
 
   class FakeDhCallback : public DhCallback {
@@ -50,6 +65,37 @@ class HandshakeBench : public Benchmark {
     mutable std::map<string, int> cache;
   } dh_callback;
 
+  void start_up() override {
+    auto prime = base64url_decode(prime_base64).move_as_ok();
+    DhKeyPool::instance().set_max_key_pair_count(use_precomputed_keys_ ? 64 : 0);
+    DhKeyPool::instance().prepare(g, prime);
+    BigNumContext context;
+    DhHandshake::check_config(prime, BigNum::from_binary(prime), g, context, &dh_callback).ensure();
+#if !TD_THREAD_UNSUPPORTED
+    if (use_precomputed_keys_) {
+      // the callback is only read from now on, so it can be used by the worker
+      stop_flag_ = false;
+      worker_ = td::thread([&] {
+        BigNumContext worker_context;
+        while (!stop_flag_.load(std::memory_order_relaxed)) {
+          if (!DhKeyPool::instance().precompute_key_pair(&dh_callback, worker_context)) {
+            td::this_thread::yield();
+          }
+        }
+      });
+    }
+#endif
+  }
+
+  void tear_down() override {
+#if !TD_THREAD_UNSUPPORTED
+    if (use_precomputed_keys_) {
+      stop_flag_ = true;
+      worker_.join();
+    }
+#endif
+  }
+
   void run(int n) override {
     DhHandshake a;
     DhHandshake b;
@@ -69,8 +115,8 @@ class HandshakeBench : public Benchmark {
 };
 }  // namespace td
 
-int main() {
+BENCH_SUITE(handshake) {
   SET_VERBOSITY_LEVEL(VERBOSITY_NAME(DEBUG));
-  td::bench(td::HandshakeBench());
-  return 0;
+  td::bench(td::HandshakeBench(false));
+  td::bench(td::HandshakeBench(true));
 }
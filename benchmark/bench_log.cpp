@@ -152,12 +152,11 @@ class LogWriteBench : public td::Benchmark {
 
 std::mutex mutex;
 
-int main() {
+BENCH_SUITE(log) {
   td::bench(LogWriteBench());
 #if TD_ANDROID
   td::bench(ALogWriteBench());
 #endif
   td::bench(IostreamWriteBench());
   td::bench(FILEWriteBench());
-  return 0;
 }
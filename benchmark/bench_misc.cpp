@@ -5,7 +5,10 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 #include "td/utils/benchmark.h"
+#include "td/utils/buffer.h"
+#include "td/utils/BufferedFd.h"
 #include "td/utils/common.h"
+#include "td/utils/Hints.h"
 #include "td/utils/logging.h"
 #include "td/utils/port/Clocks.h"
 #include "td/utils/port/EventFd.h"
@@ -15,11 +18,14 @@
 #include "td/utils/port/Stat.h"
 #include "td/utils/port/thread.h"
 #include "td/utils/Slice.h"
+#include "td/utils/unicode.h"
+#include "td/utils/utf8.h"
 
 #include "td/telegram/telegram_api.h"
 #include "td/telegram/telegram_api.hpp"
 
 #if !TD_WINDOWS
+#include <sys/socket.h>
 #include <unistd.h>
 #include <utime.h>
 #endif
@@ -30,6 +36,8 @@
 
 #include <atomic>
 #include <cstdint>
+#include <cstring>
+#include <type_traits>
 
 namespace td {
 
@@ -150,6 +158,54 @@ class PipeBench : public Benchmark {
     close(p[1]);
   }
 };
+
+#if !TD_THREAD_UNSUPPORTED
+// Fd, which can write only one slice at once
+class WriteOnlyFd : public Fd {
+ public:
+  using Fd::Fd;
+  Result<size_t> writev(const Slice *slices, size_t slice_count) = delete;
+};
+
+template <class FdT>
+class BufferedFdFlushWriteBench : public Benchmark {
+ public:
+  string get_description() const override {
+    return PSTRING() << "BufferedFd flush_write of 4 + 512 byte packets over a socket pair"
+                     << (std::is_same<FdT, WriteOnlyFd>::value ? "" : " with writev");
+  }
+
+  void run(int n) override {
+    int fds[2];
+    CHECK(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+
+    thread reader([fd = fds[1]] {
+      char buf[1 << 16];
+      while (read(fd, buf, sizeof(buf)) > 0) {
+      }
+      close(fd);
+    });
+
+    BufferedFd<FdT> fd(FdT(fds[0], Fd::Mode::Owner));
+    fd.get_fd().set_is_blocking(true).ensure();
+    fd.get_fd().update_flags(Fd::Write);
+    BufferSlice packet(512);
+    std::memset(packet.as_slice().begin(), 0, packet.size());
+    for (int i = 0; i < n; i++) {
+      uint32 size = static_cast<uint32>(packet.size());
+      fd.output_buffer().append(Slice(reinterpret_cast<const char *>(&size), sizeof(size)));
+      fd.output_buffer().append(packet.clone());
+      if (i % 64 == 63 || i + 1 == n) {
+        while (fd.need_flush_write()) {
+          fd.flush_write().ensure();
+        }
+      }
+    }
+    fd.close();
+    reader.join();
+  }
+};
+#endif
 #endif
 
 #if TD_LINUX || TD_ANDROID || TD_TIZEN
@@ -352,9 +408,87 @@ class RwMutexWriteBench : public Benchmark {
   }
 };
 #endif
+
+static string get_search_bench_string(bool is_ascii) {
+  string result;
+  for (int i = 0; i < 100; i++) {
+    result += is_ascii ? "John Smith, Support Bot 42. " : "Иван Петров, 山田太郎 Ünïcödé 42. ";
+  }
+  return result;
+}
+
+template <bool is_ascii>
+class PrepareSearchCharacterBench : public Benchmark {
+  string get_description() const override {
+    return PSTRING() << "prepare_search_character" << (is_ascii ? "Ascii" : "Unicode");
+  }
+  string str_ = get_search_bench_string(is_ascii);
+  void run(int n) override {
+    size_t res = 0;
+    for (int i = 0; i < n; i++) {
+      string result;
+      auto pos = Slice(str_).ubegin();
+      auto end = Slice(str_).uend();
+      while (pos != end) {
+        uint32 code;
+        pos = next_utf8_unsafe(pos, &code);
+        code = prepare_search_character(code);
+        if (code != 0) {
+          append_utf8_character(result, code);
+        }
+      }
+      res += result.size();
+    }
+    do_not_optimize_away(res);
+  }
+};
+
+template <bool is_ascii>
+class Utf8PrepareSearchStringBench : public Benchmark {
+  string get_description() const override {
+    return PSTRING() << "utf8_prepare_search_string" << (is_ascii ? "Ascii" : "Unicode");
+  }
+  string str_ = get_search_bench_string(is_ascii);
+  void run(int n) override {
+    size_t res = 0;
+    for (int i = 0; i < n; i++) {
+      res += utf8_prepare_search_string(str_).size();
+    }
+    do_not_optimize_away(res);
+  }
+};
+
+template <bool is_ascii>
+class Utf8ToLowerBench : public Benchmark {
+  string get_description() const override {
+    return PSTRING() << "utf8_to_lower" << (is_ascii ? "Ascii" : "Unicode");
+  }
+  string str_ = get_search_bench_string(is_ascii);
+  void run(int n) override {
+    size_t res = 0;
+    for (int i = 0; i < n; i++) {
+      res += utf8_to_lower(str_).size();
+    }
+    do_not_optimize_away(res);
+  }
+};
+
+template <bool is_ascii>
+class HintsSearchBench : public Benchmark {
+  string get_description() const override {
+    return PSTRING() << "HintsSearch" << (is_ascii ? "Ascii" : "Unicode");
+  }
+  void run(int n) override {
+    Hints hints;
+    for (int i = 0; i < n; i++) {
+      hints.add(i, PSLICE() << (is_ascii ? "John Smith " : "Иван Петров ") << i);
+    }
+    do_not_optimize_away(hints.search(Slice(is_ascii ? "smi" : "пет"), 10).first);
+  }
+};
 }  // namespace td
 
-int main() {
+BENCH_SUITE(misc) {
   SET_VERBOSITY_LEVEL(VERBOSITY_NAME(DEBUG));
 #if !TD_THREAD_UNSUPPORTED
   td::bench(td::AtomicReleaseIncBench<1>());
@@ -374,6 +508,14 @@ int main() {
   td::bench(td::PwriteBench());
 
   td::bench(td::CallBench());
+  td::bench(td::PrepareSearchCharacterBench<true>());
+  td::bench(td::Utf8PrepareSearchStringBench<true>());
+  td::bench(td::PrepareSearchCharacterBench<false>());
+  td::bench(td::Utf8PrepareSearchStringBench<false>());
+  td::bench(td::Utf8ToLowerBench<true>());
+  td::bench(td::Utf8ToLowerBench<false>());
+  td::bench(td::HintsSearchBench<true>());
+  td::bench(td::HintsSearchBench<false>());
 #if !TD_THREAD_UNSUPPORTED
   td::bench(td::ThreadNewBench());
 #endif
@@ -384,9 +526,12 @@ int main() {
   td::bench(td::NewIntBench());
 #if !TD_WINDOWS
   td::bench(td::PipeBench());
+#if !TD_THREAD_UNSUPPORTED
+  td::bench(td::BufferedFdFlushWriteBench<td::WriteOnlyFd>());
+  td::bench(td::BufferedFdFlushWriteBench<td::Fd>());
+#endif
 #endif
 #if TD_LINUX || TD_ANDROID || TD_TIZEN
   td::bench(td::SemBench());
 #endif
-  return 0;
 }
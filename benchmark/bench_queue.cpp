@@ -5,10 +5,16 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 #include "td/utils/benchmark.h"
+#include "td/utils/BoundedMpmcQueue.h"
 #include "td/utils/common.h"
 #include "td/utils/logging.h"
+#include "td/utils/misc.h"
+#include "td/utils/MpmcQueue.h"
 #include "td/utils/MpscPollableQueue.h"
+#include "td/utils/port/EventFd.h"
+#include "td/utils/port/thread.h"
 #include "td/utils/queue.h"
+#include "td/utils/SpinLock.h"
 
 // TODO: check system calls
 // TODO: all return values must be checked
@@ -16,8 +22,11 @@
 #include <atomic>
 #include <cstdio>
 #include <cstdlib>
+#include <memory>
+#include <utility>
 #include <vector>
 
+#include <poll.h>
 #include <pthread.h>
 #include <sched.h>
 #include <semaphore.h>
@@ -553,6 +562,220 @@ class SemCheatQueue {
   }
 };
 
+// previous implementation of MpscPollableQueue with all writers serialized by a spin lock
+template <class ValueT>
+class SpinLockPollableQueue {
+ public:
+  int reader_wait_nonblock() {
+    auto ready = reader_vector_.size() - reader_pos_;
+    if (ready != 0) {
+      return td::narrow_cast<int>(ready);
+    }
+
+    auto guard = lock_.lock();
+    if (writer_vector_.empty()) {
+      event_fd_.acquire();
+      wait_event_fd_ = true;
+      return 0;
+    } else {
+      reader_vector_.clear();
+      reader_pos_ = 0;
+      std::swap(writer_vector_, reader_vector_);
+      return td::narrow_cast<int>(reader_vector_.size());
+    }
+  }
+  ValueT reader_get_unsafe() {
+    return std::move(reader_vector_[reader_pos_++]);
+  }
+  void reader_flush() {
+  }
+  void writer_put(ValueT value) {
+    auto guard = lock_.lock();
+    writer_vector_.push_back(std::move(value));
+    if (wait_event_fd_) {
+      wait_event_fd_ = false;
+      event_fd_.release();
+    }
+  }
+  void writer_put_many(vector<ValueT> values) {
+    for (auto &value : values) {
+      writer_put(std::move(value));
+    }
+  }
+  void writer_flush() {
+  }
+
+  void init() {
+    event_fd_.init();
+  }
+  void destroy() {
+    event_fd_.close();
+  }
+
+  int reader_wait() {
+    int res;
+    while ((res = reader_wait_nonblock()) == 0) {
+      pollfd fd;
+      fd.fd = event_fd_.get_fd().get_native_fd();
+      fd.events = POLLIN;
+      poll(&fd, 1, -1);
+    }
+    return res;
+  }
+
+ private:
+  td::SpinLock lock_;
+  bool wait_event_fd_{false};
+  td::EventFd event_fd_;
+  vector<ValueT> writer_vector_;
+  vector<ValueT> reader_vector_;
+  size_t reader_pos_{0};
+};
+
+// many writers send values to one reader
+template <class QueueT, bool use_put_many>
+class MpscQueueBenchmark : public td::Benchmark {
+  QueueT queue;
+  int writers_n;
+
+ public:
+  explicit MpscQueueBenchmark(int writers_n) : writers_n(writers_n) {
+  }
+
+  std::string get_description() const override {
+    return use_put_many ? "MpscQueueBenchmark (writer_put_many)" : "MpscQueueBenchmark";
+  }
+
+  void start_up() override {
+    queue.init();
+  }
+
+  void tear_down() override {
+    queue.destroy();
+  }
+
+  void run(int n) override {
+    static constexpr int BATCH_SIZE = 16;
+    int values_per_writer = n / writers_n + 1;
+    if (values_per_writer >= (1 << 24)) {
+      std::fprintf(stderr, "Too big n\n");
+      std::exit(0);
+    }
+
+    vector<td::thread> writers;
+    for (int writer_id = 0; writer_id < writers_n; writer_id++) {
+      writers.emplace_back([&, writer_id] {
+        vector<qvalue_t> batch;
+        for (int i = 0; i < values_per_writer; i++) {
+          qvalue_t value = (writer_id << 24) + i;
+          if (use_put_many) {
+            batch.push_back(value);
+            if (batch.size() == BATCH_SIZE || i + 1 == values_per_writer) {
+              queue.writer_put_many(std::move(batch));
+              batch = vector<qvalue_t>();
+            }
+          } else {
+            queue.writer_put(value);
+          }
+        }
+      });
+    }
+
+    vector<int> next_value(writers_n);
+    td::int64 left = static_cast<td::int64>(values_per_writer) * writers_n;
+    while (left > 0) {
+      int cnt = queue.reader_wait();
+      left -= cnt;
+      while (cnt-- > 0) {
+        qvalue_t value = queue.reader_get_unsafe();
+        int writer_id = value >> 24;
+        if (writer_id < 0 || writer_id >= writers_n || (value & 0x00FFFFFF) != next_value[writer_id]++) {
+          std::fprintf(stderr, "BUG\n");
+          std::exit(0);
+        }
+      }
+    }
+
+    for (auto &writer : writers) {
+      writer.join();
+    }
+  }
+};
+
+inline std::unique_ptr<td::MpmcQueue<qvalue_t>> create_mpmc_queue(td::MpmcQueue<qvalue_t> *, size_t threads_n) {
+  return std::make_unique<td::MpmcQueue<qvalue_t>>(1024, threads_n);
+}
+
+inline std::unique_ptr<td::BoundedMpmcQueue<qvalue_t>> create_mpmc_queue(td::BoundedMpmcQueue<qvalue_t> *,
+                                                                         size_t threads_n) {
+  return std::make_unique<td::BoundedMpmcQueue<qvalue_t>>(1024);
+}
+
+// many writers send values to many readers
+template <class QueueT>
+class MpmcQueueBenchmark : public td::Benchmark {
+  std::unique_ptr<QueueT> queue;
+  int writers_n;
+  int readers_n;
+
+ public:
+  MpmcQueueBenchmark(int writers_n, int readers_n) : writers_n(writers_n), readers_n(readers_n) {
+  }
+
+  std::string get_description() const override {
+    return PSTRING() << "MpmcQueueBenchmark " << writers_n << "->" << readers_n;
+  }
+
+  void start_up() override {
+    queue = create_mpmc_queue(static_cast<QueueT *>(nullptr), writers_n + readers_n + 1);
+  }
+
+  void tear_down() override {
+    queue.reset();
+  }
+
+  void run(int n) override {
+    int values_per_writer = n / writers_n + 1;
+
+    std::atomic<td::int64> received{0};
+    vector<td::thread> readers;
+    for (int reader_id = 0; reader_id < readers_n; reader_id++) {
+      readers.emplace_back([&, reader_id] {
+        while (true) {
+          qvalue_t value = queue->pop(reader_id);
+          if (value < 0) {
+            return;
+          }
+          received.fetch_add(1, std::memory_order_relaxed);
+        }
+      });
+    }
+
+    vector<td::thread> writers;
+    for (int writer_id = 0; writer_id < writers_n; writer_id++) {
+      writers.emplace_back([&, writer_id] {
+        for (int i = 0; i < values_per_writer; i++) {
+          queue->push(i, readers_n + writer_id);
+        }
+      });
+    }
+    for (auto &writer : writers) {
+      writer.join();
+    }
+    for (int i = 0; i < readers_n; i++) {
+      queue->push(-1, readers_n + writers_n);
+    }
+    for (auto &reader : readers) {
+      reader.join();
+    }
+
+    if (received.load() != static_cast<td::int64>(values_per_writer) * writers_n) {
+      std::fprintf(stderr, "BUG\n");
+      std::exit(0);
+    }
+  }
+};
+
 template <class QueueT>
 class QueueBenchmark2 : public td::Benchmark {
   QueueT client, server;
@@ -893,18 +1116,40 @@ class RingBenchmark : public td::Benchmark {
   }
 };
 
-int main() {
+// adds the queue name to the description of a benchmark
+class QueueNamedBenchmark : public td::Benchmark {
+ public:
+  QueueNamedBenchmark(td::Benchmark &&benchmark, std::string queue_name)
+      : benchmark_(benchmark), description_(benchmark.get_description() + " " + queue_name) {
+  }
+
+  std::string get_description() const override {
+    return description_;
+  }
+
+  void start_up_n(int n) override {
+    benchmark_.start_up_n(n);
+  }
+
+  void tear_down() override {
+    benchmark_.tear_down();
+  }
+
+  void run(int n) override {
+    benchmark_.run(n);
+  }
+
+ private:
+  td::Benchmark &benchmark_;
+  std::string description_;
+};
+
+BENCH_SUITE(queue) {
   SET_VERBOSITY_LEVEL(VERBOSITY_NAME(DEBUG));
-#define BENCH_Q2(Q, N)                      \
-  std::fprintf(stderr, "!%s %d:\t", #Q, N); \
-  td::bench(QueueBenchmark2<Q>(N));
-#define BENCH_Q(Q, N)                      \
-  std::fprintf(stderr, "%s %d:\t", #Q, N); \
-  td::bench(QueueBenchmark<Q>(N));
-
-#define BENCH_R(Q)                   \
-  std::fprintf(stderr, "%s:\t", #Q); \
-  td::bench(RingBenchmark<Q>());
+#define BENCH_Q2(Q, N) td::bench(QueueNamedBenchmark(QueueBenchmark2<Q>(N), PSTRING() << #Q << ' ' << N));
+#define BENCH_Q(Q, N) td::bench(QueueNamedBenchmark(QueueBenchmark<Q>(N), PSTRING() << #Q << ' ' << N));
+
+#define BENCH_R(Q) td::bench(QueueNamedBenchmark(RingBenchmark<Q>(), #Q));
   // TODO: yield makes it extremely slow. Yet some backoff may be necessary.
   //  BENCH_R(SemQueue);
   //  BENCH_R(td::PollQueue<qvalue_t>);
@@ -915,6 +1160,31 @@ int main() {
   BENCH_Q2(td::MpscPollableQueue<qvalue_t>, 100);
   BENCH_Q2(td::PollQueue<qvalue_t>, 10);
   BENCH_Q2(td::MpscPollableQueue<qvalue_t>, 10);
+  BENCH_Q2(SpinLockPollableQueue<qvalue_t>, 10);
+
+#define BENCH_MPSC(Q, N)                                                                       \
+  td::bench(QueueNamedBenchmark(MpscQueueBenchmark<Q, false>(N), PSTRING() << #Q << ' ' << N)); \
+  td::bench(QueueNamedBenchmark(MpscQueueBenchmark<Q, true>(N), PSTRING() << #Q << ' ' << N));
+
+  BENCH_MPSC(td::MpscPollableQueue<qvalue_t>, 1);
+  BENCH_MPSC(SpinLockPollableQueue<qvalue_t>, 1);
+  BENCH_MPSC(td::MpscPollableQueue<qvalue_t>, 4);
+  BENCH_MPSC(SpinLockPollableQueue<qvalue_t>, 4);
+  BENCH_MPSC(td::MpscPollableQueue<qvalue_t>, 16);
+  BENCH_MPSC(SpinLockPollableQueue<qvalue_t>, 16);
+
+#define BENCH_MPMC(Q, N, M) td::bench(QueueNamedBenchmark(MpmcQueueBenchmark<Q>(N, M), #Q));
+
+  BENCH_MPMC(td::MpmcQueue<qvalue_t>, 1, 1);
+  BENCH_MPMC(td::BoundedMpmcQueue<qvalue_t>, 1, 1);
+  BENCH_MPMC(td::MpmcQueue<qvalue_t>, 1, 16);
+  BENCH_MPMC(td::BoundedMpmcQueue<qvalue_t>, 1, 16);
+  BENCH_MPMC(td::MpmcQueue<qvalue_t>, 4, 4);
+  BENCH_MPMC(td::BoundedMpmcQueue<qvalue_t>, 4, 4);
+  BENCH_MPMC(td::MpmcQueue<qvalue_t>, 16, 16);
+  BENCH_MPMC(td::BoundedMpmcQueue<qvalue_t>, 16, 16);
+  BENCH_MPMC(td::MpmcQueue<qvalue_t>, 64, 64);
+  BENCH_MPMC(td::BoundedMpmcQueue<qvalue_t>, 64, 64);
 
   BENCH_Q(VarQueue, 1);
   // BENCH_Q(FdQueue, 1);
@@ -939,5 +1209,4 @@ int main() {
   // BENCH_Q(BufferQueue, 10);
   // BENCH_Q(BufferQueue, 1);
 
-  return 0;
 }
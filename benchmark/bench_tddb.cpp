@@ -101,8 +101,7 @@ class MessagesDbBench : public Benchmark {
 };
 }  // namespace td
 
-int main() {
+BENCH_SUITE(tddb) {
   SET_VERBOSITY_LEVEL(VERBOSITY_NAME(WARNING));
   bench(td::MessagesDbBench());
-  return 0;
 }
@@ -0,0 +1,117 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/net/TrafficRecorder.h"
+#include "td/telegram/telegram_api.h"
+
+#include "td/utils/common.h"
+#include "td/utils/format.h"
+#include "td/utils/logging.h"
+#include "td/utils/misc.h"
+#include "td/utils/port/Stat.h"
+#include "td/utils/Time.h"
+#include "td/utils/tl_parsers.h"
+
+#include <algorithm>
+#include <map>
+
+// Parses updates and query results recorded with the "traffic_dump_path" option and measures parsing speed;
+// the records aren't applied to any client, so only deserialization is benchmarked
+
+namespace {
+
+struct ParseStat {
+  td::int64 count = 0;
+  td::int64 size = 0;
+  td::int64 failed = 0;
+  td::vector<double> latencies;
+};
+
+template <class T>
+bool parse_record(const td::TrafficRecord &record) {
+  td::TlBufferParser parser(&record.data);
+  auto object = T::fetch(parser);
+  parser.fetch_end();
+  return object != nullptr && parser.get_error() == nullptr;
+}
+
+double get_percentile(const td::vector<double> &sorted_values, int percent) {
+  if (sorted_values.empty()) {
+    return 0.0;
+  }
+  return sorted_values[(sorted_values.size() - 1) * percent / 100];
+}
+
+void print_stat(td::Slice name, ParseStat &stat, double total_time) {
+  std::sort(stat.latencies.begin(), stat.latencies.end());
+  LOG(PLAIN) << name << ": " << stat.count << " records of total size " << td::format::as_size(stat.size) << ", "
+             << stat.failed << " failed to parse, " << (total_time > 0 ? stat.count / total_time : 0.0)
+             << " records/s; latency p50 = " << td::format::as_time(get_percentile(stat.latencies, 50))
+             << ", p90 = " << td::format::as_time(get_percentile(stat.latencies, 90))
+             << ", p99 = " << td::format::as_time(get_percentile(stat.latencies, 99))
+             << ", max = " << td::format::as_time(get_percentile(stat.latencies, 100)) << '\n';
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  SET_VERBOSITY_LEVEL(VERBOSITY_NAME(ERROR));
+  if (argc < 2) {
+    LOG(PLAIN) << "Usage: bench_traffic_dump_parse <traffic dump> [repeat_count]\n";
+    return 2;
+  }
+  int repeat_count = argc > 2 ? std::max(td::to_integer<int>(td::Slice(argv[2])), 1) : 1;
+
+  auto r_records = td::read_traffic_records(td::CSlice(argv[1]));
+  if (r_records.is_error()) {
+    LOG(PLAIN) << "Failed to read " << argv[1] << ": " << r_records.error() << '\n';
+    return 1;
+  }
+  auto records = r_records.move_as_ok();
+  if (records.empty()) {
+    LOG(PLAIN) << "There are no records in " << argv[1] << '\n';
+    return 1;
+  }
+
+  ParseStat update_stat;
+  ParseStat result_stat;
+  std::map<td::int32, td::int64> result_counts;
+  double start_time = td::Time::now();
+  for (int i = 0; i < repeat_count; i++) {
+    for (auto &record : records) {
+      bool is_update = record.type == td::TrafficRecord::Type::Update;
+      auto &stat = is_update ? update_stat : result_stat;
+      double record_start_time = td::Time::now();
+      bool is_ok = is_update ? parse_record<td::telegram_api::Updates>(record)
+                             : parse_record<td::telegram_api::Object>(record);
+      stat.latencies.push_back(td::Time::now() - record_start_time);
+      stat.count++;
+      stat.size += static_cast<td::int64>(record.data.size());
+      if (!is_ok) {
+        // results of type Bool and Vector t can't be parsed without knowing the query
+        stat.failed++;
+      }
+      if (!is_update && i == 0) {
+        result_counts[record.query_tl_constructor]++;
+      }
+    }
+  }
+  double total_time = td::Time::now() - start_time;
+
+  LOG(PLAIN) << "Parsed " << records.size() << " records received in "
+             << td::format::as_time(records.back().date - records[0].date) << " " << repeat_count << " times in "
+             << td::format::as_time(total_time) << '\n';
+  print_stat("Updates", update_stat, total_time);
+  print_stat("Results", result_stat, total_time);
+  for (auto &it : result_counts) {
+    LOG(PLAIN) << "Query " << td::format::as_hex(it.first) << ": " << it.second << " results\n";
+  }
+  auto r_mem_stat = td::mem_stat();
+  if (r_mem_stat.is_ok()) {
+    LOG(PLAIN) << "Peak resident memory: " << td::format::as_size(r_mem_stat.ok().resident_size_peak_) << '\n';
+  }
+  return 0;
+}
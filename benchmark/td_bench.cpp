@@ -0,0 +1,234 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/benchmark.h"
+#include "td/utils/common.h"
+#include "td/utils/filesystem.h"
+#include "td/utils/format.h"
+#include "td/utils/JsonBuilder.h"
+#include "td/utils/logging.h"
+#include "td/utils/misc.h"
+#include "td/utils/Slice.h"
+#include "td/utils/StringBuilder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+static std::atomic<td::int64> allocation_count{0};
+
+static void *allocate(std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  auto ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) {
+    std::abort();
+  }
+  return ptr;
+}
+
+void *operator new(std::size_t size) {
+  return allocate(size);
+}
+
+void *operator new[](std::size_t size) {
+  return allocate(size);
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+namespace td {
+
+class TdBenchRunner : public BenchmarkRunner {
+ public:
+  struct Result {
+    string name;
+    BenchmarkStat stat;
+  };
+
+  bool is_list = false;
+  double max_time = 0;
+  vector<string> filters;
+  BenchmarkOptions options;
+  vector<Result> results;
+
+  void set_suite(Slice suite) {
+    suite_ = suite.str();
+  }
+
+  void run(Benchmark &b, double default_max_time) override {
+    auto name = PSTRING() << suite_ << '/' << b.get_description();
+    for (auto &filter : filters) {
+      bool is_match = name.find(filter.substr(1)) != string::npos;
+      if (is_match != (filter[0] == '+')) {
+        return;
+      }
+    }
+    if (is_list) {
+      LOG(PLAIN) << name << '\n';
+      return;
+    }
+
+    options.max_time = max_time > 0 ? max_time : default_max_time;
+    auto stat = bench_stat(b, options);
+    auto line = PSTRING("Bench [%-50s]: %.3lf ops/sec, ", name.c_str(), stat.mean) << format::as_time(1 / stat.mean);
+    line += PSTRING(" [d = %.2lf%%], p50 = %.3lf, p90 = %.3lf, p99 = %.3lf", 100 * stat.stddev / stat.mean, stat.p50,
+                    stat.p90, stat.p99);
+    if (stat.allocations_per_iteration >= 0) {
+      line += PSTRING(", %.2lf allocations/op", stat.allocations_per_iteration);
+    }
+    LOG(PLAIN) << line << '\n';
+    results.push_back(Result{std::move(name), std::move(stat)});
+  }
+
+  string get_json() const {
+    vector<char> buf(1 << 20);
+    JsonBuilder jb(StringBuilder(MutableSlice(buf.data(), buf.size())));
+    {
+      auto object = jb.enter_object();
+      object << ctie("warmup_count", options.warmup_count);
+      object << ctie("pass_count", options.pass_count);
+      object << ctie("benchmarks", JsonResults(results));
+    }
+    LOG_IF(ERROR, jb.string_builder().is_error()) << "JSON buffer overflow";
+    return jb.string_builder().as_cslice().str();
+  }
+
+ private:
+  string suite_;
+
+  class JsonResult : public Jsonable {
+   public:
+    explicit JsonResult(const Result &result) : result_(result) {
+    }
+    void store(JsonValueScope *scope) const {
+      auto &stat = result_.stat;
+      auto object = scope->enter_object();
+      object << ctie("name", result_.name);
+      object << ctie("iterations", stat.n);
+      object << ctie("ops_per_second", JsonFloat(stat.mean));
+      object << ctie("stddev", JsonFloat(stat.stddev));
+      object << ctie("min", JsonFloat(stat.min));
+      object << ctie("max", JsonFloat(stat.max));
+      object << ctie("p50", JsonFloat(stat.p50));
+      object << ctie("p90", JsonFloat(stat.p90));
+      object << ctie("p99", JsonFloat(stat.p99));
+      if (stat.allocations_per_iteration >= 0) {
+        object << ctie("allocations_per_op", JsonFloat(stat.allocations_per_iteration));
+      }
+    }
+
+   private:
+    const Result &result_;
+  };
+
+  class JsonResults : public Jsonable {
+   public:
+    explicit JsonResults(const vector<Result> &results) : results_(results) {
+    }
+    void store(JsonValueScope *scope) const {
+      auto array = scope->enter_array();
+      for (auto &result : results_) {
+        array << JsonResult(result);
+      }
+    }
+
+   private:
+    const vector<Result> &results_;
+  };
+};
+
+static void usage() {
+  LOG(PLAIN) << "Usage: td_bench [options]\n"
+             << "  --list           list benchmarks instead of running them\n"
+             << "  --filter <str>   run only benchmarks, which names contain the substring; '-' prefix excludes them\n"
+             << "  --warmup <n>     number of discarded passes before measurements (default 1)\n"
+             << "  --repeat <n>     number of measured passes (default 5)\n"
+             << "  --max-time <s>   approximate duration of one pass (default is benchmark-specific)\n"
+             << "  --json <file>    write results in JSON format to the file\n";
+}
+
+static int main(int argc, char **argv) {
+  TdBenchRunner runner;
+  runner.options.warmup_count = 1;
+  runner.options.pass_count = 5;
+  runner.options.get_allocation_count = [] {
+    return allocation_count.load(std::memory_order_relaxed);
+  };
+  string json_path;
+
+  // TODO port OptionsParser to Windows
+  for (int i = 1; i < argc; i++) {
+    auto get_argument = [&] {
+      if (i + 1 == argc) {
+        usage();
+        std::exit(2);
+      }
+      return Slice(argv[++i]);
+    };
+    if (!std::strcmp(argv[i], "--list")) {
+      runner.is_list = true;
+    } else if (!std::strcmp(argv[i], "--filter")) {
+      auto filter = get_argument().str();
+      if (filter.empty() || (filter[0] != '+' && filter[0] != '-')) {
+        filter = "+" + filter;
+      }
+      runner.filters.push_back(std::move(filter));
+    } else if (!std::strcmp(argv[i], "--warmup")) {
+      runner.options.warmup_count = std::max(to_integer<int>(get_argument()), 0);
+    } else if (!std::strcmp(argv[i], "--repeat")) {
+      runner.options.pass_count = std::max(to_integer<int>(get_argument()), 1);
+    } else if (!std::strcmp(argv[i], "--max-time")) {
+      runner.max_time = to_double(get_argument());
+    } else if (!std::strcmp(argv[i], "--json")) {
+      json_path = get_argument().str();
+    } else {
+      usage();
+      return 2;
+    }
+  }
+
+  set_benchmark_runner(&runner);
+  auto suites = get_benchmark_suites();
+  std::sort(suites.begin(), suites.end());
+  for (auto &suite : suites) {
+    runner.set_suite(suite.first);
+    suite.second();
+    // suites can change verbosity level
+    SET_VERBOSITY_LEVEL(VERBOSITY_NAME(ERROR));
+  }
+  set_benchmark_runner(nullptr);
+
+  if (!json_path.empty() && !runner.is_list) {
+    auto status = write_file(json_path, runner.get_json());
+    if (status.is_error()) {
+      LOG(PLAIN) << "Failed to write results to " << json_path << ": " << status << '\n';
+      return 1;
+    }
+  }
+  return 0;
+}
+
+}  // namespace td
+
+int main(int argc, char **argv) {
+  return td::main(argc, argv);
+}
@@ -6,20 +6,26 @@
 //
 #include "memprof/memprof.h"
 
+#include "td/utils/logging.h"
 #include "td/utils/port/platform.h"
 
-#if (TD_DARWIN || TD_LINUX) && defined(USE_MEMPROF)
 #include <algorithm>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#if (TD_DARWIN || TD_LINUX) && defined(USE_MEMPROF)
 #include <atomic>
 #include <cassert>
 #include <cstddef>
-#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <functional>
 #include <new>
-#include <utility>
-#include <vector>
 
 #include <dlfcn.h>
 #include <execinfo.h>
@@ -80,12 +86,34 @@ double get_fast_backtrace_success_rate() {
 
 #endif
 
+static constexpr std::uintptr_t UNKNOWN_BACKTRACE_TAG = 1;
+static constexpr std::uintptr_t UNSAMPLED_BACKTRACE_TAG = 2;
+
+static std::atomic<std::size_t> sample_rate{1};
+
+void set_memprof_sample_rate(std::size_t new_sample_rate) {
+  sample_rate.store(std::max(new_sample_rate, std::size_t(1)), std::memory_order_relaxed);
+}
+
+std::size_t get_memprof_sample_rate() {
+  return sample_rate.load(std::memory_order_relaxed);
+}
+
 static Backtrace get_backtrace() {
   static __thread bool in_backtrace;  // static zero-initialized
   Backtrace res{{nullptr}};
   if (in_backtrace) {
+    res[0] = reinterpret_cast<void *>(UNSAMPLED_BACKTRACE_TAG);
     return res;
   }
+  auto current_sample_rate = sample_rate.load(std::memory_order_relaxed);
+  if (current_sample_rate > 1) {
+    static __thread std::size_t allocation_count;  // static zero-initialized
+    if (++allocation_count % current_sample_rate != 0) {
+      res[0] = reinterpret_cast<void *>(UNSAMPLED_BACKTRACE_TAG);
+      return res;
+    }
+  }
   in_backtrace = true;
   std::array<void *, res.size() + BACKTRACE_SHIFT + 10> tmp{{nullptr}};
   std::size_t n;
@@ -116,12 +144,14 @@ static Backtrace get_backtrace() {
   return res;
 }
 
-static constexpr std::size_t reserved = 16;
+static constexpr std::size_t reserved = 32;
 static constexpr std::int32_t malloc_info_magic = 0x27138373;
 struct malloc_info {
   std::int32_t magic;
   std::int32_t size;
-  std::int32_t ht_pos;
+  std::int32_t ht_pos;  // -1 for unsampled allocations
+  std::int32_t owner_pos;
+  std::int32_t weight;  // sample rate at the time of the allocation
 };
 
 static std::uint64_t get_hash(const Backtrace &bt) {
@@ -158,7 +188,7 @@ std::int32_t get_ht_pos(const Backtrace &bt, bool force = false) {
           assert(ht_size * 10 < ht_max_size * 7);
         } else {
           Backtrace unknown_bt{{nullptr}};
-          unknown_bt[0] = reinterpret_cast<void *>(1);
+          unknown_bt[0] = reinterpret_cast<void *>(UNKNOWN_BACKTRACE_TAG);
           return get_ht_pos(unknown_bt, true);
         }
       }
@@ -185,6 +215,59 @@ std::int32_t get_ht_pos(const Backtrace &bt, bool force = false) {
   }
 }
 
+// allocations are attributed to the actor, which was running when they were made; td names actors after subsystems
+struct OwnerNode {
+  std::atomic<std::uint64_t> hash;
+  std::array<char, 48> name;
+  std::atomic<std::size_t> size;
+};
+
+static constexpr std::size_t owners_max_size = 1 << 12;
+static std::atomic<std::size_t> owners_size{0};
+static std::array<OwnerNode, owners_max_size> owners;
+
+static std::int32_t get_owner_pos(const char *name, bool force = false) {
+  if (name == nullptr) {
+    name = "<no actor>";
+  }
+  std::uint64_t hash = 7;
+  for (auto *c = name; *c != '\0'; c++) {
+    hash = hash * 0x4372897893428797lu + static_cast<unsigned char>(*c);
+  }
+  if (hash == 0) {
+    hash = 1;
+  }
+  std::size_t pos = hash % owners.size();
+  while (true) {
+    auto pos_hash = owners[pos].hash.load();
+    if (pos_hash == hash) {
+      return static_cast<std::int32_t>(pos);
+    }
+    if (pos_hash == 0) {
+      if (owners_size > owners_max_size / 2 && !force) {
+        return get_owner_pos("<other>", true);
+      }
+
+      std::uint64_t expected = 0;
+      if (owners[pos].hash.compare_exchange_strong(expected, hash)) {
+        auto &owner_name = owners[pos].name;
+        std::size_t length = 0;
+        while (length + 1 < owner_name.size() && name[length] != '\0') {
+          owner_name[length] = name[length];
+          length++;
+        }
+        owner_name[length] = '\0';
+        ++owners_size;
+        return static_cast<std::int32_t>(pos);
+      }
+      continue;
+    }
+    if (++pos == owners.size()) {
+      pos = 0;
+    }
+  }
+}
+
 void dump_alloc(const std::function<void(const AllocInfo &)> &func) {
   for (auto &node : ht) {
     if (node.size == 0) {
@@ -194,11 +277,27 @@ void dump_alloc(const std::function<void(const AllocInfo &)> &func) {
   }
 }
 
+void dump_alloc_owners(const std::function<void(const AllocOwnerInfo &)> &func) {
+  for (auto &node : owners) {
+    if (node.size == 0) {
+      continue;
+    }
+    func(AllocOwnerInfo{node.name.data(), node.size.load()});
+  }
+}
+
+// sampled allocations are accounted with weight equal to the sample rate to estimate the total usage
 void register_xalloc(malloc_info *info, std::int32_t diff) {
+  if (info->ht_pos < 0) {
+    return;
+  }
+  auto size = static_cast<std::size_t>(info->size) * static_cast<std::size_t>(info->weight);
   if (diff > 0) {
-    ht[info->ht_pos].size += info->size;
+    ht[info->ht_pos].size += size;
+    owners[info->owner_pos].size += size;
   } else {
-    ht[info->ht_pos].size -= info->size;
+    ht[info->ht_pos].size -= size;
+    owners[info->owner_pos].size -= size;
   }
 }
 
@@ -219,7 +318,15 @@ static void *malloc_with_frame(std::size_t size, const Backtrace &frame) {
 
   info->magic = malloc_info_magic;
   info->size = static_cast<std::int32_t>(size);
-  info->ht_pos = get_ht_pos(frame);
+  if (frame[0] == reinterpret_cast<void *>(UNSAMPLED_BACKTRACE_TAG)) {
+    info->ht_pos = -1;
+    info->owner_pos = -1;
+    info->weight = 0;
+  } else {
+    info->ht_pos = get_ht_pos(frame);
+    info->owner_pos = get_owner_pos(td::Logger::tag2_);
+    info->weight = static_cast<std::int32_t>(sample_rate.load(std::memory_order_relaxed));
+  }
 
   register_xalloc(info, +1);
 
@@ -296,12 +403,40 @@ void operator delete(void *ptr, std::size_t) noexcept(true) {
 // void *operator new(std::size_t count, std::align_val_t al);
 // void operator delete(void *ptr, std::align_val_t al);
 
+static std::string get_frame_name(void *frame) {
+  if (frame == reinterpret_cast<void *>(UNKNOWN_BACKTRACE_TAG)) {
+    return "<untracked>";
+  }
+  char buf[64];
+  std::snprintf(buf, sizeof(buf), "%p", frame);
+  std::string res = buf;
+  Dl_info info;
+  if (dladdr(frame, &info) != 0 && info.dli_sname != nullptr) {
+    std::snprintf(buf, sizeof(buf), "+0x%" PRIxPTR,
+                  reinterpret_cast<std::uintptr_t>(frame) - reinterpret_cast<std::uintptr_t>(info.dli_saddr));
+    res += ' ';
+    res += info.dli_sname;
+    res += buf;
+  }
+  return res;
+}
+
 #else
+void set_memprof_sample_rate(std::size_t sample_rate) {
+}
+std::size_t get_memprof_sample_rate() {
+  return 0;
+}
+static std::string get_frame_name(void *frame) {
+  return std::string();
+}
 bool is_memprof_on() {
   return false;
 }
 void dump_alloc(const std::function<void(const AllocInfo &)> &func) {
 }
+void dump_alloc_owners(const std::function<void(const AllocOwnerInfo &)> &func) {
+}
 double get_fast_backtrace_success_rate() {
   return 0;
 }
@@ -315,3 +450,109 @@ std::size_t get_used_memory_size() {
   dump_alloc([&](const auto info) { res += info.size; });
   return res;
 }
+
+std::string get_memory_usage_report(std::size_t max_backtrace_count) {
+  if (!is_memprof_on()) {
+    return "Memory profiling is disabled\n";
+  }
+
+  struct BacktraceUsage {
+    Backtrace backtrace;
+    std::size_t size;
+    std::int64_t growth;
+  };
+
+  struct OwnerUsage {
+    std::string name;
+    std::size_t size;
+    std::int64_t growth;
+  };
+
+  static std::mutex mutex;
+  static std::map<Backtrace, std::size_t> previous_sizes;
+  static std::map<std::string, std::size_t> previous_owner_sizes;
+  std::lock_guard<std::mutex> guard(mutex);
+
+  std::vector<BacktraceUsage> usages;
+  std::map<Backtrace, std::size_t> sizes;
+  std::size_t total_size = 0;
+  dump_alloc([&](const AllocInfo &info) {
+    std::int64_t growth = static_cast<std::int64_t>(info.size);
+    auto it = previous_sizes.find(info.backtrace);
+    if (it != previous_sizes.end()) {
+      growth -= static_cast<std::int64_t>(it->second);
+      previous_sizes.erase(it);
+    }
+    usages.push_back(BacktraceUsage{info.backtrace, info.size, growth});
+    sizes.emplace(info.backtrace, info.size);
+    total_size += info.size;
+  });
+  // backtraces, which have no live allocations now
+  for (auto &it : previous_sizes) {
+    usages.push_back(BacktraceUsage{it.first, 0, -static_cast<std::int64_t>(it.second)});
+  }
+  previous_sizes = std::move(sizes);
+
+  std::vector<OwnerUsage> owner_usages;
+  std::map<std::string, std::size_t> owner_sizes;
+  dump_alloc_owners([&](const AllocOwnerInfo &info) {
+    std::string name = info.name;
+    std::int64_t growth = static_cast<std::int64_t>(info.size);
+    auto it = previous_owner_sizes.find(name);
+    if (it != previous_owner_sizes.end()) {
+      growth -= static_cast<std::int64_t>(it->second);
+      previous_owner_sizes.erase(it);
+    }
+    owner_sizes.emplace(name, info.size);
+    owner_usages.push_back(OwnerUsage{std::move(name), info.size, growth});
+  });
+  for (auto &it : previous_owner_sizes) {
+    owner_usages.push_back(OwnerUsage{it.first, 0, -static_cast<std::int64_t>(it.second)});
+  }
+  previous_owner_sizes = std::move(owner_sizes);
+
+  std::int64_t total_growth = 0;
+  for (auto &usage : usages) {
+    total_growth += usage.growth;
+  }
+
+  std::string res;
+  char buf[128];
+  std::snprintf(buf, sizeof(buf), "Total: %zu bytes in %zu backtraces, growth %+" PRId64 " bytes, sample rate %zu\n",
+                total_size, get_ht_size(), total_growth, get_memprof_sample_rate());
+  res += buf;
+
+  std::sort(owner_usages.begin(), owner_usages.end(),
+            [](const OwnerUsage &lhs, const OwnerUsage &rhs) { return lhs.size > rhs.size; });
+  res += "Memory usage by actor:\n";
+  for (std::size_t i = 0; i < owner_usages.size() && i < max_backtrace_count; i++) {
+    auto &usage = owner_usages[i];
+    std::snprintf(buf, sizeof(buf), "    %s: %zu bytes, growth %+" PRId64 " bytes\n", usage.name.c_str(), usage.size,
+                  usage.growth);
+    res += buf;
+  }
+
+  auto print_top = [&](const char *title, auto compare) {
+    auto count = std::min(max_backtrace_count, usages.size());
+    std::partial_sort(usages.begin(), usages.begin() + count, usages.end(), compare);
+    res += title;
+    for (std::size_t i = 0; i < count; i++) {
+      auto &usage = usages[i];
+      std::snprintf(buf, sizeof(buf), "%zu bytes, growth %+" PRId64 " bytes:\n", usage.size, usage.growth);
+      res += buf;
+      for (auto frame : usage.backtrace) {
+        if (frame == nullptr) {
+          break;
+        }
+        res += "    ";
+        res += get_frame_name(frame);
+        res += '\n';
+      }
+    }
+  };
+  print_top("Biggest memory usage:\n",
+            [](const BacktraceUsage &lhs, const BacktraceUsage &rhs) { return lhs.size > rhs.size; });
+  print_top("Biggest memory usage growth:\n",
+            [](const BacktraceUsage &lhs, const BacktraceUsage &rhs) { return lhs.growth > rhs.growth; });
+  return res;
+}
@@ -9,6 +9,7 @@
 #include <array>
 #include <cstddef>
 #include <functional>
+#include <string>
 
 constexpr std::size_t BACKTRACE_SHIFT = 2;
 constexpr std::size_t BACKTRACE_HASHED_LENGTH = 6;
@@ -19,9 +20,24 @@ struct AllocInfo {
   Backtrace backtrace;
   std::size_t size;
 };
+struct AllocOwnerInfo {
+  const char *name;
+  std::size_t size;
+};
 
 bool is_memprof_on();
 std::size_t get_ht_size();
 double get_fast_backtrace_success_rate();
 void dump_alloc(const std::function<void(const AllocInfo &)> &func);
+// live memory grouped by name of the actor, which made the allocation
+void dump_alloc_owners(const std::function<void(const AllocOwnerInfo &)> &func);
 std::size_t get_used_memory_size();
+
+// only 1 of every sample_rate allocations is tracked; sizes of tracked allocations are multiplied by sample_rate,
+// so all returned sizes are estimates unless sample_rate is 1
+void set_memprof_sample_rate(std::size_t sample_rate);
+std::size_t get_memprof_sample_rate();
+
+// returns human-readable list of actors and backtraces with the biggest memory usage and with the biggest memory usage
+// growth since the previous call
+std::string get_memory_usage_report(std::size_t max_backtrace_count);
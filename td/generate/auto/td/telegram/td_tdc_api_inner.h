@@ -0,0 +1,3943 @@
+#pragma once
+#include "td/telegram/td_tdc_api.h"
+#include "td/telegram/td_api.h"
+td::td_api::object_ptr<td::td_api::Object> TdConvertToInternal (struct TdObject *var);
+struct TdObject *TdConvertFromInternal (const td::td_api::Object &from);
+std::string TdToString (struct TdObject *var);
+void TdDestroyObject (struct TdObject *var);
+void TdStackStorer (struct TdObject *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::Function> TdConvertToInternal (struct TdFunction *var);
+struct TdFunction *TdConvertFromInternal (const td::td_api::Function &from);
+std::string TdToString (struct TdFunction *var);
+void TdDestroyObject (struct TdFunction *var);
+void TdStackStorer (struct TdFunction *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::accountTtl> TdConvertToInternal (struct TdAccountTtl *var);
+struct TdAccountTtl *TdConvertFromInternal (const td::td_api::accountTtl &from);
+std::string TdToString (struct TdAccountTtl *var);
+void TdDestroyObject (struct TdAccountTtl *var);
+void TdStackStorer (struct TdAccountTtl *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::animation> TdConvertToInternal (struct TdAnimation *var);
+struct TdAnimation *TdConvertFromInternal (const td::td_api::animation &from);
+std::string TdToString (struct TdAnimation *var);
+void TdDestroyObject (struct TdAnimation *var);
+void TdStackStorer (struct TdAnimation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::animations> TdConvertToInternal (struct TdAnimations *var);
+struct TdAnimations *TdConvertFromInternal (const td::td_api::animations &from);
+std::string TdToString (struct TdAnimations *var);
+void TdDestroyObject (struct TdAnimations *var);
+void TdStackStorer (struct TdAnimations *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::audio> TdConvertToInternal (struct TdAudio *var);
+struct TdAudio *TdConvertFromInternal (const td::td_api::audio &from);
+std::string TdToString (struct TdAudio *var);
+void TdDestroyObject (struct TdAudio *var);
+void TdStackStorer (struct TdAudio *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::authenticationCodeInfo> TdConvertToInternal (struct TdAuthenticationCodeInfo *var);
+struct TdAuthenticationCodeInfo *TdConvertFromInternal (const td::td_api::authenticationCodeInfo &from);
+std::string TdToString (struct TdAuthenticationCodeInfo *var);
+void TdDestroyObject (struct TdAuthenticationCodeInfo *var);
+void TdStackStorer (struct TdAuthenticationCodeInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::AuthenticationCodeType> TdConvertToInternal (struct TdAuthenticationCodeType *var);
+struct TdAuthenticationCodeType *TdConvertFromInternal (const td::td_api::AuthenticationCodeType &from);
+std::string TdToString (struct TdAuthenticationCodeType *var);
+void TdDestroyObject (struct TdAuthenticationCodeType *var);
+void TdStackStorer (struct TdAuthenticationCodeType *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::authenticationCodeTypeTelegramMessage> TdConvertToInternal (struct TdAuthenticationCodeTypeTelegramMessage *var);
+struct TdAuthenticationCodeTypeTelegramMessage *TdConvertFromInternal (const td::td_api::authenticationCodeTypeTelegramMessage &from);
+std::string TdToString (struct TdAuthenticationCodeTypeTelegramMessage *var);
+void TdDestroyObject (struct TdAuthenticationCodeTypeTelegramMessage *var);
+void TdStackStorer (struct TdAuthenticationCodeTypeTelegramMessage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::authenticationCodeTypeSms> TdConvertToInternal (struct TdAuthenticationCodeTypeSms *var);
+struct TdAuthenticationCodeTypeSms *TdConvertFromInternal (const td::td_api::authenticationCodeTypeSms &from);
+std::string TdToString (struct TdAuthenticationCodeTypeSms *var);
+void TdDestroyObject (struct TdAuthenticationCodeTypeSms *var);
+void TdStackStorer (struct TdAuthenticationCodeTypeSms *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::authenticationCodeTypeCall> TdConvertToInternal (struct TdAuthenticationCodeTypeCall *var);
+struct TdAuthenticationCodeTypeCall *TdConvertFromInternal (const td::td_api::authenticationCodeTypeCall &from);
+std::string TdToString (struct TdAuthenticationCodeTypeCall *var);
+void TdDestroyObject (struct TdAuthenticationCodeTypeCall *var);
+void TdStackStorer (struct TdAuthenticationCodeTypeCall *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::authenticationCodeTypeFlashCall> TdConvertToInternal (struct TdAuthenticationCodeTypeFlashCall *var);
+struct TdAuthenticationCodeTypeFlashCall *TdConvertFromInternal (const td::td_api::authenticationCodeTypeFlashCall &from);
+std::string TdToString (struct TdAuthenticationCodeTypeFlashCall *var);
+void TdDestroyObject (struct TdAuthenticationCodeTypeFlashCall *var);
+void TdStackStorer (struct TdAuthenticationCodeTypeFlashCall *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::AuthorizationState> TdConvertToInternal (struct TdAuthorizationState *var);
+struct TdAuthorizationState *TdConvertFromInternal (const td::td_api::AuthorizationState &from);
+std::string TdToString (struct TdAuthorizationState *var);
+void TdDestroyObject (struct TdAuthorizationState *var);
+void TdStackStorer (struct TdAuthorizationState *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::authorizationStateWaitTdlibParameters> TdConvertToInternal (struct TdAuthorizationStateWaitTdlibParameters *var);
+struct TdAuthorizationStateWaitTdlibParameters *TdConvertFromInternal (const td::td_api::authorizationStateWaitTdlibParameters &from);
+std::string TdToString (struct TdAuthorizationStateWaitTdlibParameters *var);
+void TdDestroyObject (struct TdAuthorizationStateWaitTdlibParameters *var);
+void TdStackStorer (struct TdAuthorizationStateWaitTdlibParameters *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::authorizationStateWaitEncryptionKey> TdConvertToInternal (struct TdAuthorizationStateWaitEncryptionKey *var);
+struct TdAuthorizationStateWaitEncryptionKey *TdConvertFromInternal (const td::td_api::authorizationStateWaitEncryptionKey &from);
+std::string TdToString (struct TdAuthorizationStateWaitEncryptionKey *var);
+void TdDestroyObject (struct TdAuthorizationStateWaitEncryptionKey *var);
+void TdStackStorer (struct TdAuthorizationStateWaitEncryptionKey *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::authorizationStateWaitPhoneNumber> TdConvertToInternal (struct TdAuthorizationStateWaitPhoneNumber *var);
+struct TdAuthorizationStateWaitPhoneNumber *TdConvertFromInternal (const td::td_api::authorizationStateWaitPhoneNumber &from);
+std::string TdToString (struct TdAuthorizationStateWaitPhoneNumber *var);
+void TdDestroyObject (struct TdAuthorizationStateWaitPhoneNumber *var);
+void TdStackStorer (struct TdAuthorizationStateWaitPhoneNumber *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::authorizationStateWaitCode> TdConvertToInternal (struct TdAuthorizationStateWaitCode *var);
+struct TdAuthorizationStateWaitCode *TdConvertFromInternal (const td::td_api::authorizationStateWaitCode &from);
+std::string TdToString (struct TdAuthorizationStateWaitCode *var);
+void TdDestroyObject (struct TdAuthorizationStateWaitCode *var);
+void TdStackStorer (struct TdAuthorizationStateWaitCode *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::authorizationStateWaitPassword> TdConvertToInternal (struct TdAuthorizationStateWaitPassword *var);
+struct TdAuthorizationStateWaitPassword *TdConvertFromInternal (const td::td_api::authorizationStateWaitPassword &from);
+std::string TdToString (struct TdAuthorizationStateWaitPassword *var);
+void TdDestroyObject (struct TdAuthorizationStateWaitPassword *var);
+void TdStackStorer (struct TdAuthorizationStateWaitPassword *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::authorizationStateReady> TdConvertToInternal (struct TdAuthorizationStateReady *var);
+struct TdAuthorizationStateReady *TdConvertFromInternal (const td::td_api::authorizationStateReady &from);
+std::string TdToString (struct TdAuthorizationStateReady *var);
+void TdDestroyObject (struct TdAuthorizationStateReady *var);
+void TdStackStorer (struct TdAuthorizationStateReady *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::authorizationStateLoggingOut> TdConvertToInternal (struct TdAuthorizationStateLoggingOut *var);
+struct TdAuthorizationStateLoggingOut *TdConvertFromInternal (const td::td_api::authorizationStateLoggingOut &from);
+std::string TdToString (struct TdAuthorizationStateLoggingOut *var);
+void TdDestroyObject (struct TdAuthorizationStateLoggingOut *var);
+void TdStackStorer (struct TdAuthorizationStateLoggingOut *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::authorizationStateClosing> TdConvertToInternal (struct TdAuthorizationStateClosing *var);
+struct TdAuthorizationStateClosing *TdConvertFromInternal (const td::td_api::authorizationStateClosing &from);
+std::string TdToString (struct TdAuthorizationStateClosing *var);
+void TdDestroyObject (struct TdAuthorizationStateClosing *var);
+void TdStackStorer (struct TdAuthorizationStateClosing *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::authorizationStateClosed> TdConvertToInternal (struct TdAuthorizationStateClosed *var);
+struct TdAuthorizationStateClosed *TdConvertFromInternal (const td::td_api::authorizationStateClosed &from);
+std::string TdToString (struct TdAuthorizationStateClosed *var);
+void TdDestroyObject (struct TdAuthorizationStateClosed *var);
+void TdStackStorer (struct TdAuthorizationStateClosed *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::basicGroup> TdConvertToInternal (struct TdBasicGroup *var);
+struct TdBasicGroup *TdConvertFromInternal (const td::td_api::basicGroup &from);
+std::string TdToString (struct TdBasicGroup *var);
+void TdDestroyObject (struct TdBasicGroup *var);
+void TdStackStorer (struct TdBasicGroup *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::basicGroupFullInfo> TdConvertToInternal (struct TdBasicGroupFullInfo *var);
+struct TdBasicGroupFullInfo *TdConvertFromInternal (const td::td_api::basicGroupFullInfo &from);
+std::string TdToString (struct TdBasicGroupFullInfo *var);
+void TdDestroyObject (struct TdBasicGroupFullInfo *var);
+void TdStackStorer (struct TdBasicGroupFullInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::botCommand> TdConvertToInternal (struct TdBotCommand *var);
+struct TdBotCommand *TdConvertFromInternal (const td::td_api::botCommand &from);
+std::string TdToString (struct TdBotCommand *var);
+void TdDestroyObject (struct TdBotCommand *var);
+void TdStackStorer (struct TdBotCommand *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::botInfo> TdConvertToInternal (struct TdBotInfo *var);
+struct TdBotInfo *TdConvertFromInternal (const td::td_api::botInfo &from);
+std::string TdToString (struct TdBotInfo *var);
+void TdDestroyObject (struct TdBotInfo *var);
+void TdStackStorer (struct TdBotInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::call> TdConvertToInternal (struct TdCall *var);
+struct TdCall *TdConvertFromInternal (const td::td_api::call &from);
+std::string TdToString (struct TdCall *var);
+void TdDestroyObject (struct TdCall *var);
+void TdStackStorer (struct TdCall *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::callConnection> TdConvertToInternal (struct TdCallConnection *var);
+struct TdCallConnection *TdConvertFromInternal (const td::td_api::callConnection &from);
+std::string TdToString (struct TdCallConnection *var);
+void TdDestroyObject (struct TdCallConnection *var);
+void TdStackStorer (struct TdCallConnection *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::CallDiscardReason> TdConvertToInternal (struct TdCallDiscardReason *var);
+struct TdCallDiscardReason *TdConvertFromInternal (const td::td_api::CallDiscardReason &from);
+std::string TdToString (struct TdCallDiscardReason *var);
+void TdDestroyObject (struct TdCallDiscardReason *var);
+void TdStackStorer (struct TdCallDiscardReason *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::callDiscardReasonEmpty> TdConvertToInternal (struct TdCallDiscardReasonEmpty *var);
+struct TdCallDiscardReasonEmpty *TdConvertFromInternal (const td::td_api::callDiscardReasonEmpty &from);
+std::string TdToString (struct TdCallDiscardReasonEmpty *var);
+void TdDestroyObject (struct TdCallDiscardReasonEmpty *var);
+void TdStackStorer (struct TdCallDiscardReasonEmpty *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::callDiscardReasonMissed> TdConvertToInternal (struct TdCallDiscardReasonMissed *var);
+struct TdCallDiscardReasonMissed *TdConvertFromInternal (const td::td_api::callDiscardReasonMissed &from);
+std::string TdToString (struct TdCallDiscardReasonMissed *var);
+void TdDestroyObject (struct TdCallDiscardReasonMissed *var);
+void TdStackStorer (struct TdCallDiscardReasonMissed *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::callDiscardReasonDeclined> TdConvertToInternal (struct TdCallDiscardReasonDeclined *var);
+struct TdCallDiscardReasonDeclined *TdConvertFromInternal (const td::td_api::callDiscardReasonDeclined &from);
+std::string TdToString (struct TdCallDiscardReasonDeclined *var);
+void TdDestroyObject (struct TdCallDiscardReasonDeclined *var);
+void TdStackStorer (struct TdCallDiscardReasonDeclined *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::callDiscardReasonDisconnected> TdConvertToInternal (struct TdCallDiscardReasonDisconnected *var);
+struct TdCallDiscardReasonDisconnected *TdConvertFromInternal (const td::td_api::callDiscardReasonDisconnected &from);
+std::string TdToString (struct TdCallDiscardReasonDisconnected *var);
+void TdDestroyObject (struct TdCallDiscardReasonDisconnected *var);
+void TdStackStorer (struct TdCallDiscardReasonDisconnected *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::callDiscardReasonHungUp> TdConvertToInternal (struct TdCallDiscardReasonHungUp *var);
+struct TdCallDiscardReasonHungUp *TdConvertFromInternal (const td::td_api::callDiscardReasonHungUp &from);
+std::string TdToString (struct TdCallDiscardReasonHungUp *var);
+void TdDestroyObject (struct TdCallDiscardReasonHungUp *var);
+void TdStackStorer (struct TdCallDiscardReasonHungUp *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::callId> TdConvertToInternal (struct TdCallId *var);
+struct TdCallId *TdConvertFromInternal (const td::td_api::callId &from);
+std::string TdToString (struct TdCallId *var);
+void TdDestroyObject (struct TdCallId *var);
+void TdStackStorer (struct TdCallId *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::callProtocol> TdConvertToInternal (struct TdCallProtocol *var);
+struct TdCallProtocol *TdConvertFromInternal (const td::td_api::callProtocol &from);
+std::string TdToString (struct TdCallProtocol *var);
+void TdDestroyObject (struct TdCallProtocol *var);
+void TdStackStorer (struct TdCallProtocol *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::CallState> TdConvertToInternal (struct TdCallState *var);
+struct TdCallState *TdConvertFromInternal (const td::td_api::CallState &from);
+std::string TdToString (struct TdCallState *var);
+void TdDestroyObject (struct TdCallState *var);
+void TdStackStorer (struct TdCallState *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::callStatePending> TdConvertToInternal (struct TdCallStatePending *var);
+struct TdCallStatePending *TdConvertFromInternal (const td::td_api::callStatePending &from);
+std::string TdToString (struct TdCallStatePending *var);
+void TdDestroyObject (struct TdCallStatePending *var);
+void TdStackStorer (struct TdCallStatePending *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::callStateExchangingKeys> TdConvertToInternal (struct TdCallStateExchangingKeys *var);
+struct TdCallStateExchangingKeys *TdConvertFromInternal (const td::td_api::callStateExchangingKeys &from);
+std::string TdToString (struct TdCallStateExchangingKeys *var);
+void TdDestroyObject (struct TdCallStateExchangingKeys *var);
+void TdStackStorer (struct TdCallStateExchangingKeys *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::callStateReady> TdConvertToInternal (struct TdCallStateReady *var);
+struct TdCallStateReady *TdConvertFromInternal (const td::td_api::callStateReady &from);
+std::string TdToString (struct TdCallStateReady *var);
+void TdDestroyObject (struct TdCallStateReady *var);
+void TdStackStorer (struct TdCallStateReady *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::callStateHangingUp> TdConvertToInternal (struct TdCallStateHangingUp *var);
+struct TdCallStateHangingUp *TdConvertFromInternal (const td::td_api::callStateHangingUp &from);
+std::string TdToString (struct TdCallStateHangingUp *var);
+void TdDestroyObject (struct TdCallStateHangingUp *var);
+void TdStackStorer (struct TdCallStateHangingUp *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::callStateDiscarded> TdConvertToInternal (struct TdCallStateDiscarded *var);
+struct TdCallStateDiscarded *TdConvertFromInternal (const td::td_api::callStateDiscarded &from);
+std::string TdToString (struct TdCallStateDiscarded *var);
+void TdDestroyObject (struct TdCallStateDiscarded *var);
+void TdStackStorer (struct TdCallStateDiscarded *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::callStateError> TdConvertToInternal (struct TdCallStateError *var);
+struct TdCallStateError *TdConvertFromInternal (const td::td_api::callStateError &from);
+std::string TdToString (struct TdCallStateError *var);
+void TdDestroyObject (struct TdCallStateError *var);
+void TdStackStorer (struct TdCallStateError *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::callbackQueryAnswer> TdConvertToInternal (struct TdCallbackQueryAnswer *var);
+struct TdCallbackQueryAnswer *TdConvertFromInternal (const td::td_api::callbackQueryAnswer &from);
+std::string TdToString (struct TdCallbackQueryAnswer *var);
+void TdDestroyObject (struct TdCallbackQueryAnswer *var);
+void TdStackStorer (struct TdCallbackQueryAnswer *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::CallbackQueryPayload> TdConvertToInternal (struct TdCallbackQueryPayload *var);
+struct TdCallbackQueryPayload *TdConvertFromInternal (const td::td_api::CallbackQueryPayload &from);
+std::string TdToString (struct TdCallbackQueryPayload *var);
+void TdDestroyObject (struct TdCallbackQueryPayload *var);
+void TdStackStorer (struct TdCallbackQueryPayload *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::callbackQueryPayloadData> TdConvertToInternal (struct TdCallbackQueryPayloadData *var);
+struct TdCallbackQueryPayloadData *TdConvertFromInternal (const td::td_api::callbackQueryPayloadData &from);
+std::string TdToString (struct TdCallbackQueryPayloadData *var);
+void TdDestroyObject (struct TdCallbackQueryPayloadData *var);
+void TdStackStorer (struct TdCallbackQueryPayloadData *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::callbackQueryPayloadGame> TdConvertToInternal (struct TdCallbackQueryPayloadGame *var);
+struct TdCallbackQueryPayloadGame *TdConvertFromInternal (const td::td_api::callbackQueryPayloadGame &from);
+std::string TdToString (struct TdCallbackQueryPayloadGame *var);
+void TdDestroyObject (struct TdCallbackQueryPayloadGame *var);
+void TdStackStorer (struct TdCallbackQueryPayloadGame *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chat> TdConvertToInternal (struct TdChat *var);
+struct TdChat *TdConvertFromInternal (const td::td_api::chat &from);
+std::string TdToString (struct TdChat *var);
+void TdDestroyObject (struct TdChat *var);
+void TdStackStorer (struct TdChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::ChatAction> TdConvertToInternal (struct TdChatAction *var);
+struct TdChatAction *TdConvertFromInternal (const td::td_api::ChatAction &from);
+std::string TdToString (struct TdChatAction *var);
+void TdDestroyObject (struct TdChatAction *var);
+void TdStackStorer (struct TdChatAction *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatActionTyping> TdConvertToInternal (struct TdChatActionTyping *var);
+struct TdChatActionTyping *TdConvertFromInternal (const td::td_api::chatActionTyping &from);
+std::string TdToString (struct TdChatActionTyping *var);
+void TdDestroyObject (struct TdChatActionTyping *var);
+void TdStackStorer (struct TdChatActionTyping *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatActionRecordingVideo> TdConvertToInternal (struct TdChatActionRecordingVideo *var);
+struct TdChatActionRecordingVideo *TdConvertFromInternal (const td::td_api::chatActionRecordingVideo &from);
+std::string TdToString (struct TdChatActionRecordingVideo *var);
+void TdDestroyObject (struct TdChatActionRecordingVideo *var);
+void TdStackStorer (struct TdChatActionRecordingVideo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatActionUploadingVideo> TdConvertToInternal (struct TdChatActionUploadingVideo *var);
+struct TdChatActionUploadingVideo *TdConvertFromInternal (const td::td_api::chatActionUploadingVideo &from);
+std::string TdToString (struct TdChatActionUploadingVideo *var);
+void TdDestroyObject (struct TdChatActionUploadingVideo *var);
+void TdStackStorer (struct TdChatActionUploadingVideo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatActionRecordingVoiceNote> TdConvertToInternal (struct TdChatActionRecordingVoiceNote *var);
+struct TdChatActionRecordingVoiceNote *TdConvertFromInternal (const td::td_api::chatActionRecordingVoiceNote &from);
+std::string TdToString (struct TdChatActionRecordingVoiceNote *var);
+void TdDestroyObject (struct TdChatActionRecordingVoiceNote *var);
+void TdStackStorer (struct TdChatActionRecordingVoiceNote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatActionUploadingVoiceNote> TdConvertToInternal (struct TdChatActionUploadingVoiceNote *var);
+struct TdChatActionUploadingVoiceNote *TdConvertFromInternal (const td::td_api::chatActionUploadingVoiceNote &from);
+std::string TdToString (struct TdChatActionUploadingVoiceNote *var);
+void TdDestroyObject (struct TdChatActionUploadingVoiceNote *var);
+void TdStackStorer (struct TdChatActionUploadingVoiceNote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatActionUploadingPhoto> TdConvertToInternal (struct TdChatActionUploadingPhoto *var);
+struct TdChatActionUploadingPhoto *TdConvertFromInternal (const td::td_api::chatActionUploadingPhoto &from);
+std::string TdToString (struct TdChatActionUploadingPhoto *var);
+void TdDestroyObject (struct TdChatActionUploadingPhoto *var);
+void TdStackStorer (struct TdChatActionUploadingPhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatActionUploadingDocument> TdConvertToInternal (struct TdChatActionUploadingDocument *var);
+struct TdChatActionUploadingDocument *TdConvertFromInternal (const td::td_api::chatActionUploadingDocument &from);
+std::string TdToString (struct TdChatActionUploadingDocument *var);
+void TdDestroyObject (struct TdChatActionUploadingDocument *var);
+void TdStackStorer (struct TdChatActionUploadingDocument *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatActionChoosingLocation> TdConvertToInternal (struct TdChatActionChoosingLocation *var);
+struct TdChatActionChoosingLocation *TdConvertFromInternal (const td::td_api::chatActionChoosingLocation &from);
+std::string TdToString (struct TdChatActionChoosingLocation *var);
+void TdDestroyObject (struct TdChatActionChoosingLocation *var);
+void TdStackStorer (struct TdChatActionChoosingLocation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatActionChoosingContact> TdConvertToInternal (struct TdChatActionChoosingContact *var);
+struct TdChatActionChoosingContact *TdConvertFromInternal (const td::td_api::chatActionChoosingContact &from);
+std::string TdToString (struct TdChatActionChoosingContact *var);
+void TdDestroyObject (struct TdChatActionChoosingContact *var);
+void TdStackStorer (struct TdChatActionChoosingContact *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatActionStartPlayingGame> TdConvertToInternal (struct TdChatActionStartPlayingGame *var);
+struct TdChatActionStartPlayingGame *TdConvertFromInternal (const td::td_api::chatActionStartPlayingGame &from);
+std::string TdToString (struct TdChatActionStartPlayingGame *var);
+void TdDestroyObject (struct TdChatActionStartPlayingGame *var);
+void TdStackStorer (struct TdChatActionStartPlayingGame *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatActionRecordingVideoNote> TdConvertToInternal (struct TdChatActionRecordingVideoNote *var);
+struct TdChatActionRecordingVideoNote *TdConvertFromInternal (const td::td_api::chatActionRecordingVideoNote &from);
+std::string TdToString (struct TdChatActionRecordingVideoNote *var);
+void TdDestroyObject (struct TdChatActionRecordingVideoNote *var);
+void TdStackStorer (struct TdChatActionRecordingVideoNote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatActionUploadingVideoNote> TdConvertToInternal (struct TdChatActionUploadingVideoNote *var);
+struct TdChatActionUploadingVideoNote *TdConvertFromInternal (const td::td_api::chatActionUploadingVideoNote &from);
+std::string TdToString (struct TdChatActionUploadingVideoNote *var);
+void TdDestroyObject (struct TdChatActionUploadingVideoNote *var);
+void TdStackStorer (struct TdChatActionUploadingVideoNote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatActionCancel> TdConvertToInternal (struct TdChatActionCancel *var);
+struct TdChatActionCancel *TdConvertFromInternal (const td::td_api::chatActionCancel &from);
+std::string TdToString (struct TdChatActionCancel *var);
+void TdDestroyObject (struct TdChatActionCancel *var);
+void TdStackStorer (struct TdChatActionCancel *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEvent> TdConvertToInternal (struct TdChatEvent *var);
+struct TdChatEvent *TdConvertFromInternal (const td::td_api::chatEvent &from);
+std::string TdToString (struct TdChatEvent *var);
+void TdDestroyObject (struct TdChatEvent *var);
+void TdStackStorer (struct TdChatEvent *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::ChatEventAction> TdConvertToInternal (struct TdChatEventAction *var);
+struct TdChatEventAction *TdConvertFromInternal (const td::td_api::ChatEventAction &from);
+std::string TdToString (struct TdChatEventAction *var);
+void TdDestroyObject (struct TdChatEventAction *var);
+void TdStackStorer (struct TdChatEventAction *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventMessageEdited> TdConvertToInternal (struct TdChatEventMessageEdited *var);
+struct TdChatEventMessageEdited *TdConvertFromInternal (const td::td_api::chatEventMessageEdited &from);
+std::string TdToString (struct TdChatEventMessageEdited *var);
+void TdDestroyObject (struct TdChatEventMessageEdited *var);
+void TdStackStorer (struct TdChatEventMessageEdited *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventMessageDeleted> TdConvertToInternal (struct TdChatEventMessageDeleted *var);
+struct TdChatEventMessageDeleted *TdConvertFromInternal (const td::td_api::chatEventMessageDeleted &from);
+std::string TdToString (struct TdChatEventMessageDeleted *var);
+void TdDestroyObject (struct TdChatEventMessageDeleted *var);
+void TdStackStorer (struct TdChatEventMessageDeleted *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventMessagePinned> TdConvertToInternal (struct TdChatEventMessagePinned *var);
+struct TdChatEventMessagePinned *TdConvertFromInternal (const td::td_api::chatEventMessagePinned &from);
+std::string TdToString (struct TdChatEventMessagePinned *var);
+void TdDestroyObject (struct TdChatEventMessagePinned *var);
+void TdStackStorer (struct TdChatEventMessagePinned *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventMessageUnpinned> TdConvertToInternal (struct TdChatEventMessageUnpinned *var);
+struct TdChatEventMessageUnpinned *TdConvertFromInternal (const td::td_api::chatEventMessageUnpinned &from);
+std::string TdToString (struct TdChatEventMessageUnpinned *var);
+void TdDestroyObject (struct TdChatEventMessageUnpinned *var);
+void TdStackStorer (struct TdChatEventMessageUnpinned *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventMemberJoined> TdConvertToInternal (struct TdChatEventMemberJoined *var);
+struct TdChatEventMemberJoined *TdConvertFromInternal (const td::td_api::chatEventMemberJoined &from);
+std::string TdToString (struct TdChatEventMemberJoined *var);
+void TdDestroyObject (struct TdChatEventMemberJoined *var);
+void TdStackStorer (struct TdChatEventMemberJoined *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventMemberLeft> TdConvertToInternal (struct TdChatEventMemberLeft *var);
+struct TdChatEventMemberLeft *TdConvertFromInternal (const td::td_api::chatEventMemberLeft &from);
+std::string TdToString (struct TdChatEventMemberLeft *var);
+void TdDestroyObject (struct TdChatEventMemberLeft *var);
+void TdStackStorer (struct TdChatEventMemberLeft *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventMemberInvited> TdConvertToInternal (struct TdChatEventMemberInvited *var);
+struct TdChatEventMemberInvited *TdConvertFromInternal (const td::td_api::chatEventMemberInvited &from);
+std::string TdToString (struct TdChatEventMemberInvited *var);
+void TdDestroyObject (struct TdChatEventMemberInvited *var);
+void TdStackStorer (struct TdChatEventMemberInvited *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventMemberPromoted> TdConvertToInternal (struct TdChatEventMemberPromoted *var);
+struct TdChatEventMemberPromoted *TdConvertFromInternal (const td::td_api::chatEventMemberPromoted &from);
+std::string TdToString (struct TdChatEventMemberPromoted *var);
+void TdDestroyObject (struct TdChatEventMemberPromoted *var);
+void TdStackStorer (struct TdChatEventMemberPromoted *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventMemberRestricted> TdConvertToInternal (struct TdChatEventMemberRestricted *var);
+struct TdChatEventMemberRestricted *TdConvertFromInternal (const td::td_api::chatEventMemberRestricted &from);
+std::string TdToString (struct TdChatEventMemberRestricted *var);
+void TdDestroyObject (struct TdChatEventMemberRestricted *var);
+void TdStackStorer (struct TdChatEventMemberRestricted *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventTitleChanged> TdConvertToInternal (struct TdChatEventTitleChanged *var);
+struct TdChatEventTitleChanged *TdConvertFromInternal (const td::td_api::chatEventTitleChanged &from);
+std::string TdToString (struct TdChatEventTitleChanged *var);
+void TdDestroyObject (struct TdChatEventTitleChanged *var);
+void TdStackStorer (struct TdChatEventTitleChanged *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventDescriptionChanged> TdConvertToInternal (struct TdChatEventDescriptionChanged *var);
+struct TdChatEventDescriptionChanged *TdConvertFromInternal (const td::td_api::chatEventDescriptionChanged &from);
+std::string TdToString (struct TdChatEventDescriptionChanged *var);
+void TdDestroyObject (struct TdChatEventDescriptionChanged *var);
+void TdStackStorer (struct TdChatEventDescriptionChanged *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventUsernameChanged> TdConvertToInternal (struct TdChatEventUsernameChanged *var);
+struct TdChatEventUsernameChanged *TdConvertFromInternal (const td::td_api::chatEventUsernameChanged &from);
+std::string TdToString (struct TdChatEventUsernameChanged *var);
+void TdDestroyObject (struct TdChatEventUsernameChanged *var);
+void TdStackStorer (struct TdChatEventUsernameChanged *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventPhotoChanged> TdConvertToInternal (struct TdChatEventPhotoChanged *var);
+struct TdChatEventPhotoChanged *TdConvertFromInternal (const td::td_api::chatEventPhotoChanged &from);
+std::string TdToString (struct TdChatEventPhotoChanged *var);
+void TdDestroyObject (struct TdChatEventPhotoChanged *var);
+void TdStackStorer (struct TdChatEventPhotoChanged *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventInvitesToggled> TdConvertToInternal (struct TdChatEventInvitesToggled *var);
+struct TdChatEventInvitesToggled *TdConvertFromInternal (const td::td_api::chatEventInvitesToggled &from);
+std::string TdToString (struct TdChatEventInvitesToggled *var);
+void TdDestroyObject (struct TdChatEventInvitesToggled *var);
+void TdStackStorer (struct TdChatEventInvitesToggled *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventSignMessagesToggled> TdConvertToInternal (struct TdChatEventSignMessagesToggled *var);
+struct TdChatEventSignMessagesToggled *TdConvertFromInternal (const td::td_api::chatEventSignMessagesToggled &from);
+std::string TdToString (struct TdChatEventSignMessagesToggled *var);
+void TdDestroyObject (struct TdChatEventSignMessagesToggled *var);
+void TdStackStorer (struct TdChatEventSignMessagesToggled *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventStickerSetChanged> TdConvertToInternal (struct TdChatEventStickerSetChanged *var);
+struct TdChatEventStickerSetChanged *TdConvertFromInternal (const td::td_api::chatEventStickerSetChanged &from);
+std::string TdToString (struct TdChatEventStickerSetChanged *var);
+void TdDestroyObject (struct TdChatEventStickerSetChanged *var);
+void TdStackStorer (struct TdChatEventStickerSetChanged *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventIsAllHistoryAvailableToggled> TdConvertToInternal (struct TdChatEventIsAllHistoryAvailableToggled *var);
+struct TdChatEventIsAllHistoryAvailableToggled *TdConvertFromInternal (const td::td_api::chatEventIsAllHistoryAvailableToggled &from);
+std::string TdToString (struct TdChatEventIsAllHistoryAvailableToggled *var);
+void TdDestroyObject (struct TdChatEventIsAllHistoryAvailableToggled *var);
+void TdStackStorer (struct TdChatEventIsAllHistoryAvailableToggled *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEventLogFilters> TdConvertToInternal (struct TdChatEventLogFilters *var);
+struct TdChatEventLogFilters *TdConvertFromInternal (const td::td_api::chatEventLogFilters &from);
+std::string TdToString (struct TdChatEventLogFilters *var);
+void TdDestroyObject (struct TdChatEventLogFilters *var);
+void TdStackStorer (struct TdChatEventLogFilters *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatEvents> TdConvertToInternal (struct TdChatEvents *var);
+struct TdChatEvents *TdConvertFromInternal (const td::td_api::chatEvents &from);
+std::string TdToString (struct TdChatEvents *var);
+void TdDestroyObject (struct TdChatEvents *var);
+void TdStackStorer (struct TdChatEvents *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatInviteLink> TdConvertToInternal (struct TdChatInviteLink *var);
+struct TdChatInviteLink *TdConvertFromInternal (const td::td_api::chatInviteLink &from);
+std::string TdToString (struct TdChatInviteLink *var);
+void TdDestroyObject (struct TdChatInviteLink *var);
+void TdStackStorer (struct TdChatInviteLink *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatInviteLinkInfo> TdConvertToInternal (struct TdChatInviteLinkInfo *var);
+struct TdChatInviteLinkInfo *TdConvertFromInternal (const td::td_api::chatInviteLinkInfo &from);
+std::string TdToString (struct TdChatInviteLinkInfo *var);
+void TdDestroyObject (struct TdChatInviteLinkInfo *var);
+void TdStackStorer (struct TdChatInviteLinkInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatMember> TdConvertToInternal (struct TdChatMember *var);
+struct TdChatMember *TdConvertFromInternal (const td::td_api::chatMember &from);
+std::string TdToString (struct TdChatMember *var);
+void TdDestroyObject (struct TdChatMember *var);
+void TdStackStorer (struct TdChatMember *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::ChatMemberStatus> TdConvertToInternal (struct TdChatMemberStatus *var);
+struct TdChatMemberStatus *TdConvertFromInternal (const td::td_api::ChatMemberStatus &from);
+std::string TdToString (struct TdChatMemberStatus *var);
+void TdDestroyObject (struct TdChatMemberStatus *var);
+void TdStackStorer (struct TdChatMemberStatus *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatMemberStatusCreator> TdConvertToInternal (struct TdChatMemberStatusCreator *var);
+struct TdChatMemberStatusCreator *TdConvertFromInternal (const td::td_api::chatMemberStatusCreator &from);
+std::string TdToString (struct TdChatMemberStatusCreator *var);
+void TdDestroyObject (struct TdChatMemberStatusCreator *var);
+void TdStackStorer (struct TdChatMemberStatusCreator *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatMemberStatusAdministrator> TdConvertToInternal (struct TdChatMemberStatusAdministrator *var);
+struct TdChatMemberStatusAdministrator *TdConvertFromInternal (const td::td_api::chatMemberStatusAdministrator &from);
+std::string TdToString (struct TdChatMemberStatusAdministrator *var);
+void TdDestroyObject (struct TdChatMemberStatusAdministrator *var);
+void TdStackStorer (struct TdChatMemberStatusAdministrator *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatMemberStatusMember> TdConvertToInternal (struct TdChatMemberStatusMember *var);
+struct TdChatMemberStatusMember *TdConvertFromInternal (const td::td_api::chatMemberStatusMember &from);
+std::string TdToString (struct TdChatMemberStatusMember *var);
+void TdDestroyObject (struct TdChatMemberStatusMember *var);
+void TdStackStorer (struct TdChatMemberStatusMember *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatMemberStatusRestricted> TdConvertToInternal (struct TdChatMemberStatusRestricted *var);
+struct TdChatMemberStatusRestricted *TdConvertFromInternal (const td::td_api::chatMemberStatusRestricted &from);
+std::string TdToString (struct TdChatMemberStatusRestricted *var);
+void TdDestroyObject (struct TdChatMemberStatusRestricted *var);
+void TdStackStorer (struct TdChatMemberStatusRestricted *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatMemberStatusLeft> TdConvertToInternal (struct TdChatMemberStatusLeft *var);
+struct TdChatMemberStatusLeft *TdConvertFromInternal (const td::td_api::chatMemberStatusLeft &from);
+std::string TdToString (struct TdChatMemberStatusLeft *var);
+void TdDestroyObject (struct TdChatMemberStatusLeft *var);
+void TdStackStorer (struct TdChatMemberStatusLeft *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatMemberStatusBanned> TdConvertToInternal (struct TdChatMemberStatusBanned *var);
+struct TdChatMemberStatusBanned *TdConvertFromInternal (const td::td_api::chatMemberStatusBanned &from);
+std::string TdToString (struct TdChatMemberStatusBanned *var);
+void TdDestroyObject (struct TdChatMemberStatusBanned *var);
+void TdStackStorer (struct TdChatMemberStatusBanned *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatMembers> TdConvertToInternal (struct TdChatMembers *var);
+struct TdChatMembers *TdConvertFromInternal (const td::td_api::chatMembers &from);
+std::string TdToString (struct TdChatMembers *var);
+void TdDestroyObject (struct TdChatMembers *var);
+void TdStackStorer (struct TdChatMembers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatPhoto> TdConvertToInternal (struct TdChatPhoto *var);
+struct TdChatPhoto *TdConvertFromInternal (const td::td_api::chatPhoto &from);
+std::string TdToString (struct TdChatPhoto *var);
+void TdDestroyObject (struct TdChatPhoto *var);
+void TdStackStorer (struct TdChatPhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::ChatReportReason> TdConvertToInternal (struct TdChatReportReason *var);
+struct TdChatReportReason *TdConvertFromInternal (const td::td_api::ChatReportReason &from);
+std::string TdToString (struct TdChatReportReason *var);
+void TdDestroyObject (struct TdChatReportReason *var);
+void TdStackStorer (struct TdChatReportReason *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatReportReasonSpam> TdConvertToInternal (struct TdChatReportReasonSpam *var);
+struct TdChatReportReasonSpam *TdConvertFromInternal (const td::td_api::chatReportReasonSpam &from);
+std::string TdToString (struct TdChatReportReasonSpam *var);
+void TdDestroyObject (struct TdChatReportReasonSpam *var);
+void TdStackStorer (struct TdChatReportReasonSpam *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatReportReasonViolence> TdConvertToInternal (struct TdChatReportReasonViolence *var);
+struct TdChatReportReasonViolence *TdConvertFromInternal (const td::td_api::chatReportReasonViolence &from);
+std::string TdToString (struct TdChatReportReasonViolence *var);
+void TdDestroyObject (struct TdChatReportReasonViolence *var);
+void TdStackStorer (struct TdChatReportReasonViolence *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatReportReasonPornography> TdConvertToInternal (struct TdChatReportReasonPornography *var);
+struct TdChatReportReasonPornography *TdConvertFromInternal (const td::td_api::chatReportReasonPornography &from);
+std::string TdToString (struct TdChatReportReasonPornography *var);
+void TdDestroyObject (struct TdChatReportReasonPornography *var);
+void TdStackStorer (struct TdChatReportReasonPornography *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatReportReasonCustom> TdConvertToInternal (struct TdChatReportReasonCustom *var);
+struct TdChatReportReasonCustom *TdConvertFromInternal (const td::td_api::chatReportReasonCustom &from);
+std::string TdToString (struct TdChatReportReasonCustom *var);
+void TdDestroyObject (struct TdChatReportReasonCustom *var);
+void TdStackStorer (struct TdChatReportReasonCustom *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatReportSpamState> TdConvertToInternal (struct TdChatReportSpamState *var);
+struct TdChatReportSpamState *TdConvertFromInternal (const td::td_api::chatReportSpamState &from);
+std::string TdToString (struct TdChatReportSpamState *var);
+void TdDestroyObject (struct TdChatReportSpamState *var);
+void TdStackStorer (struct TdChatReportSpamState *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::ChatType> TdConvertToInternal (struct TdChatType *var);
+struct TdChatType *TdConvertFromInternal (const td::td_api::ChatType &from);
+std::string TdToString (struct TdChatType *var);
+void TdDestroyObject (struct TdChatType *var);
+void TdStackStorer (struct TdChatType *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatTypePrivate> TdConvertToInternal (struct TdChatTypePrivate *var);
+struct TdChatTypePrivate *TdConvertFromInternal (const td::td_api::chatTypePrivate &from);
+std::string TdToString (struct TdChatTypePrivate *var);
+void TdDestroyObject (struct TdChatTypePrivate *var);
+void TdStackStorer (struct TdChatTypePrivate *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatTypeBasicGroup> TdConvertToInternal (struct TdChatTypeBasicGroup *var);
+struct TdChatTypeBasicGroup *TdConvertFromInternal (const td::td_api::chatTypeBasicGroup &from);
+std::string TdToString (struct TdChatTypeBasicGroup *var);
+void TdDestroyObject (struct TdChatTypeBasicGroup *var);
+void TdStackStorer (struct TdChatTypeBasicGroup *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatTypeSupergroup> TdConvertToInternal (struct TdChatTypeSupergroup *var);
+struct TdChatTypeSupergroup *TdConvertFromInternal (const td::td_api::chatTypeSupergroup &from);
+std::string TdToString (struct TdChatTypeSupergroup *var);
+void TdDestroyObject (struct TdChatTypeSupergroup *var);
+void TdStackStorer (struct TdChatTypeSupergroup *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chatTypeSecret> TdConvertToInternal (struct TdChatTypeSecret *var);
+struct TdChatTypeSecret *TdConvertFromInternal (const td::td_api::chatTypeSecret &from);
+std::string TdToString (struct TdChatTypeSecret *var);
+void TdDestroyObject (struct TdChatTypeSecret *var);
+void TdStackStorer (struct TdChatTypeSecret *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::chats> TdConvertToInternal (struct TdChats *var);
+struct TdChats *TdConvertFromInternal (const td::td_api::chats &from);
+std::string TdToString (struct TdChats *var);
+void TdDestroyObject (struct TdChats *var);
+void TdStackStorer (struct TdChats *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::ConnectionState> TdConvertToInternal (struct TdConnectionState *var);
+struct TdConnectionState *TdConvertFromInternal (const td::td_api::ConnectionState &from);
+std::string TdToString (struct TdConnectionState *var);
+void TdDestroyObject (struct TdConnectionState *var);
+void TdStackStorer (struct TdConnectionState *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::connectionStateWaitingForNetwork> TdConvertToInternal (struct TdConnectionStateWaitingForNetwork *var);
+struct TdConnectionStateWaitingForNetwork *TdConvertFromInternal (const td::td_api::connectionStateWaitingForNetwork &from);
+std::string TdToString (struct TdConnectionStateWaitingForNetwork *var);
+void TdDestroyObject (struct TdConnectionStateWaitingForNetwork *var);
+void TdStackStorer (struct TdConnectionStateWaitingForNetwork *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::connectionStateConnectingToProxy> TdConvertToInternal (struct TdConnectionStateConnectingToProxy *var);
+struct TdConnectionStateConnectingToProxy *TdConvertFromInternal (const td::td_api::connectionStateConnectingToProxy &from);
+std::string TdToString (struct TdConnectionStateConnectingToProxy *var);
+void TdDestroyObject (struct TdConnectionStateConnectingToProxy *var);
+void TdStackStorer (struct TdConnectionStateConnectingToProxy *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::connectionStateConnecting> TdConvertToInternal (struct TdConnectionStateConnecting *var);
+struct TdConnectionStateConnecting *TdConvertFromInternal (const td::td_api::connectionStateConnecting &from);
+std::string TdToString (struct TdConnectionStateConnecting *var);
+void TdDestroyObject (struct TdConnectionStateConnecting *var);
+void TdStackStorer (struct TdConnectionStateConnecting *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::connectionStateUpdating> TdConvertToInternal (struct TdConnectionStateUpdating *var);
+struct TdConnectionStateUpdating *TdConvertFromInternal (const td::td_api::connectionStateUpdating &from);
+std::string TdToString (struct TdConnectionStateUpdating *var);
+void TdDestroyObject (struct TdConnectionStateUpdating *var);
+void TdStackStorer (struct TdConnectionStateUpdating *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::connectionStateReady> TdConvertToInternal (struct TdConnectionStateReady *var);
+struct TdConnectionStateReady *TdConvertFromInternal (const td::td_api::connectionStateReady &from);
+std::string TdToString (struct TdConnectionStateReady *var);
+void TdDestroyObject (struct TdConnectionStateReady *var);
+void TdStackStorer (struct TdConnectionStateReady *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::contact> TdConvertToInternal (struct TdContact *var);
+struct TdContact *TdConvertFromInternal (const td::td_api::contact &from);
+std::string TdToString (struct TdContact *var);
+void TdDestroyObject (struct TdContact *var);
+void TdStackStorer (struct TdContact *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::count> TdConvertToInternal (struct TdCount *var);
+struct TdCount *TdConvertFromInternal (const td::td_api::count &from);
+std::string TdToString (struct TdCount *var);
+void TdDestroyObject (struct TdCount *var);
+void TdStackStorer (struct TdCount *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::customRequestResult> TdConvertToInternal (struct TdCustomRequestResult *var);
+struct TdCustomRequestResult *TdConvertFromInternal (const td::td_api::customRequestResult &from);
+std::string TdToString (struct TdCustomRequestResult *var);
+void TdDestroyObject (struct TdCustomRequestResult *var);
+void TdStackStorer (struct TdCustomRequestResult *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::databaseStatistics> TdConvertToInternal (struct TdDatabaseStatistics *var);
+struct TdDatabaseStatistics *TdConvertFromInternal (const td::td_api::databaseStatistics &from);
+std::string TdToString (struct TdDatabaseStatistics *var);
+void TdDestroyObject (struct TdDatabaseStatistics *var);
+void TdStackStorer (struct TdDatabaseStatistics *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::DeviceToken> TdConvertToInternal (struct TdDeviceToken *var);
+struct TdDeviceToken *TdConvertFromInternal (const td::td_api::DeviceToken &from);
+std::string TdToString (struct TdDeviceToken *var);
+void TdDestroyObject (struct TdDeviceToken *var);
+void TdStackStorer (struct TdDeviceToken *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deviceTokenGoogleCloudMessaging> TdConvertToInternal (struct TdDeviceTokenGoogleCloudMessaging *var);
+struct TdDeviceTokenGoogleCloudMessaging *TdConvertFromInternal (const td::td_api::deviceTokenGoogleCloudMessaging &from);
+std::string TdToString (struct TdDeviceTokenGoogleCloudMessaging *var);
+void TdDestroyObject (struct TdDeviceTokenGoogleCloudMessaging *var);
+void TdStackStorer (struct TdDeviceTokenGoogleCloudMessaging *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deviceTokenApplePush> TdConvertToInternal (struct TdDeviceTokenApplePush *var);
+struct TdDeviceTokenApplePush *TdConvertFromInternal (const td::td_api::deviceTokenApplePush &from);
+std::string TdToString (struct TdDeviceTokenApplePush *var);
+void TdDestroyObject (struct TdDeviceTokenApplePush *var);
+void TdStackStorer (struct TdDeviceTokenApplePush *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deviceTokenApplePushVoIP> TdConvertToInternal (struct TdDeviceTokenApplePushVoIP *var);
+struct TdDeviceTokenApplePushVoIP *TdConvertFromInternal (const td::td_api::deviceTokenApplePushVoIP &from);
+std::string TdToString (struct TdDeviceTokenApplePushVoIP *var);
+void TdDestroyObject (struct TdDeviceTokenApplePushVoIP *var);
+void TdStackStorer (struct TdDeviceTokenApplePushVoIP *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deviceTokenWindowsPush> TdConvertToInternal (struct TdDeviceTokenWindowsPush *var);
+struct TdDeviceTokenWindowsPush *TdConvertFromInternal (const td::td_api::deviceTokenWindowsPush &from);
+std::string TdToString (struct TdDeviceTokenWindowsPush *var);
+void TdDestroyObject (struct TdDeviceTokenWindowsPush *var);
+void TdStackStorer (struct TdDeviceTokenWindowsPush *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deviceTokenMicrosoftPush> TdConvertToInternal (struct TdDeviceTokenMicrosoftPush *var);
+struct TdDeviceTokenMicrosoftPush *TdConvertFromInternal (const td::td_api::deviceTokenMicrosoftPush &from);
+std::string TdToString (struct TdDeviceTokenMicrosoftPush *var);
+void TdDestroyObject (struct TdDeviceTokenMicrosoftPush *var);
+void TdStackStorer (struct TdDeviceTokenMicrosoftPush *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deviceTokenMicrosoftPushVoIP> TdConvertToInternal (struct TdDeviceTokenMicrosoftPushVoIP *var);
+struct TdDeviceTokenMicrosoftPushVoIP *TdConvertFromInternal (const td::td_api::deviceTokenMicrosoftPushVoIP &from);
+std::string TdToString (struct TdDeviceTokenMicrosoftPushVoIP *var);
+void TdDestroyObject (struct TdDeviceTokenMicrosoftPushVoIP *var);
+void TdStackStorer (struct TdDeviceTokenMicrosoftPushVoIP *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deviceTokenWebPush> TdConvertToInternal (struct TdDeviceTokenWebPush *var);
+struct TdDeviceTokenWebPush *TdConvertFromInternal (const td::td_api::deviceTokenWebPush &from);
+std::string TdToString (struct TdDeviceTokenWebPush *var);
+void TdDestroyObject (struct TdDeviceTokenWebPush *var);
+void TdStackStorer (struct TdDeviceTokenWebPush *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deviceTokenSimplePush> TdConvertToInternal (struct TdDeviceTokenSimplePush *var);
+struct TdDeviceTokenSimplePush *TdConvertFromInternal (const td::td_api::deviceTokenSimplePush &from);
+std::string TdToString (struct TdDeviceTokenSimplePush *var);
+void TdDestroyObject (struct TdDeviceTokenSimplePush *var);
+void TdStackStorer (struct TdDeviceTokenSimplePush *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deviceTokenUbuntuPush> TdConvertToInternal (struct TdDeviceTokenUbuntuPush *var);
+struct TdDeviceTokenUbuntuPush *TdConvertFromInternal (const td::td_api::deviceTokenUbuntuPush &from);
+std::string TdToString (struct TdDeviceTokenUbuntuPush *var);
+void TdDestroyObject (struct TdDeviceTokenUbuntuPush *var);
+void TdStackStorer (struct TdDeviceTokenUbuntuPush *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deviceTokenBlackberryPush> TdConvertToInternal (struct TdDeviceTokenBlackberryPush *var);
+struct TdDeviceTokenBlackberryPush *TdConvertFromInternal (const td::td_api::deviceTokenBlackberryPush &from);
+std::string TdToString (struct TdDeviceTokenBlackberryPush *var);
+void TdDestroyObject (struct TdDeviceTokenBlackberryPush *var);
+void TdStackStorer (struct TdDeviceTokenBlackberryPush *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deviceTokenTizenPush> TdConvertToInternal (struct TdDeviceTokenTizenPush *var);
+struct TdDeviceTokenTizenPush *TdConvertFromInternal (const td::td_api::deviceTokenTizenPush &from);
+std::string TdToString (struct TdDeviceTokenTizenPush *var);
+void TdDestroyObject (struct TdDeviceTokenTizenPush *var);
+void TdStackStorer (struct TdDeviceTokenTizenPush *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::document> TdConvertToInternal (struct TdDocument *var);
+struct TdDocument *TdConvertFromInternal (const td::td_api::document &from);
+std::string TdToString (struct TdDocument *var);
+void TdDestroyObject (struct TdDocument *var);
+void TdStackStorer (struct TdDocument *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::draftMessage> TdConvertToInternal (struct TdDraftMessage *var);
+struct TdDraftMessage *TdConvertFromInternal (const td::td_api::draftMessage &from);
+std::string TdToString (struct TdDraftMessage *var);
+void TdDestroyObject (struct TdDraftMessage *var);
+void TdStackStorer (struct TdDraftMessage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::error> TdConvertToInternal (struct TdError *var);
+struct TdError *TdConvertFromInternal (const td::td_api::error &from);
+std::string TdToString (struct TdError *var);
+void TdDestroyObject (struct TdError *var);
+void TdStackStorer (struct TdError *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::file> TdConvertToInternal (struct TdFile *var);
+struct TdFile *TdConvertFromInternal (const td::td_api::file &from);
+std::string TdToString (struct TdFile *var);
+void TdDestroyObject (struct TdFile *var);
+void TdStackStorer (struct TdFile *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::FileType> TdConvertToInternal (struct TdFileType *var);
+struct TdFileType *TdConvertFromInternal (const td::td_api::FileType &from);
+std::string TdToString (struct TdFileType *var);
+void TdDestroyObject (struct TdFileType *var);
+void TdStackStorer (struct TdFileType *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::fileTypeNone> TdConvertToInternal (struct TdFileTypeNone *var);
+struct TdFileTypeNone *TdConvertFromInternal (const td::td_api::fileTypeNone &from);
+std::string TdToString (struct TdFileTypeNone *var);
+void TdDestroyObject (struct TdFileTypeNone *var);
+void TdStackStorer (struct TdFileTypeNone *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::fileTypeAnimation> TdConvertToInternal (struct TdFileTypeAnimation *var);
+struct TdFileTypeAnimation *TdConvertFromInternal (const td::td_api::fileTypeAnimation &from);
+std::string TdToString (struct TdFileTypeAnimation *var);
+void TdDestroyObject (struct TdFileTypeAnimation *var);
+void TdStackStorer (struct TdFileTypeAnimation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::fileTypeAudio> TdConvertToInternal (struct TdFileTypeAudio *var);
+struct TdFileTypeAudio *TdConvertFromInternal (const td::td_api::fileTypeAudio &from);
+std::string TdToString (struct TdFileTypeAudio *var);
+void TdDestroyObject (struct TdFileTypeAudio *var);
+void TdStackStorer (struct TdFileTypeAudio *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::fileTypeDocument> TdConvertToInternal (struct TdFileTypeDocument *var);
+struct TdFileTypeDocument *TdConvertFromInternal (const td::td_api::fileTypeDocument &from);
+std::string TdToString (struct TdFileTypeDocument *var);
+void TdDestroyObject (struct TdFileTypeDocument *var);
+void TdStackStorer (struct TdFileTypeDocument *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::fileTypePhoto> TdConvertToInternal (struct TdFileTypePhoto *var);
+struct TdFileTypePhoto *TdConvertFromInternal (const td::td_api::fileTypePhoto &from);
+std::string TdToString (struct TdFileTypePhoto *var);
+void TdDestroyObject (struct TdFileTypePhoto *var);
+void TdStackStorer (struct TdFileTypePhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::fileTypeProfilePhoto> TdConvertToInternal (struct TdFileTypeProfilePhoto *var);
+struct TdFileTypeProfilePhoto *TdConvertFromInternal (const td::td_api::fileTypeProfilePhoto &from);
+std::string TdToString (struct TdFileTypeProfilePhoto *var);
+void TdDestroyObject (struct TdFileTypeProfilePhoto *var);
+void TdStackStorer (struct TdFileTypeProfilePhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::fileTypeSecret> TdConvertToInternal (struct TdFileTypeSecret *var);
+struct TdFileTypeSecret *TdConvertFromInternal (const td::td_api::fileTypeSecret &from);
+std::string TdToString (struct TdFileTypeSecret *var);
+void TdDestroyObject (struct TdFileTypeSecret *var);
+void TdStackStorer (struct TdFileTypeSecret *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::fileTypeSticker> TdConvertToInternal (struct TdFileTypeSticker *var);
+struct TdFileTypeSticker *TdConvertFromInternal (const td::td_api::fileTypeSticker &from);
+std::string TdToString (struct TdFileTypeSticker *var);
+void TdDestroyObject (struct TdFileTypeSticker *var);
+void TdStackStorer (struct TdFileTypeSticker *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::fileTypeThumbnail> TdConvertToInternal (struct TdFileTypeThumbnail *var);
+struct TdFileTypeThumbnail *TdConvertFromInternal (const td::td_api::fileTypeThumbnail &from);
+std::string TdToString (struct TdFileTypeThumbnail *var);
+void TdDestroyObject (struct TdFileTypeThumbnail *var);
+void TdStackStorer (struct TdFileTypeThumbnail *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::fileTypeUnknown> TdConvertToInternal (struct TdFileTypeUnknown *var);
+struct TdFileTypeUnknown *TdConvertFromInternal (const td::td_api::fileTypeUnknown &from);
+std::string TdToString (struct TdFileTypeUnknown *var);
+void TdDestroyObject (struct TdFileTypeUnknown *var);
+void TdStackStorer (struct TdFileTypeUnknown *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::fileTypeVideo> TdConvertToInternal (struct TdFileTypeVideo *var);
+struct TdFileTypeVideo *TdConvertFromInternal (const td::td_api::fileTypeVideo &from);
+std::string TdToString (struct TdFileTypeVideo *var);
+void TdDestroyObject (struct TdFileTypeVideo *var);
+void TdStackStorer (struct TdFileTypeVideo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::fileTypeVideoNote> TdConvertToInternal (struct TdFileTypeVideoNote *var);
+struct TdFileTypeVideoNote *TdConvertFromInternal (const td::td_api::fileTypeVideoNote &from);
+std::string TdToString (struct TdFileTypeVideoNote *var);
+void TdDestroyObject (struct TdFileTypeVideoNote *var);
+void TdStackStorer (struct TdFileTypeVideoNote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::fileTypeVoiceNote> TdConvertToInternal (struct TdFileTypeVoiceNote *var);
+struct TdFileTypeVoiceNote *TdConvertFromInternal (const td::td_api::fileTypeVoiceNote &from);
+std::string TdToString (struct TdFileTypeVoiceNote *var);
+void TdDestroyObject (struct TdFileTypeVoiceNote *var);
+void TdStackStorer (struct TdFileTypeVoiceNote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::fileTypeWallpaper> TdConvertToInternal (struct TdFileTypeWallpaper *var);
+struct TdFileTypeWallpaper *TdConvertFromInternal (const td::td_api::fileTypeWallpaper &from);
+std::string TdToString (struct TdFileTypeWallpaper *var);
+void TdDestroyObject (struct TdFileTypeWallpaper *var);
+void TdStackStorer (struct TdFileTypeWallpaper *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::fileTypeSecretThumbnail> TdConvertToInternal (struct TdFileTypeSecretThumbnail *var);
+struct TdFileTypeSecretThumbnail *TdConvertFromInternal (const td::td_api::fileTypeSecretThumbnail &from);
+std::string TdToString (struct TdFileTypeSecretThumbnail *var);
+void TdDestroyObject (struct TdFileTypeSecretThumbnail *var);
+void TdStackStorer (struct TdFileTypeSecretThumbnail *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::formattedText> TdConvertToInternal (struct TdFormattedText *var);
+struct TdFormattedText *TdConvertFromInternal (const td::td_api::formattedText &from);
+std::string TdToString (struct TdFormattedText *var);
+void TdDestroyObject (struct TdFormattedText *var);
+void TdStackStorer (struct TdFormattedText *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::foundMessages> TdConvertToInternal (struct TdFoundMessages *var);
+struct TdFoundMessages *TdConvertFromInternal (const td::td_api::foundMessages &from);
+std::string TdToString (struct TdFoundMessages *var);
+void TdDestroyObject (struct TdFoundMessages *var);
+void TdStackStorer (struct TdFoundMessages *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::game> TdConvertToInternal (struct TdGame *var);
+struct TdGame *TdConvertFromInternal (const td::td_api::game &from);
+std::string TdToString (struct TdGame *var);
+void TdDestroyObject (struct TdGame *var);
+void TdStackStorer (struct TdGame *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::gameHighScore> TdConvertToInternal (struct TdGameHighScore *var);
+struct TdGameHighScore *TdConvertFromInternal (const td::td_api::gameHighScore &from);
+std::string TdToString (struct TdGameHighScore *var);
+void TdDestroyObject (struct TdGameHighScore *var);
+void TdStackStorer (struct TdGameHighScore *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::gameHighScores> TdConvertToInternal (struct TdGameHighScores *var);
+struct TdGameHighScores *TdConvertFromInternal (const td::td_api::gameHighScores &from);
+std::string TdToString (struct TdGameHighScores *var);
+void TdDestroyObject (struct TdGameHighScores *var);
+void TdStackStorer (struct TdGameHighScores *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::hashtags> TdConvertToInternal (struct TdHashtags *var);
+struct TdHashtags *TdConvertFromInternal (const td::td_api::hashtags &from);
+std::string TdToString (struct TdHashtags *var);
+void TdDestroyObject (struct TdHashtags *var);
+void TdStackStorer (struct TdHashtags *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::importedContacts> TdConvertToInternal (struct TdImportedContacts *var);
+struct TdImportedContacts *TdConvertFromInternal (const td::td_api::importedContacts &from);
+std::string TdToString (struct TdImportedContacts *var);
+void TdDestroyObject (struct TdImportedContacts *var);
+void TdStackStorer (struct TdImportedContacts *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineKeyboardButton> TdConvertToInternal (struct TdInlineKeyboardButton *var);
+struct TdInlineKeyboardButton *TdConvertFromInternal (const td::td_api::inlineKeyboardButton &from);
+std::string TdToString (struct TdInlineKeyboardButton *var);
+void TdDestroyObject (struct TdInlineKeyboardButton *var);
+void TdStackStorer (struct TdInlineKeyboardButton *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::InlineKeyboardButtonType> TdConvertToInternal (struct TdInlineKeyboardButtonType *var);
+struct TdInlineKeyboardButtonType *TdConvertFromInternal (const td::td_api::InlineKeyboardButtonType &from);
+std::string TdToString (struct TdInlineKeyboardButtonType *var);
+void TdDestroyObject (struct TdInlineKeyboardButtonType *var);
+void TdStackStorer (struct TdInlineKeyboardButtonType *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineKeyboardButtonTypeUrl> TdConvertToInternal (struct TdInlineKeyboardButtonTypeUrl *var);
+struct TdInlineKeyboardButtonTypeUrl *TdConvertFromInternal (const td::td_api::inlineKeyboardButtonTypeUrl &from);
+std::string TdToString (struct TdInlineKeyboardButtonTypeUrl *var);
+void TdDestroyObject (struct TdInlineKeyboardButtonTypeUrl *var);
+void TdStackStorer (struct TdInlineKeyboardButtonTypeUrl *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineKeyboardButtonTypeCallback> TdConvertToInternal (struct TdInlineKeyboardButtonTypeCallback *var);
+struct TdInlineKeyboardButtonTypeCallback *TdConvertFromInternal (const td::td_api::inlineKeyboardButtonTypeCallback &from);
+std::string TdToString (struct TdInlineKeyboardButtonTypeCallback *var);
+void TdDestroyObject (struct TdInlineKeyboardButtonTypeCallback *var);
+void TdStackStorer (struct TdInlineKeyboardButtonTypeCallback *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineKeyboardButtonTypeCallbackGame> TdConvertToInternal (struct TdInlineKeyboardButtonTypeCallbackGame *var);
+struct TdInlineKeyboardButtonTypeCallbackGame *TdConvertFromInternal (const td::td_api::inlineKeyboardButtonTypeCallbackGame &from);
+std::string TdToString (struct TdInlineKeyboardButtonTypeCallbackGame *var);
+void TdDestroyObject (struct TdInlineKeyboardButtonTypeCallbackGame *var);
+void TdStackStorer (struct TdInlineKeyboardButtonTypeCallbackGame *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineKeyboardButtonTypeSwitchInline> TdConvertToInternal (struct TdInlineKeyboardButtonTypeSwitchInline *var);
+struct TdInlineKeyboardButtonTypeSwitchInline *TdConvertFromInternal (const td::td_api::inlineKeyboardButtonTypeSwitchInline &from);
+std::string TdToString (struct TdInlineKeyboardButtonTypeSwitchInline *var);
+void TdDestroyObject (struct TdInlineKeyboardButtonTypeSwitchInline *var);
+void TdStackStorer (struct TdInlineKeyboardButtonTypeSwitchInline *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineKeyboardButtonTypeBuy> TdConvertToInternal (struct TdInlineKeyboardButtonTypeBuy *var);
+struct TdInlineKeyboardButtonTypeBuy *TdConvertFromInternal (const td::td_api::inlineKeyboardButtonTypeBuy &from);
+std::string TdToString (struct TdInlineKeyboardButtonTypeBuy *var);
+void TdDestroyObject (struct TdInlineKeyboardButtonTypeBuy *var);
+void TdStackStorer (struct TdInlineKeyboardButtonTypeBuy *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::InlineQueryResult> TdConvertToInternal (struct TdInlineQueryResult *var);
+struct TdInlineQueryResult *TdConvertFromInternal (const td::td_api::InlineQueryResult &from);
+std::string TdToString (struct TdInlineQueryResult *var);
+void TdDestroyObject (struct TdInlineQueryResult *var);
+void TdStackStorer (struct TdInlineQueryResult *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineQueryResultArticle> TdConvertToInternal (struct TdInlineQueryResultArticle *var);
+struct TdInlineQueryResultArticle *TdConvertFromInternal (const td::td_api::inlineQueryResultArticle &from);
+std::string TdToString (struct TdInlineQueryResultArticle *var);
+void TdDestroyObject (struct TdInlineQueryResultArticle *var);
+void TdStackStorer (struct TdInlineQueryResultArticle *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineQueryResultContact> TdConvertToInternal (struct TdInlineQueryResultContact *var);
+struct TdInlineQueryResultContact *TdConvertFromInternal (const td::td_api::inlineQueryResultContact &from);
+std::string TdToString (struct TdInlineQueryResultContact *var);
+void TdDestroyObject (struct TdInlineQueryResultContact *var);
+void TdStackStorer (struct TdInlineQueryResultContact *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineQueryResultLocation> TdConvertToInternal (struct TdInlineQueryResultLocation *var);
+struct TdInlineQueryResultLocation *TdConvertFromInternal (const td::td_api::inlineQueryResultLocation &from);
+std::string TdToString (struct TdInlineQueryResultLocation *var);
+void TdDestroyObject (struct TdInlineQueryResultLocation *var);
+void TdStackStorer (struct TdInlineQueryResultLocation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineQueryResultVenue> TdConvertToInternal (struct TdInlineQueryResultVenue *var);
+struct TdInlineQueryResultVenue *TdConvertFromInternal (const td::td_api::inlineQueryResultVenue &from);
+std::string TdToString (struct TdInlineQueryResultVenue *var);
+void TdDestroyObject (struct TdInlineQueryResultVenue *var);
+void TdStackStorer (struct TdInlineQueryResultVenue *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineQueryResultGame> TdConvertToInternal (struct TdInlineQueryResultGame *var);
+struct TdInlineQueryResultGame *TdConvertFromInternal (const td::td_api::inlineQueryResultGame &from);
+std::string TdToString (struct TdInlineQueryResultGame *var);
+void TdDestroyObject (struct TdInlineQueryResultGame *var);
+void TdStackStorer (struct TdInlineQueryResultGame *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineQueryResultAnimation> TdConvertToInternal (struct TdInlineQueryResultAnimation *var);
+struct TdInlineQueryResultAnimation *TdConvertFromInternal (const td::td_api::inlineQueryResultAnimation &from);
+std::string TdToString (struct TdInlineQueryResultAnimation *var);
+void TdDestroyObject (struct TdInlineQueryResultAnimation *var);
+void TdStackStorer (struct TdInlineQueryResultAnimation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineQueryResultAudio> TdConvertToInternal (struct TdInlineQueryResultAudio *var);
+struct TdInlineQueryResultAudio *TdConvertFromInternal (const td::td_api::inlineQueryResultAudio &from);
+std::string TdToString (struct TdInlineQueryResultAudio *var);
+void TdDestroyObject (struct TdInlineQueryResultAudio *var);
+void TdStackStorer (struct TdInlineQueryResultAudio *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineQueryResultDocument> TdConvertToInternal (struct TdInlineQueryResultDocument *var);
+struct TdInlineQueryResultDocument *TdConvertFromInternal (const td::td_api::inlineQueryResultDocument &from);
+std::string TdToString (struct TdInlineQueryResultDocument *var);
+void TdDestroyObject (struct TdInlineQueryResultDocument *var);
+void TdStackStorer (struct TdInlineQueryResultDocument *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineQueryResultPhoto> TdConvertToInternal (struct TdInlineQueryResultPhoto *var);
+struct TdInlineQueryResultPhoto *TdConvertFromInternal (const td::td_api::inlineQueryResultPhoto &from);
+std::string TdToString (struct TdInlineQueryResultPhoto *var);
+void TdDestroyObject (struct TdInlineQueryResultPhoto *var);
+void TdStackStorer (struct TdInlineQueryResultPhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineQueryResultSticker> TdConvertToInternal (struct TdInlineQueryResultSticker *var);
+struct TdInlineQueryResultSticker *TdConvertFromInternal (const td::td_api::inlineQueryResultSticker &from);
+std::string TdToString (struct TdInlineQueryResultSticker *var);
+void TdDestroyObject (struct TdInlineQueryResultSticker *var);
+void TdStackStorer (struct TdInlineQueryResultSticker *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineQueryResultVideo> TdConvertToInternal (struct TdInlineQueryResultVideo *var);
+struct TdInlineQueryResultVideo *TdConvertFromInternal (const td::td_api::inlineQueryResultVideo &from);
+std::string TdToString (struct TdInlineQueryResultVideo *var);
+void TdDestroyObject (struct TdInlineQueryResultVideo *var);
+void TdStackStorer (struct TdInlineQueryResultVideo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineQueryResultVoiceNote> TdConvertToInternal (struct TdInlineQueryResultVoiceNote *var);
+struct TdInlineQueryResultVoiceNote *TdConvertFromInternal (const td::td_api::inlineQueryResultVoiceNote &from);
+std::string TdToString (struct TdInlineQueryResultVoiceNote *var);
+void TdDestroyObject (struct TdInlineQueryResultVoiceNote *var);
+void TdStackStorer (struct TdInlineQueryResultVoiceNote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inlineQueryResults> TdConvertToInternal (struct TdInlineQueryResults *var);
+struct TdInlineQueryResults *TdConvertFromInternal (const td::td_api::inlineQueryResults &from);
+std::string TdToString (struct TdInlineQueryResults *var);
+void TdDestroyObject (struct TdInlineQueryResults *var);
+void TdStackStorer (struct TdInlineQueryResults *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::InputCredentials> TdConvertToInternal (struct TdInputCredentials *var);
+struct TdInputCredentials *TdConvertFromInternal (const td::td_api::InputCredentials &from);
+std::string TdToString (struct TdInputCredentials *var);
+void TdDestroyObject (struct TdInputCredentials *var);
+void TdStackStorer (struct TdInputCredentials *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputCredentialsSaved> TdConvertToInternal (struct TdInputCredentialsSaved *var);
+struct TdInputCredentialsSaved *TdConvertFromInternal (const td::td_api::inputCredentialsSaved &from);
+std::string TdToString (struct TdInputCredentialsSaved *var);
+void TdDestroyObject (struct TdInputCredentialsSaved *var);
+void TdStackStorer (struct TdInputCredentialsSaved *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputCredentialsNew> TdConvertToInternal (struct TdInputCredentialsNew *var);
+struct TdInputCredentialsNew *TdConvertFromInternal (const td::td_api::inputCredentialsNew &from);
+std::string TdToString (struct TdInputCredentialsNew *var);
+void TdDestroyObject (struct TdInputCredentialsNew *var);
+void TdStackStorer (struct TdInputCredentialsNew *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputCredentialsAndroidPay> TdConvertToInternal (struct TdInputCredentialsAndroidPay *var);
+struct TdInputCredentialsAndroidPay *TdConvertFromInternal (const td::td_api::inputCredentialsAndroidPay &from);
+std::string TdToString (struct TdInputCredentialsAndroidPay *var);
+void TdDestroyObject (struct TdInputCredentialsAndroidPay *var);
+void TdStackStorer (struct TdInputCredentialsAndroidPay *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputCredentialsApplePay> TdConvertToInternal (struct TdInputCredentialsApplePay *var);
+struct TdInputCredentialsApplePay *TdConvertFromInternal (const td::td_api::inputCredentialsApplePay &from);
+std::string TdToString (struct TdInputCredentialsApplePay *var);
+void TdDestroyObject (struct TdInputCredentialsApplePay *var);
+void TdStackStorer (struct TdInputCredentialsApplePay *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::InputFile> TdConvertToInternal (struct TdInputFile *var);
+struct TdInputFile *TdConvertFromInternal (const td::td_api::InputFile &from);
+std::string TdToString (struct TdInputFile *var);
+void TdDestroyObject (struct TdInputFile *var);
+void TdStackStorer (struct TdInputFile *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputFileId> TdConvertToInternal (struct TdInputFileId *var);
+struct TdInputFileId *TdConvertFromInternal (const td::td_api::inputFileId &from);
+std::string TdToString (struct TdInputFileId *var);
+void TdDestroyObject (struct TdInputFileId *var);
+void TdStackStorer (struct TdInputFileId *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputFileRemote> TdConvertToInternal (struct TdInputFileRemote *var);
+struct TdInputFileRemote *TdConvertFromInternal (const td::td_api::inputFileRemote &from);
+std::string TdToString (struct TdInputFileRemote *var);
+void TdDestroyObject (struct TdInputFileRemote *var);
+void TdStackStorer (struct TdInputFileRemote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputFileLocal> TdConvertToInternal (struct TdInputFileLocal *var);
+struct TdInputFileLocal *TdConvertFromInternal (const td::td_api::inputFileLocal &from);
+std::string TdToString (struct TdInputFileLocal *var);
+void TdDestroyObject (struct TdInputFileLocal *var);
+void TdStackStorer (struct TdInputFileLocal *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputFileGenerated> TdConvertToInternal (struct TdInputFileGenerated *var);
+struct TdInputFileGenerated *TdConvertFromInternal (const td::td_api::inputFileGenerated &from);
+std::string TdToString (struct TdInputFileGenerated *var);
+void TdDestroyObject (struct TdInputFileGenerated *var);
+void TdStackStorer (struct TdInputFileGenerated *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::InputInlineQueryResult> TdConvertToInternal (struct TdInputInlineQueryResult *var);
+struct TdInputInlineQueryResult *TdConvertFromInternal (const td::td_api::InputInlineQueryResult &from);
+std::string TdToString (struct TdInputInlineQueryResult *var);
+void TdDestroyObject (struct TdInputInlineQueryResult *var);
+void TdStackStorer (struct TdInputInlineQueryResult *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputInlineQueryResultAnimatedGif> TdConvertToInternal (struct TdInputInlineQueryResultAnimatedGif *var);
+struct TdInputInlineQueryResultAnimatedGif *TdConvertFromInternal (const td::td_api::inputInlineQueryResultAnimatedGif &from);
+std::string TdToString (struct TdInputInlineQueryResultAnimatedGif *var);
+void TdDestroyObject (struct TdInputInlineQueryResultAnimatedGif *var);
+void TdStackStorer (struct TdInputInlineQueryResultAnimatedGif *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputInlineQueryResultAnimatedMpeg4> TdConvertToInternal (struct TdInputInlineQueryResultAnimatedMpeg4 *var);
+struct TdInputInlineQueryResultAnimatedMpeg4 *TdConvertFromInternal (const td::td_api::inputInlineQueryResultAnimatedMpeg4 &from);
+std::string TdToString (struct TdInputInlineQueryResultAnimatedMpeg4 *var);
+void TdDestroyObject (struct TdInputInlineQueryResultAnimatedMpeg4 *var);
+void TdStackStorer (struct TdInputInlineQueryResultAnimatedMpeg4 *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputInlineQueryResultArticle> TdConvertToInternal (struct TdInputInlineQueryResultArticle *var);
+struct TdInputInlineQueryResultArticle *TdConvertFromInternal (const td::td_api::inputInlineQueryResultArticle &from);
+std::string TdToString (struct TdInputInlineQueryResultArticle *var);
+void TdDestroyObject (struct TdInputInlineQueryResultArticle *var);
+void TdStackStorer (struct TdInputInlineQueryResultArticle *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputInlineQueryResultAudio> TdConvertToInternal (struct TdInputInlineQueryResultAudio *var);
+struct TdInputInlineQueryResultAudio *TdConvertFromInternal (const td::td_api::inputInlineQueryResultAudio &from);
+std::string TdToString (struct TdInputInlineQueryResultAudio *var);
+void TdDestroyObject (struct TdInputInlineQueryResultAudio *var);
+void TdStackStorer (struct TdInputInlineQueryResultAudio *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputInlineQueryResultContact> TdConvertToInternal (struct TdInputInlineQueryResultContact *var);
+struct TdInputInlineQueryResultContact *TdConvertFromInternal (const td::td_api::inputInlineQueryResultContact &from);
+std::string TdToString (struct TdInputInlineQueryResultContact *var);
+void TdDestroyObject (struct TdInputInlineQueryResultContact *var);
+void TdStackStorer (struct TdInputInlineQueryResultContact *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputInlineQueryResultDocument> TdConvertToInternal (struct TdInputInlineQueryResultDocument *var);
+struct TdInputInlineQueryResultDocument *TdConvertFromInternal (const td::td_api::inputInlineQueryResultDocument &from);
+std::string TdToString (struct TdInputInlineQueryResultDocument *var);
+void TdDestroyObject (struct TdInputInlineQueryResultDocument *var);
+void TdStackStorer (struct TdInputInlineQueryResultDocument *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputInlineQueryResultGame> TdConvertToInternal (struct TdInputInlineQueryResultGame *var);
+struct TdInputInlineQueryResultGame *TdConvertFromInternal (const td::td_api::inputInlineQueryResultGame &from);
+std::string TdToString (struct TdInputInlineQueryResultGame *var);
+void TdDestroyObject (struct TdInputInlineQueryResultGame *var);
+void TdStackStorer (struct TdInputInlineQueryResultGame *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputInlineQueryResultLocation> TdConvertToInternal (struct TdInputInlineQueryResultLocation *var);
+struct TdInputInlineQueryResultLocation *TdConvertFromInternal (const td::td_api::inputInlineQueryResultLocation &from);
+std::string TdToString (struct TdInputInlineQueryResultLocation *var);
+void TdDestroyObject (struct TdInputInlineQueryResultLocation *var);
+void TdStackStorer (struct TdInputInlineQueryResultLocation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputInlineQueryResultPhoto> TdConvertToInternal (struct TdInputInlineQueryResultPhoto *var);
+struct TdInputInlineQueryResultPhoto *TdConvertFromInternal (const td::td_api::inputInlineQueryResultPhoto &from);
+std::string TdToString (struct TdInputInlineQueryResultPhoto *var);
+void TdDestroyObject (struct TdInputInlineQueryResultPhoto *var);
+void TdStackStorer (struct TdInputInlineQueryResultPhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputInlineQueryResultSticker> TdConvertToInternal (struct TdInputInlineQueryResultSticker *var);
+struct TdInputInlineQueryResultSticker *TdConvertFromInternal (const td::td_api::inputInlineQueryResultSticker &from);
+std::string TdToString (struct TdInputInlineQueryResultSticker *var);
+void TdDestroyObject (struct TdInputInlineQueryResultSticker *var);
+void TdStackStorer (struct TdInputInlineQueryResultSticker *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputInlineQueryResultVenue> TdConvertToInternal (struct TdInputInlineQueryResultVenue *var);
+struct TdInputInlineQueryResultVenue *TdConvertFromInternal (const td::td_api::inputInlineQueryResultVenue &from);
+std::string TdToString (struct TdInputInlineQueryResultVenue *var);
+void TdDestroyObject (struct TdInputInlineQueryResultVenue *var);
+void TdStackStorer (struct TdInputInlineQueryResultVenue *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputInlineQueryResultVideo> TdConvertToInternal (struct TdInputInlineQueryResultVideo *var);
+struct TdInputInlineQueryResultVideo *TdConvertFromInternal (const td::td_api::inputInlineQueryResultVideo &from);
+std::string TdToString (struct TdInputInlineQueryResultVideo *var);
+void TdDestroyObject (struct TdInputInlineQueryResultVideo *var);
+void TdStackStorer (struct TdInputInlineQueryResultVideo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputInlineQueryResultVoiceNote> TdConvertToInternal (struct TdInputInlineQueryResultVoiceNote *var);
+struct TdInputInlineQueryResultVoiceNote *TdConvertFromInternal (const td::td_api::inputInlineQueryResultVoiceNote &from);
+std::string TdToString (struct TdInputInlineQueryResultVoiceNote *var);
+void TdDestroyObject (struct TdInputInlineQueryResultVoiceNote *var);
+void TdStackStorer (struct TdInputInlineQueryResultVoiceNote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::InputMessageContent> TdConvertToInternal (struct TdInputMessageContent *var);
+struct TdInputMessageContent *TdConvertFromInternal (const td::td_api::InputMessageContent &from);
+std::string TdToString (struct TdInputMessageContent *var);
+void TdDestroyObject (struct TdInputMessageContent *var);
+void TdStackStorer (struct TdInputMessageContent *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputMessageText> TdConvertToInternal (struct TdInputMessageText *var);
+struct TdInputMessageText *TdConvertFromInternal (const td::td_api::inputMessageText &from);
+std::string TdToString (struct TdInputMessageText *var);
+void TdDestroyObject (struct TdInputMessageText *var);
+void TdStackStorer (struct TdInputMessageText *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputMessageAnimation> TdConvertToInternal (struct TdInputMessageAnimation *var);
+struct TdInputMessageAnimation *TdConvertFromInternal (const td::td_api::inputMessageAnimation &from);
+std::string TdToString (struct TdInputMessageAnimation *var);
+void TdDestroyObject (struct TdInputMessageAnimation *var);
+void TdStackStorer (struct TdInputMessageAnimation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputMessageAudio> TdConvertToInternal (struct TdInputMessageAudio *var);
+struct TdInputMessageAudio *TdConvertFromInternal (const td::td_api::inputMessageAudio &from);
+std::string TdToString (struct TdInputMessageAudio *var);
+void TdDestroyObject (struct TdInputMessageAudio *var);
+void TdStackStorer (struct TdInputMessageAudio *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputMessageDocument> TdConvertToInternal (struct TdInputMessageDocument *var);
+struct TdInputMessageDocument *TdConvertFromInternal (const td::td_api::inputMessageDocument &from);
+std::string TdToString (struct TdInputMessageDocument *var);
+void TdDestroyObject (struct TdInputMessageDocument *var);
+void TdStackStorer (struct TdInputMessageDocument *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputMessagePhoto> TdConvertToInternal (struct TdInputMessagePhoto *var);
+struct TdInputMessagePhoto *TdConvertFromInternal (const td::td_api::inputMessagePhoto &from);
+std::string TdToString (struct TdInputMessagePhoto *var);
+void TdDestroyObject (struct TdInputMessagePhoto *var);
+void TdStackStorer (struct TdInputMessagePhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputMessageSticker> TdConvertToInternal (struct TdInputMessageSticker *var);
+struct TdInputMessageSticker *TdConvertFromInternal (const td::td_api::inputMessageSticker &from);
+std::string TdToString (struct TdInputMessageSticker *var);
+void TdDestroyObject (struct TdInputMessageSticker *var);
+void TdStackStorer (struct TdInputMessageSticker *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputMessageVideo> TdConvertToInternal (struct TdInputMessageVideo *var);
+struct TdInputMessageVideo *TdConvertFromInternal (const td::td_api::inputMessageVideo &from);
+std::string TdToString (struct TdInputMessageVideo *var);
+void TdDestroyObject (struct TdInputMessageVideo *var);
+void TdStackStorer (struct TdInputMessageVideo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputMessageVideoNote> TdConvertToInternal (struct TdInputMessageVideoNote *var);
+struct TdInputMessageVideoNote *TdConvertFromInternal (const td::td_api::inputMessageVideoNote &from);
+std::string TdToString (struct TdInputMessageVideoNote *var);
+void TdDestroyObject (struct TdInputMessageVideoNote *var);
+void TdStackStorer (struct TdInputMessageVideoNote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputMessageVoiceNote> TdConvertToInternal (struct TdInputMessageVoiceNote *var);
+struct TdInputMessageVoiceNote *TdConvertFromInternal (const td::td_api::inputMessageVoiceNote &from);
+std::string TdToString (struct TdInputMessageVoiceNote *var);
+void TdDestroyObject (struct TdInputMessageVoiceNote *var);
+void TdStackStorer (struct TdInputMessageVoiceNote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputMessageLocation> TdConvertToInternal (struct TdInputMessageLocation *var);
+struct TdInputMessageLocation *TdConvertFromInternal (const td::td_api::inputMessageLocation &from);
+std::string TdToString (struct TdInputMessageLocation *var);
+void TdDestroyObject (struct TdInputMessageLocation *var);
+void TdStackStorer (struct TdInputMessageLocation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputMessageVenue> TdConvertToInternal (struct TdInputMessageVenue *var);
+struct TdInputMessageVenue *TdConvertFromInternal (const td::td_api::inputMessageVenue &from);
+std::string TdToString (struct TdInputMessageVenue *var);
+void TdDestroyObject (struct TdInputMessageVenue *var);
+void TdStackStorer (struct TdInputMessageVenue *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputMessageContact> TdConvertToInternal (struct TdInputMessageContact *var);
+struct TdInputMessageContact *TdConvertFromInternal (const td::td_api::inputMessageContact &from);
+std::string TdToString (struct TdInputMessageContact *var);
+void TdDestroyObject (struct TdInputMessageContact *var);
+void TdStackStorer (struct TdInputMessageContact *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputMessageGame> TdConvertToInternal (struct TdInputMessageGame *var);
+struct TdInputMessageGame *TdConvertFromInternal (const td::td_api::inputMessageGame &from);
+std::string TdToString (struct TdInputMessageGame *var);
+void TdDestroyObject (struct TdInputMessageGame *var);
+void TdStackStorer (struct TdInputMessageGame *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputMessageInvoice> TdConvertToInternal (struct TdInputMessageInvoice *var);
+struct TdInputMessageInvoice *TdConvertFromInternal (const td::td_api::inputMessageInvoice &from);
+std::string TdToString (struct TdInputMessageInvoice *var);
+void TdDestroyObject (struct TdInputMessageInvoice *var);
+void TdStackStorer (struct TdInputMessageInvoice *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputMessageForwarded> TdConvertToInternal (struct TdInputMessageForwarded *var);
+struct TdInputMessageForwarded *TdConvertFromInternal (const td::td_api::inputMessageForwarded &from);
+std::string TdToString (struct TdInputMessageForwarded *var);
+void TdDestroyObject (struct TdInputMessageForwarded *var);
+void TdStackStorer (struct TdInputMessageForwarded *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputSticker> TdConvertToInternal (struct TdInputSticker *var);
+struct TdInputSticker *TdConvertFromInternal (const td::td_api::inputSticker &from);
+std::string TdToString (struct TdInputSticker *var);
+void TdDestroyObject (struct TdInputSticker *var);
+void TdStackStorer (struct TdInputSticker *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::inputThumbnail> TdConvertToInternal (struct TdInputThumbnail *var);
+struct TdInputThumbnail *TdConvertFromInternal (const td::td_api::inputThumbnail &from);
+std::string TdToString (struct TdInputThumbnail *var);
+void TdDestroyObject (struct TdInputThumbnail *var);
+void TdStackStorer (struct TdInputThumbnail *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::invoice> TdConvertToInternal (struct TdInvoice *var);
+struct TdInvoice *TdConvertFromInternal (const td::td_api::invoice &from);
+std::string TdToString (struct TdInvoice *var);
+void TdDestroyObject (struct TdInvoice *var);
+void TdStackStorer (struct TdInvoice *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::keyboardButton> TdConvertToInternal (struct TdKeyboardButton *var);
+struct TdKeyboardButton *TdConvertFromInternal (const td::td_api::keyboardButton &from);
+std::string TdToString (struct TdKeyboardButton *var);
+void TdDestroyObject (struct TdKeyboardButton *var);
+void TdStackStorer (struct TdKeyboardButton *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::KeyboardButtonType> TdConvertToInternal (struct TdKeyboardButtonType *var);
+struct TdKeyboardButtonType *TdConvertFromInternal (const td::td_api::KeyboardButtonType &from);
+std::string TdToString (struct TdKeyboardButtonType *var);
+void TdDestroyObject (struct TdKeyboardButtonType *var);
+void TdStackStorer (struct TdKeyboardButtonType *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::keyboardButtonTypeText> TdConvertToInternal (struct TdKeyboardButtonTypeText *var);
+struct TdKeyboardButtonTypeText *TdConvertFromInternal (const td::td_api::keyboardButtonTypeText &from);
+std::string TdToString (struct TdKeyboardButtonTypeText *var);
+void TdDestroyObject (struct TdKeyboardButtonTypeText *var);
+void TdStackStorer (struct TdKeyboardButtonTypeText *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::keyboardButtonTypeRequestPhoneNumber> TdConvertToInternal (struct TdKeyboardButtonTypeRequestPhoneNumber *var);
+struct TdKeyboardButtonTypeRequestPhoneNumber *TdConvertFromInternal (const td::td_api::keyboardButtonTypeRequestPhoneNumber &from);
+std::string TdToString (struct TdKeyboardButtonTypeRequestPhoneNumber *var);
+void TdDestroyObject (struct TdKeyboardButtonTypeRequestPhoneNumber *var);
+void TdStackStorer (struct TdKeyboardButtonTypeRequestPhoneNumber *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::keyboardButtonTypeRequestLocation> TdConvertToInternal (struct TdKeyboardButtonTypeRequestLocation *var);
+struct TdKeyboardButtonTypeRequestLocation *TdConvertFromInternal (const td::td_api::keyboardButtonTypeRequestLocation &from);
+std::string TdToString (struct TdKeyboardButtonTypeRequestLocation *var);
+void TdDestroyObject (struct TdKeyboardButtonTypeRequestLocation *var);
+void TdStackStorer (struct TdKeyboardButtonTypeRequestLocation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::labeledPricePart> TdConvertToInternal (struct TdLabeledPricePart *var);
+struct TdLabeledPricePart *TdConvertFromInternal (const td::td_api::labeledPricePart &from);
+std::string TdToString (struct TdLabeledPricePart *var);
+void TdDestroyObject (struct TdLabeledPricePart *var);
+void TdStackStorer (struct TdLabeledPricePart *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::LinkState> TdConvertToInternal (struct TdLinkState *var);
+struct TdLinkState *TdConvertFromInternal (const td::td_api::LinkState &from);
+std::string TdToString (struct TdLinkState *var);
+void TdDestroyObject (struct TdLinkState *var);
+void TdStackStorer (struct TdLinkState *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::linkStateNone> TdConvertToInternal (struct TdLinkStateNone *var);
+struct TdLinkStateNone *TdConvertFromInternal (const td::td_api::linkStateNone &from);
+std::string TdToString (struct TdLinkStateNone *var);
+void TdDestroyObject (struct TdLinkStateNone *var);
+void TdStackStorer (struct TdLinkStateNone *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::linkStateKnowsPhoneNumber> TdConvertToInternal (struct TdLinkStateKnowsPhoneNumber *var);
+struct TdLinkStateKnowsPhoneNumber *TdConvertFromInternal (const td::td_api::linkStateKnowsPhoneNumber &from);
+std::string TdToString (struct TdLinkStateKnowsPhoneNumber *var);
+void TdDestroyObject (struct TdLinkStateKnowsPhoneNumber *var);
+void TdStackStorer (struct TdLinkStateKnowsPhoneNumber *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::linkStateIsContact> TdConvertToInternal (struct TdLinkStateIsContact *var);
+struct TdLinkStateIsContact *TdConvertFromInternal (const td::td_api::linkStateIsContact &from);
+std::string TdToString (struct TdLinkStateIsContact *var);
+void TdDestroyObject (struct TdLinkStateIsContact *var);
+void TdStackStorer (struct TdLinkStateIsContact *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::localFile> TdConvertToInternal (struct TdLocalFile *var);
+struct TdLocalFile *TdConvertFromInternal (const td::td_api::localFile &from);
+std::string TdToString (struct TdLocalFile *var);
+void TdDestroyObject (struct TdLocalFile *var);
+void TdStackStorer (struct TdLocalFile *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::location> TdConvertToInternal (struct TdLocation *var);
+struct TdLocation *TdConvertFromInternal (const td::td_api::location &from);
+std::string TdToString (struct TdLocation *var);
+void TdDestroyObject (struct TdLocation *var);
+void TdStackStorer (struct TdLocation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::MaskPoint> TdConvertToInternal (struct TdMaskPoint *var);
+struct TdMaskPoint *TdConvertFromInternal (const td::td_api::MaskPoint &from);
+std::string TdToString (struct TdMaskPoint *var);
+void TdDestroyObject (struct TdMaskPoint *var);
+void TdStackStorer (struct TdMaskPoint *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::maskPointForehead> TdConvertToInternal (struct TdMaskPointForehead *var);
+struct TdMaskPointForehead *TdConvertFromInternal (const td::td_api::maskPointForehead &from);
+std::string TdToString (struct TdMaskPointForehead *var);
+void TdDestroyObject (struct TdMaskPointForehead *var);
+void TdStackStorer (struct TdMaskPointForehead *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::maskPointEyes> TdConvertToInternal (struct TdMaskPointEyes *var);
+struct TdMaskPointEyes *TdConvertFromInternal (const td::td_api::maskPointEyes &from);
+std::string TdToString (struct TdMaskPointEyes *var);
+void TdDestroyObject (struct TdMaskPointEyes *var);
+void TdStackStorer (struct TdMaskPointEyes *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::maskPointMouth> TdConvertToInternal (struct TdMaskPointMouth *var);
+struct TdMaskPointMouth *TdConvertFromInternal (const td::td_api::maskPointMouth &from);
+std::string TdToString (struct TdMaskPointMouth *var);
+void TdDestroyObject (struct TdMaskPointMouth *var);
+void TdStackStorer (struct TdMaskPointMouth *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::maskPointChin> TdConvertToInternal (struct TdMaskPointChin *var);
+struct TdMaskPointChin *TdConvertFromInternal (const td::td_api::maskPointChin &from);
+std::string TdToString (struct TdMaskPointChin *var);
+void TdDestroyObject (struct TdMaskPointChin *var);
+void TdStackStorer (struct TdMaskPointChin *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::maskPosition> TdConvertToInternal (struct TdMaskPosition *var);
+struct TdMaskPosition *TdConvertFromInternal (const td::td_api::maskPosition &from);
+std::string TdToString (struct TdMaskPosition *var);
+void TdDestroyObject (struct TdMaskPosition *var);
+void TdStackStorer (struct TdMaskPosition *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::message> TdConvertToInternal (struct TdMessage *var);
+struct TdMessage *TdConvertFromInternal (const td::td_api::message &from);
+std::string TdToString (struct TdMessage *var);
+void TdDestroyObject (struct TdMessage *var);
+void TdStackStorer (struct TdMessage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::MessageContent> TdConvertToInternal (struct TdMessageContent *var);
+struct TdMessageContent *TdConvertFromInternal (const td::td_api::MessageContent &from);
+std::string TdToString (struct TdMessageContent *var);
+void TdDestroyObject (struct TdMessageContent *var);
+void TdStackStorer (struct TdMessageContent *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageText> TdConvertToInternal (struct TdMessageText *var);
+struct TdMessageText *TdConvertFromInternal (const td::td_api::messageText &from);
+std::string TdToString (struct TdMessageText *var);
+void TdDestroyObject (struct TdMessageText *var);
+void TdStackStorer (struct TdMessageText *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageAnimation> TdConvertToInternal (struct TdMessageAnimation *var);
+struct TdMessageAnimation *TdConvertFromInternal (const td::td_api::messageAnimation &from);
+std::string TdToString (struct TdMessageAnimation *var);
+void TdDestroyObject (struct TdMessageAnimation *var);
+void TdStackStorer (struct TdMessageAnimation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageAudio> TdConvertToInternal (struct TdMessageAudio *var);
+struct TdMessageAudio *TdConvertFromInternal (const td::td_api::messageAudio &from);
+std::string TdToString (struct TdMessageAudio *var);
+void TdDestroyObject (struct TdMessageAudio *var);
+void TdStackStorer (struct TdMessageAudio *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageDocument> TdConvertToInternal (struct TdMessageDocument *var);
+struct TdMessageDocument *TdConvertFromInternal (const td::td_api::messageDocument &from);
+std::string TdToString (struct TdMessageDocument *var);
+void TdDestroyObject (struct TdMessageDocument *var);
+void TdStackStorer (struct TdMessageDocument *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messagePhoto> TdConvertToInternal (struct TdMessagePhoto *var);
+struct TdMessagePhoto *TdConvertFromInternal (const td::td_api::messagePhoto &from);
+std::string TdToString (struct TdMessagePhoto *var);
+void TdDestroyObject (struct TdMessagePhoto *var);
+void TdStackStorer (struct TdMessagePhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageExpiredPhoto> TdConvertToInternal (struct TdMessageExpiredPhoto *var);
+struct TdMessageExpiredPhoto *TdConvertFromInternal (const td::td_api::messageExpiredPhoto &from);
+std::string TdToString (struct TdMessageExpiredPhoto *var);
+void TdDestroyObject (struct TdMessageExpiredPhoto *var);
+void TdStackStorer (struct TdMessageExpiredPhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageSticker> TdConvertToInternal (struct TdMessageSticker *var);
+struct TdMessageSticker *TdConvertFromInternal (const td::td_api::messageSticker &from);
+std::string TdToString (struct TdMessageSticker *var);
+void TdDestroyObject (struct TdMessageSticker *var);
+void TdStackStorer (struct TdMessageSticker *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageVideo> TdConvertToInternal (struct TdMessageVideo *var);
+struct TdMessageVideo *TdConvertFromInternal (const td::td_api::messageVideo &from);
+std::string TdToString (struct TdMessageVideo *var);
+void TdDestroyObject (struct TdMessageVideo *var);
+void TdStackStorer (struct TdMessageVideo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageExpiredVideo> TdConvertToInternal (struct TdMessageExpiredVideo *var);
+struct TdMessageExpiredVideo *TdConvertFromInternal (const td::td_api::messageExpiredVideo &from);
+std::string TdToString (struct TdMessageExpiredVideo *var);
+void TdDestroyObject (struct TdMessageExpiredVideo *var);
+void TdStackStorer (struct TdMessageExpiredVideo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageVideoNote> TdConvertToInternal (struct TdMessageVideoNote *var);
+struct TdMessageVideoNote *TdConvertFromInternal (const td::td_api::messageVideoNote &from);
+std::string TdToString (struct TdMessageVideoNote *var);
+void TdDestroyObject (struct TdMessageVideoNote *var);
+void TdStackStorer (struct TdMessageVideoNote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageVoiceNote> TdConvertToInternal (struct TdMessageVoiceNote *var);
+struct TdMessageVoiceNote *TdConvertFromInternal (const td::td_api::messageVoiceNote &from);
+std::string TdToString (struct TdMessageVoiceNote *var);
+void TdDestroyObject (struct TdMessageVoiceNote *var);
+void TdStackStorer (struct TdMessageVoiceNote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageLocation> TdConvertToInternal (struct TdMessageLocation *var);
+struct TdMessageLocation *TdConvertFromInternal (const td::td_api::messageLocation &from);
+std::string TdToString (struct TdMessageLocation *var);
+void TdDestroyObject (struct TdMessageLocation *var);
+void TdStackStorer (struct TdMessageLocation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageVenue> TdConvertToInternal (struct TdMessageVenue *var);
+struct TdMessageVenue *TdConvertFromInternal (const td::td_api::messageVenue &from);
+std::string TdToString (struct TdMessageVenue *var);
+void TdDestroyObject (struct TdMessageVenue *var);
+void TdStackStorer (struct TdMessageVenue *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageContact> TdConvertToInternal (struct TdMessageContact *var);
+struct TdMessageContact *TdConvertFromInternal (const td::td_api::messageContact &from);
+std::string TdToString (struct TdMessageContact *var);
+void TdDestroyObject (struct TdMessageContact *var);
+void TdStackStorer (struct TdMessageContact *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageGame> TdConvertToInternal (struct TdMessageGame *var);
+struct TdMessageGame *TdConvertFromInternal (const td::td_api::messageGame &from);
+std::string TdToString (struct TdMessageGame *var);
+void TdDestroyObject (struct TdMessageGame *var);
+void TdStackStorer (struct TdMessageGame *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageInvoice> TdConvertToInternal (struct TdMessageInvoice *var);
+struct TdMessageInvoice *TdConvertFromInternal (const td::td_api::messageInvoice &from);
+std::string TdToString (struct TdMessageInvoice *var);
+void TdDestroyObject (struct TdMessageInvoice *var);
+void TdStackStorer (struct TdMessageInvoice *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageCall> TdConvertToInternal (struct TdMessageCall *var);
+struct TdMessageCall *TdConvertFromInternal (const td::td_api::messageCall &from);
+std::string TdToString (struct TdMessageCall *var);
+void TdDestroyObject (struct TdMessageCall *var);
+void TdStackStorer (struct TdMessageCall *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageBasicGroupChatCreate> TdConvertToInternal (struct TdMessageBasicGroupChatCreate *var);
+struct TdMessageBasicGroupChatCreate *TdConvertFromInternal (const td::td_api::messageBasicGroupChatCreate &from);
+std::string TdToString (struct TdMessageBasicGroupChatCreate *var);
+void TdDestroyObject (struct TdMessageBasicGroupChatCreate *var);
+void TdStackStorer (struct TdMessageBasicGroupChatCreate *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageSupergroupChatCreate> TdConvertToInternal (struct TdMessageSupergroupChatCreate *var);
+struct TdMessageSupergroupChatCreate *TdConvertFromInternal (const td::td_api::messageSupergroupChatCreate &from);
+std::string TdToString (struct TdMessageSupergroupChatCreate *var);
+void TdDestroyObject (struct TdMessageSupergroupChatCreate *var);
+void TdStackStorer (struct TdMessageSupergroupChatCreate *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageChatChangeTitle> TdConvertToInternal (struct TdMessageChatChangeTitle *var);
+struct TdMessageChatChangeTitle *TdConvertFromInternal (const td::td_api::messageChatChangeTitle &from);
+std::string TdToString (struct TdMessageChatChangeTitle *var);
+void TdDestroyObject (struct TdMessageChatChangeTitle *var);
+void TdStackStorer (struct TdMessageChatChangeTitle *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageChatChangePhoto> TdConvertToInternal (struct TdMessageChatChangePhoto *var);
+struct TdMessageChatChangePhoto *TdConvertFromInternal (const td::td_api::messageChatChangePhoto &from);
+std::string TdToString (struct TdMessageChatChangePhoto *var);
+void TdDestroyObject (struct TdMessageChatChangePhoto *var);
+void TdStackStorer (struct TdMessageChatChangePhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageChatDeletePhoto> TdConvertToInternal (struct TdMessageChatDeletePhoto *var);
+struct TdMessageChatDeletePhoto *TdConvertFromInternal (const td::td_api::messageChatDeletePhoto &from);
+std::string TdToString (struct TdMessageChatDeletePhoto *var);
+void TdDestroyObject (struct TdMessageChatDeletePhoto *var);
+void TdStackStorer (struct TdMessageChatDeletePhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageChatAddMembers> TdConvertToInternal (struct TdMessageChatAddMembers *var);
+struct TdMessageChatAddMembers *TdConvertFromInternal (const td::td_api::messageChatAddMembers &from);
+std::string TdToString (struct TdMessageChatAddMembers *var);
+void TdDestroyObject (struct TdMessageChatAddMembers *var);
+void TdStackStorer (struct TdMessageChatAddMembers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageChatJoinByLink> TdConvertToInternal (struct TdMessageChatJoinByLink *var);
+struct TdMessageChatJoinByLink *TdConvertFromInternal (const td::td_api::messageChatJoinByLink &from);
+std::string TdToString (struct TdMessageChatJoinByLink *var);
+void TdDestroyObject (struct TdMessageChatJoinByLink *var);
+void TdStackStorer (struct TdMessageChatJoinByLink *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageChatDeleteMember> TdConvertToInternal (struct TdMessageChatDeleteMember *var);
+struct TdMessageChatDeleteMember *TdConvertFromInternal (const td::td_api::messageChatDeleteMember &from);
+std::string TdToString (struct TdMessageChatDeleteMember *var);
+void TdDestroyObject (struct TdMessageChatDeleteMember *var);
+void TdStackStorer (struct TdMessageChatDeleteMember *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageChatUpgradeTo> TdConvertToInternal (struct TdMessageChatUpgradeTo *var);
+struct TdMessageChatUpgradeTo *TdConvertFromInternal (const td::td_api::messageChatUpgradeTo &from);
+std::string TdToString (struct TdMessageChatUpgradeTo *var);
+void TdDestroyObject (struct TdMessageChatUpgradeTo *var);
+void TdStackStorer (struct TdMessageChatUpgradeTo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageChatUpgradeFrom> TdConvertToInternal (struct TdMessageChatUpgradeFrom *var);
+struct TdMessageChatUpgradeFrom *TdConvertFromInternal (const td::td_api::messageChatUpgradeFrom &from);
+std::string TdToString (struct TdMessageChatUpgradeFrom *var);
+void TdDestroyObject (struct TdMessageChatUpgradeFrom *var);
+void TdStackStorer (struct TdMessageChatUpgradeFrom *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messagePinMessage> TdConvertToInternal (struct TdMessagePinMessage *var);
+struct TdMessagePinMessage *TdConvertFromInternal (const td::td_api::messagePinMessage &from);
+std::string TdToString (struct TdMessagePinMessage *var);
+void TdDestroyObject (struct TdMessagePinMessage *var);
+void TdStackStorer (struct TdMessagePinMessage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageScreenshotTaken> TdConvertToInternal (struct TdMessageScreenshotTaken *var);
+struct TdMessageScreenshotTaken *TdConvertFromInternal (const td::td_api::messageScreenshotTaken &from);
+std::string TdToString (struct TdMessageScreenshotTaken *var);
+void TdDestroyObject (struct TdMessageScreenshotTaken *var);
+void TdStackStorer (struct TdMessageScreenshotTaken *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageChatSetTtl> TdConvertToInternal (struct TdMessageChatSetTtl *var);
+struct TdMessageChatSetTtl *TdConvertFromInternal (const td::td_api::messageChatSetTtl &from);
+std::string TdToString (struct TdMessageChatSetTtl *var);
+void TdDestroyObject (struct TdMessageChatSetTtl *var);
+void TdStackStorer (struct TdMessageChatSetTtl *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageCustomServiceAction> TdConvertToInternal (struct TdMessageCustomServiceAction *var);
+struct TdMessageCustomServiceAction *TdConvertFromInternal (const td::td_api::messageCustomServiceAction &from);
+std::string TdToString (struct TdMessageCustomServiceAction *var);
+void TdDestroyObject (struct TdMessageCustomServiceAction *var);
+void TdStackStorer (struct TdMessageCustomServiceAction *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageGameScore> TdConvertToInternal (struct TdMessageGameScore *var);
+struct TdMessageGameScore *TdConvertFromInternal (const td::td_api::messageGameScore &from);
+std::string TdToString (struct TdMessageGameScore *var);
+void TdDestroyObject (struct TdMessageGameScore *var);
+void TdStackStorer (struct TdMessageGameScore *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messagePaymentSuccessful> TdConvertToInternal (struct TdMessagePaymentSuccessful *var);
+struct TdMessagePaymentSuccessful *TdConvertFromInternal (const td::td_api::messagePaymentSuccessful &from);
+std::string TdToString (struct TdMessagePaymentSuccessful *var);
+void TdDestroyObject (struct TdMessagePaymentSuccessful *var);
+void TdStackStorer (struct TdMessagePaymentSuccessful *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messagePaymentSuccessfulBot> TdConvertToInternal (struct TdMessagePaymentSuccessfulBot *var);
+struct TdMessagePaymentSuccessfulBot *TdConvertFromInternal (const td::td_api::messagePaymentSuccessfulBot &from);
+std::string TdToString (struct TdMessagePaymentSuccessfulBot *var);
+void TdDestroyObject (struct TdMessagePaymentSuccessfulBot *var);
+void TdStackStorer (struct TdMessagePaymentSuccessfulBot *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageContactRegistered> TdConvertToInternal (struct TdMessageContactRegistered *var);
+struct TdMessageContactRegistered *TdConvertFromInternal (const td::td_api::messageContactRegistered &from);
+std::string TdToString (struct TdMessageContactRegistered *var);
+void TdDestroyObject (struct TdMessageContactRegistered *var);
+void TdStackStorer (struct TdMessageContactRegistered *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageUnsupported> TdConvertToInternal (struct TdMessageUnsupported *var);
+struct TdMessageUnsupported *TdConvertFromInternal (const td::td_api::messageUnsupported &from);
+std::string TdToString (struct TdMessageUnsupported *var);
+void TdDestroyObject (struct TdMessageUnsupported *var);
+void TdStackStorer (struct TdMessageUnsupported *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::MessageForwardInfo> TdConvertToInternal (struct TdMessageForwardInfo *var);
+struct TdMessageForwardInfo *TdConvertFromInternal (const td::td_api::MessageForwardInfo &from);
+std::string TdToString (struct TdMessageForwardInfo *var);
+void TdDestroyObject (struct TdMessageForwardInfo *var);
+void TdStackStorer (struct TdMessageForwardInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageForwardedFromUser> TdConvertToInternal (struct TdMessageForwardedFromUser *var);
+struct TdMessageForwardedFromUser *TdConvertFromInternal (const td::td_api::messageForwardedFromUser &from);
+std::string TdToString (struct TdMessageForwardedFromUser *var);
+void TdDestroyObject (struct TdMessageForwardedFromUser *var);
+void TdStackStorer (struct TdMessageForwardedFromUser *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageForwardedPost> TdConvertToInternal (struct TdMessageForwardedPost *var);
+struct TdMessageForwardedPost *TdConvertFromInternal (const td::td_api::messageForwardedPost &from);
+std::string TdToString (struct TdMessageForwardedPost *var);
+void TdDestroyObject (struct TdMessageForwardedPost *var);
+void TdStackStorer (struct TdMessageForwardedPost *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::MessageSendingState> TdConvertToInternal (struct TdMessageSendingState *var);
+struct TdMessageSendingState *TdConvertFromInternal (const td::td_api::MessageSendingState &from);
+std::string TdToString (struct TdMessageSendingState *var);
+void TdDestroyObject (struct TdMessageSendingState *var);
+void TdStackStorer (struct TdMessageSendingState *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageSendingStatePending> TdConvertToInternal (struct TdMessageSendingStatePending *var);
+struct TdMessageSendingStatePending *TdConvertFromInternal (const td::td_api::messageSendingStatePending &from);
+std::string TdToString (struct TdMessageSendingStatePending *var);
+void TdDestroyObject (struct TdMessageSendingStatePending *var);
+void TdStackStorer (struct TdMessageSendingStatePending *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messageSendingStateFailed> TdConvertToInternal (struct TdMessageSendingStateFailed *var);
+struct TdMessageSendingStateFailed *TdConvertFromInternal (const td::td_api::messageSendingStateFailed &from);
+std::string TdToString (struct TdMessageSendingStateFailed *var);
+void TdDestroyObject (struct TdMessageSendingStateFailed *var);
+void TdStackStorer (struct TdMessageSendingStateFailed *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::messages> TdConvertToInternal (struct TdMessages *var);
+struct TdMessages *TdConvertFromInternal (const td::td_api::messages &from);
+std::string TdToString (struct TdMessages *var);
+void TdDestroyObject (struct TdMessages *var);
+void TdStackStorer (struct TdMessages *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::networkStatistics> TdConvertToInternal (struct TdNetworkStatistics *var);
+struct TdNetworkStatistics *TdConvertFromInternal (const td::td_api::networkStatistics &from);
+std::string TdToString (struct TdNetworkStatistics *var);
+void TdDestroyObject (struct TdNetworkStatistics *var);
+void TdStackStorer (struct TdNetworkStatistics *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::NetworkStatisticsEntry> TdConvertToInternal (struct TdNetworkStatisticsEntry *var);
+struct TdNetworkStatisticsEntry *TdConvertFromInternal (const td::td_api::NetworkStatisticsEntry &from);
+std::string TdToString (struct TdNetworkStatisticsEntry *var);
+void TdDestroyObject (struct TdNetworkStatisticsEntry *var);
+void TdStackStorer (struct TdNetworkStatisticsEntry *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::networkStatisticsEntryFile> TdConvertToInternal (struct TdNetworkStatisticsEntryFile *var);
+struct TdNetworkStatisticsEntryFile *TdConvertFromInternal (const td::td_api::networkStatisticsEntryFile &from);
+std::string TdToString (struct TdNetworkStatisticsEntryFile *var);
+void TdDestroyObject (struct TdNetworkStatisticsEntryFile *var);
+void TdStackStorer (struct TdNetworkStatisticsEntryFile *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::networkStatisticsEntryCall> TdConvertToInternal (struct TdNetworkStatisticsEntryCall *var);
+struct TdNetworkStatisticsEntryCall *TdConvertFromInternal (const td::td_api::networkStatisticsEntryCall &from);
+std::string TdToString (struct TdNetworkStatisticsEntryCall *var);
+void TdDestroyObject (struct TdNetworkStatisticsEntryCall *var);
+void TdStackStorer (struct TdNetworkStatisticsEntryCall *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::NetworkType> TdConvertToInternal (struct TdNetworkType *var);
+struct TdNetworkType *TdConvertFromInternal (const td::td_api::NetworkType &from);
+std::string TdToString (struct TdNetworkType *var);
+void TdDestroyObject (struct TdNetworkType *var);
+void TdStackStorer (struct TdNetworkType *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::networkTypeNone> TdConvertToInternal (struct TdNetworkTypeNone *var);
+struct TdNetworkTypeNone *TdConvertFromInternal (const td::td_api::networkTypeNone &from);
+std::string TdToString (struct TdNetworkTypeNone *var);
+void TdDestroyObject (struct TdNetworkTypeNone *var);
+void TdStackStorer (struct TdNetworkTypeNone *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::networkTypeMobile> TdConvertToInternal (struct TdNetworkTypeMobile *var);
+struct TdNetworkTypeMobile *TdConvertFromInternal (const td::td_api::networkTypeMobile &from);
+std::string TdToString (struct TdNetworkTypeMobile *var);
+void TdDestroyObject (struct TdNetworkTypeMobile *var);
+void TdStackStorer (struct TdNetworkTypeMobile *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::networkTypeMobileRoaming> TdConvertToInternal (struct TdNetworkTypeMobileRoaming *var);
+struct TdNetworkTypeMobileRoaming *TdConvertFromInternal (const td::td_api::networkTypeMobileRoaming &from);
+std::string TdToString (struct TdNetworkTypeMobileRoaming *var);
+void TdDestroyObject (struct TdNetworkTypeMobileRoaming *var);
+void TdStackStorer (struct TdNetworkTypeMobileRoaming *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::networkTypeWiFi> TdConvertToInternal (struct TdNetworkTypeWiFi *var);
+struct TdNetworkTypeWiFi *TdConvertFromInternal (const td::td_api::networkTypeWiFi &from);
+std::string TdToString (struct TdNetworkTypeWiFi *var);
+void TdDestroyObject (struct TdNetworkTypeWiFi *var);
+void TdStackStorer (struct TdNetworkTypeWiFi *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::networkTypeOther> TdConvertToInternal (struct TdNetworkTypeOther *var);
+struct TdNetworkTypeOther *TdConvertFromInternal (const td::td_api::networkTypeOther &from);
+std::string TdToString (struct TdNetworkTypeOther *var);
+void TdDestroyObject (struct TdNetworkTypeOther *var);
+void TdStackStorer (struct TdNetworkTypeOther *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::notificationSettings> TdConvertToInternal (struct TdNotificationSettings *var);
+struct TdNotificationSettings *TdConvertFromInternal (const td::td_api::notificationSettings &from);
+std::string TdToString (struct TdNotificationSettings *var);
+void TdDestroyObject (struct TdNotificationSettings *var);
+void TdStackStorer (struct TdNotificationSettings *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::NotificationSettingsScope> TdConvertToInternal (struct TdNotificationSettingsScope *var);
+struct TdNotificationSettingsScope *TdConvertFromInternal (const td::td_api::NotificationSettingsScope &from);
+std::string TdToString (struct TdNotificationSettingsScope *var);
+void TdDestroyObject (struct TdNotificationSettingsScope *var);
+void TdStackStorer (struct TdNotificationSettingsScope *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::notificationSettingsScopeChat> TdConvertToInternal (struct TdNotificationSettingsScopeChat *var);
+struct TdNotificationSettingsScopeChat *TdConvertFromInternal (const td::td_api::notificationSettingsScopeChat &from);
+std::string TdToString (struct TdNotificationSettingsScopeChat *var);
+void TdDestroyObject (struct TdNotificationSettingsScopeChat *var);
+void TdStackStorer (struct TdNotificationSettingsScopeChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::notificationSettingsScopePrivateChats> TdConvertToInternal (struct TdNotificationSettingsScopePrivateChats *var);
+struct TdNotificationSettingsScopePrivateChats *TdConvertFromInternal (const td::td_api::notificationSettingsScopePrivateChats &from);
+std::string TdToString (struct TdNotificationSettingsScopePrivateChats *var);
+void TdDestroyObject (struct TdNotificationSettingsScopePrivateChats *var);
+void TdStackStorer (struct TdNotificationSettingsScopePrivateChats *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::notificationSettingsScopeBasicGroupChats> TdConvertToInternal (struct TdNotificationSettingsScopeBasicGroupChats *var);
+struct TdNotificationSettingsScopeBasicGroupChats *TdConvertFromInternal (const td::td_api::notificationSettingsScopeBasicGroupChats &from);
+std::string TdToString (struct TdNotificationSettingsScopeBasicGroupChats *var);
+void TdDestroyObject (struct TdNotificationSettingsScopeBasicGroupChats *var);
+void TdStackStorer (struct TdNotificationSettingsScopeBasicGroupChats *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::notificationSettingsScopeAllChats> TdConvertToInternal (struct TdNotificationSettingsScopeAllChats *var);
+struct TdNotificationSettingsScopeAllChats *TdConvertFromInternal (const td::td_api::notificationSettingsScopeAllChats &from);
+std::string TdToString (struct TdNotificationSettingsScopeAllChats *var);
+void TdDestroyObject (struct TdNotificationSettingsScopeAllChats *var);
+void TdStackStorer (struct TdNotificationSettingsScopeAllChats *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::ok> TdConvertToInternal (struct TdOk *var);
+struct TdOk *TdConvertFromInternal (const td::td_api::ok &from);
+std::string TdToString (struct TdOk *var);
+void TdDestroyObject (struct TdOk *var);
+void TdStackStorer (struct TdOk *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::OptionValue> TdConvertToInternal (struct TdOptionValue *var);
+struct TdOptionValue *TdConvertFromInternal (const td::td_api::OptionValue &from);
+std::string TdToString (struct TdOptionValue *var);
+void TdDestroyObject (struct TdOptionValue *var);
+void TdStackStorer (struct TdOptionValue *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::optionValueBoolean> TdConvertToInternal (struct TdOptionValueBoolean *var);
+struct TdOptionValueBoolean *TdConvertFromInternal (const td::td_api::optionValueBoolean &from);
+std::string TdToString (struct TdOptionValueBoolean *var);
+void TdDestroyObject (struct TdOptionValueBoolean *var);
+void TdStackStorer (struct TdOptionValueBoolean *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::optionValueEmpty> TdConvertToInternal (struct TdOptionValueEmpty *var);
+struct TdOptionValueEmpty *TdConvertFromInternal (const td::td_api::optionValueEmpty &from);
+std::string TdToString (struct TdOptionValueEmpty *var);
+void TdDestroyObject (struct TdOptionValueEmpty *var);
+void TdStackStorer (struct TdOptionValueEmpty *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::optionValueInteger> TdConvertToInternal (struct TdOptionValueInteger *var);
+struct TdOptionValueInteger *TdConvertFromInternal (const td::td_api::optionValueInteger &from);
+std::string TdToString (struct TdOptionValueInteger *var);
+void TdDestroyObject (struct TdOptionValueInteger *var);
+void TdStackStorer (struct TdOptionValueInteger *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::optionValueString> TdConvertToInternal (struct TdOptionValueString *var);
+struct TdOptionValueString *TdConvertFromInternal (const td::td_api::optionValueString &from);
+std::string TdToString (struct TdOptionValueString *var);
+void TdDestroyObject (struct TdOptionValueString *var);
+void TdStackStorer (struct TdOptionValueString *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::orderInfo> TdConvertToInternal (struct TdOrderInfo *var);
+struct TdOrderInfo *TdConvertFromInternal (const td::td_api::orderInfo &from);
+std::string TdToString (struct TdOrderInfo *var);
+void TdDestroyObject (struct TdOrderInfo *var);
+void TdStackStorer (struct TdOrderInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::PageBlock> TdConvertToInternal (struct TdPageBlock *var);
+struct TdPageBlock *TdConvertFromInternal (const td::td_api::PageBlock &from);
+std::string TdToString (struct TdPageBlock *var);
+void TdDestroyObject (struct TdPageBlock *var);
+void TdStackStorer (struct TdPageBlock *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockTitle> TdConvertToInternal (struct TdPageBlockTitle *var);
+struct TdPageBlockTitle *TdConvertFromInternal (const td::td_api::pageBlockTitle &from);
+std::string TdToString (struct TdPageBlockTitle *var);
+void TdDestroyObject (struct TdPageBlockTitle *var);
+void TdStackStorer (struct TdPageBlockTitle *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockSubtitle> TdConvertToInternal (struct TdPageBlockSubtitle *var);
+struct TdPageBlockSubtitle *TdConvertFromInternal (const td::td_api::pageBlockSubtitle &from);
+std::string TdToString (struct TdPageBlockSubtitle *var);
+void TdDestroyObject (struct TdPageBlockSubtitle *var);
+void TdStackStorer (struct TdPageBlockSubtitle *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockAuthorDate> TdConvertToInternal (struct TdPageBlockAuthorDate *var);
+struct TdPageBlockAuthorDate *TdConvertFromInternal (const td::td_api::pageBlockAuthorDate &from);
+std::string TdToString (struct TdPageBlockAuthorDate *var);
+void TdDestroyObject (struct TdPageBlockAuthorDate *var);
+void TdStackStorer (struct TdPageBlockAuthorDate *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockHeader> TdConvertToInternal (struct TdPageBlockHeader *var);
+struct TdPageBlockHeader *TdConvertFromInternal (const td::td_api::pageBlockHeader &from);
+std::string TdToString (struct TdPageBlockHeader *var);
+void TdDestroyObject (struct TdPageBlockHeader *var);
+void TdStackStorer (struct TdPageBlockHeader *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockSubheader> TdConvertToInternal (struct TdPageBlockSubheader *var);
+struct TdPageBlockSubheader *TdConvertFromInternal (const td::td_api::pageBlockSubheader &from);
+std::string TdToString (struct TdPageBlockSubheader *var);
+void TdDestroyObject (struct TdPageBlockSubheader *var);
+void TdStackStorer (struct TdPageBlockSubheader *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockParagraph> TdConvertToInternal (struct TdPageBlockParagraph *var);
+struct TdPageBlockParagraph *TdConvertFromInternal (const td::td_api::pageBlockParagraph &from);
+std::string TdToString (struct TdPageBlockParagraph *var);
+void TdDestroyObject (struct TdPageBlockParagraph *var);
+void TdStackStorer (struct TdPageBlockParagraph *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockPreformatted> TdConvertToInternal (struct TdPageBlockPreformatted *var);
+struct TdPageBlockPreformatted *TdConvertFromInternal (const td::td_api::pageBlockPreformatted &from);
+std::string TdToString (struct TdPageBlockPreformatted *var);
+void TdDestroyObject (struct TdPageBlockPreformatted *var);
+void TdStackStorer (struct TdPageBlockPreformatted *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockFooter> TdConvertToInternal (struct TdPageBlockFooter *var);
+struct TdPageBlockFooter *TdConvertFromInternal (const td::td_api::pageBlockFooter &from);
+std::string TdToString (struct TdPageBlockFooter *var);
+void TdDestroyObject (struct TdPageBlockFooter *var);
+void TdStackStorer (struct TdPageBlockFooter *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockDivider> TdConvertToInternal (struct TdPageBlockDivider *var);
+struct TdPageBlockDivider *TdConvertFromInternal (const td::td_api::pageBlockDivider &from);
+std::string TdToString (struct TdPageBlockDivider *var);
+void TdDestroyObject (struct TdPageBlockDivider *var);
+void TdStackStorer (struct TdPageBlockDivider *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockAnchor> TdConvertToInternal (struct TdPageBlockAnchor *var);
+struct TdPageBlockAnchor *TdConvertFromInternal (const td::td_api::pageBlockAnchor &from);
+std::string TdToString (struct TdPageBlockAnchor *var);
+void TdDestroyObject (struct TdPageBlockAnchor *var);
+void TdStackStorer (struct TdPageBlockAnchor *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockList> TdConvertToInternal (struct TdPageBlockList *var);
+struct TdPageBlockList *TdConvertFromInternal (const td::td_api::pageBlockList &from);
+std::string TdToString (struct TdPageBlockList *var);
+void TdDestroyObject (struct TdPageBlockList *var);
+void TdStackStorer (struct TdPageBlockList *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockBlockQuote> TdConvertToInternal (struct TdPageBlockBlockQuote *var);
+struct TdPageBlockBlockQuote *TdConvertFromInternal (const td::td_api::pageBlockBlockQuote &from);
+std::string TdToString (struct TdPageBlockBlockQuote *var);
+void TdDestroyObject (struct TdPageBlockBlockQuote *var);
+void TdStackStorer (struct TdPageBlockBlockQuote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockPullQuote> TdConvertToInternal (struct TdPageBlockPullQuote *var);
+struct TdPageBlockPullQuote *TdConvertFromInternal (const td::td_api::pageBlockPullQuote &from);
+std::string TdToString (struct TdPageBlockPullQuote *var);
+void TdDestroyObject (struct TdPageBlockPullQuote *var);
+void TdStackStorer (struct TdPageBlockPullQuote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockAnimation> TdConvertToInternal (struct TdPageBlockAnimation *var);
+struct TdPageBlockAnimation *TdConvertFromInternal (const td::td_api::pageBlockAnimation &from);
+std::string TdToString (struct TdPageBlockAnimation *var);
+void TdDestroyObject (struct TdPageBlockAnimation *var);
+void TdStackStorer (struct TdPageBlockAnimation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockAudio> TdConvertToInternal (struct TdPageBlockAudio *var);
+struct TdPageBlockAudio *TdConvertFromInternal (const td::td_api::pageBlockAudio &from);
+std::string TdToString (struct TdPageBlockAudio *var);
+void TdDestroyObject (struct TdPageBlockAudio *var);
+void TdStackStorer (struct TdPageBlockAudio *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockPhoto> TdConvertToInternal (struct TdPageBlockPhoto *var);
+struct TdPageBlockPhoto *TdConvertFromInternal (const td::td_api::pageBlockPhoto &from);
+std::string TdToString (struct TdPageBlockPhoto *var);
+void TdDestroyObject (struct TdPageBlockPhoto *var);
+void TdStackStorer (struct TdPageBlockPhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockVideo> TdConvertToInternal (struct TdPageBlockVideo *var);
+struct TdPageBlockVideo *TdConvertFromInternal (const td::td_api::pageBlockVideo &from);
+std::string TdToString (struct TdPageBlockVideo *var);
+void TdDestroyObject (struct TdPageBlockVideo *var);
+void TdStackStorer (struct TdPageBlockVideo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockCover> TdConvertToInternal (struct TdPageBlockCover *var);
+struct TdPageBlockCover *TdConvertFromInternal (const td::td_api::pageBlockCover &from);
+std::string TdToString (struct TdPageBlockCover *var);
+void TdDestroyObject (struct TdPageBlockCover *var);
+void TdStackStorer (struct TdPageBlockCover *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockEmbedded> TdConvertToInternal (struct TdPageBlockEmbedded *var);
+struct TdPageBlockEmbedded *TdConvertFromInternal (const td::td_api::pageBlockEmbedded &from);
+std::string TdToString (struct TdPageBlockEmbedded *var);
+void TdDestroyObject (struct TdPageBlockEmbedded *var);
+void TdStackStorer (struct TdPageBlockEmbedded *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockEmbeddedPost> TdConvertToInternal (struct TdPageBlockEmbeddedPost *var);
+struct TdPageBlockEmbeddedPost *TdConvertFromInternal (const td::td_api::pageBlockEmbeddedPost &from);
+std::string TdToString (struct TdPageBlockEmbeddedPost *var);
+void TdDestroyObject (struct TdPageBlockEmbeddedPost *var);
+void TdStackStorer (struct TdPageBlockEmbeddedPost *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockCollage> TdConvertToInternal (struct TdPageBlockCollage *var);
+struct TdPageBlockCollage *TdConvertFromInternal (const td::td_api::pageBlockCollage &from);
+std::string TdToString (struct TdPageBlockCollage *var);
+void TdDestroyObject (struct TdPageBlockCollage *var);
+void TdStackStorer (struct TdPageBlockCollage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockSlideshow> TdConvertToInternal (struct TdPageBlockSlideshow *var);
+struct TdPageBlockSlideshow *TdConvertFromInternal (const td::td_api::pageBlockSlideshow &from);
+std::string TdToString (struct TdPageBlockSlideshow *var);
+void TdDestroyObject (struct TdPageBlockSlideshow *var);
+void TdStackStorer (struct TdPageBlockSlideshow *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pageBlockChatLink> TdConvertToInternal (struct TdPageBlockChatLink *var);
+struct TdPageBlockChatLink *TdConvertFromInternal (const td::td_api::pageBlockChatLink &from);
+std::string TdToString (struct TdPageBlockChatLink *var);
+void TdDestroyObject (struct TdPageBlockChatLink *var);
+void TdStackStorer (struct TdPageBlockChatLink *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::passwordRecoveryInfo> TdConvertToInternal (struct TdPasswordRecoveryInfo *var);
+struct TdPasswordRecoveryInfo *TdConvertFromInternal (const td::td_api::passwordRecoveryInfo &from);
+std::string TdToString (struct TdPasswordRecoveryInfo *var);
+void TdDestroyObject (struct TdPasswordRecoveryInfo *var);
+void TdStackStorer (struct TdPasswordRecoveryInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::passwordState> TdConvertToInternal (struct TdPasswordState *var);
+struct TdPasswordState *TdConvertFromInternal (const td::td_api::passwordState &from);
+std::string TdToString (struct TdPasswordState *var);
+void TdDestroyObject (struct TdPasswordState *var);
+void TdStackStorer (struct TdPasswordState *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::paymentForm> TdConvertToInternal (struct TdPaymentForm *var);
+struct TdPaymentForm *TdConvertFromInternal (const td::td_api::paymentForm &from);
+std::string TdToString (struct TdPaymentForm *var);
+void TdDestroyObject (struct TdPaymentForm *var);
+void TdStackStorer (struct TdPaymentForm *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::paymentReceipt> TdConvertToInternal (struct TdPaymentReceipt *var);
+struct TdPaymentReceipt *TdConvertFromInternal (const td::td_api::paymentReceipt &from);
+std::string TdToString (struct TdPaymentReceipt *var);
+void TdDestroyObject (struct TdPaymentReceipt *var);
+void TdStackStorer (struct TdPaymentReceipt *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::paymentResult> TdConvertToInternal (struct TdPaymentResult *var);
+struct TdPaymentResult *TdConvertFromInternal (const td::td_api::paymentResult &from);
+std::string TdToString (struct TdPaymentResult *var);
+void TdDestroyObject (struct TdPaymentResult *var);
+void TdStackStorer (struct TdPaymentResult *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::paymentsProviderStripe> TdConvertToInternal (struct TdPaymentsProviderStripe *var);
+struct TdPaymentsProviderStripe *TdConvertFromInternal (const td::td_api::paymentsProviderStripe &from);
+std::string TdToString (struct TdPaymentsProviderStripe *var);
+void TdDestroyObject (struct TdPaymentsProviderStripe *var);
+void TdStackStorer (struct TdPaymentsProviderStripe *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::photo> TdConvertToInternal (struct TdPhoto *var);
+struct TdPhoto *TdConvertFromInternal (const td::td_api::photo &from);
+std::string TdToString (struct TdPhoto *var);
+void TdDestroyObject (struct TdPhoto *var);
+void TdStackStorer (struct TdPhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::photoSize> TdConvertToInternal (struct TdPhotoSize *var);
+struct TdPhotoSize *TdConvertFromInternal (const td::td_api::photoSize &from);
+std::string TdToString (struct TdPhotoSize *var);
+void TdDestroyObject (struct TdPhotoSize *var);
+void TdStackStorer (struct TdPhotoSize *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::profilePhoto> TdConvertToInternal (struct TdProfilePhoto *var);
+struct TdProfilePhoto *TdConvertFromInternal (const td::td_api::profilePhoto &from);
+std::string TdToString (struct TdProfilePhoto *var);
+void TdDestroyObject (struct TdProfilePhoto *var);
+void TdStackStorer (struct TdProfilePhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::Proxy> TdConvertToInternal (struct TdProxy *var);
+struct TdProxy *TdConvertFromInternal (const td::td_api::Proxy &from);
+std::string TdToString (struct TdProxy *var);
+void TdDestroyObject (struct TdProxy *var);
+void TdStackStorer (struct TdProxy *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::proxyEmpty> TdConvertToInternal (struct TdProxyEmpty *var);
+struct TdProxyEmpty *TdConvertFromInternal (const td::td_api::proxyEmpty &from);
+std::string TdToString (struct TdProxyEmpty *var);
+void TdDestroyObject (struct TdProxyEmpty *var);
+void TdStackStorer (struct TdProxyEmpty *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::proxySocks5> TdConvertToInternal (struct TdProxySocks5 *var);
+struct TdProxySocks5 *TdConvertFromInternal (const td::td_api::proxySocks5 &from);
+std::string TdToString (struct TdProxySocks5 *var);
+void TdDestroyObject (struct TdProxySocks5 *var);
+void TdStackStorer (struct TdProxySocks5 *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::publicMessageLink> TdConvertToInternal (struct TdPublicMessageLink *var);
+struct TdPublicMessageLink *TdConvertFromInternal (const td::td_api::publicMessageLink &from);
+std::string TdToString (struct TdPublicMessageLink *var);
+void TdDestroyObject (struct TdPublicMessageLink *var);
+void TdStackStorer (struct TdPublicMessageLink *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::recoveryEmailAddress> TdConvertToInternal (struct TdRecoveryEmailAddress *var);
+struct TdRecoveryEmailAddress *TdConvertFromInternal (const td::td_api::recoveryEmailAddress &from);
+std::string TdToString (struct TdRecoveryEmailAddress *var);
+void TdDestroyObject (struct TdRecoveryEmailAddress *var);
+void TdStackStorer (struct TdRecoveryEmailAddress *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::remoteFile> TdConvertToInternal (struct TdRemoteFile *var);
+struct TdRemoteFile *TdConvertFromInternal (const td::td_api::remoteFile &from);
+std::string TdToString (struct TdRemoteFile *var);
+void TdDestroyObject (struct TdRemoteFile *var);
+void TdStackStorer (struct TdRemoteFile *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::ReplyMarkup> TdConvertToInternal (struct TdReplyMarkup *var);
+struct TdReplyMarkup *TdConvertFromInternal (const td::td_api::ReplyMarkup &from);
+std::string TdToString (struct TdReplyMarkup *var);
+void TdDestroyObject (struct TdReplyMarkup *var);
+void TdStackStorer (struct TdReplyMarkup *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::replyMarkupRemoveKeyboard> TdConvertToInternal (struct TdReplyMarkupRemoveKeyboard *var);
+struct TdReplyMarkupRemoveKeyboard *TdConvertFromInternal (const td::td_api::replyMarkupRemoveKeyboard &from);
+std::string TdToString (struct TdReplyMarkupRemoveKeyboard *var);
+void TdDestroyObject (struct TdReplyMarkupRemoveKeyboard *var);
+void TdStackStorer (struct TdReplyMarkupRemoveKeyboard *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::replyMarkupForceReply> TdConvertToInternal (struct TdReplyMarkupForceReply *var);
+struct TdReplyMarkupForceReply *TdConvertFromInternal (const td::td_api::replyMarkupForceReply &from);
+std::string TdToString (struct TdReplyMarkupForceReply *var);
+void TdDestroyObject (struct TdReplyMarkupForceReply *var);
+void TdStackStorer (struct TdReplyMarkupForceReply *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::replyMarkupShowKeyboard> TdConvertToInternal (struct TdReplyMarkupShowKeyboard *var);
+struct TdReplyMarkupShowKeyboard *TdConvertFromInternal (const td::td_api::replyMarkupShowKeyboard &from);
+std::string TdToString (struct TdReplyMarkupShowKeyboard *var);
+void TdDestroyObject (struct TdReplyMarkupShowKeyboard *var);
+void TdStackStorer (struct TdReplyMarkupShowKeyboard *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::replyMarkupInlineKeyboard> TdConvertToInternal (struct TdReplyMarkupInlineKeyboard *var);
+struct TdReplyMarkupInlineKeyboard *TdConvertFromInternal (const td::td_api::replyMarkupInlineKeyboard &from);
+std::string TdToString (struct TdReplyMarkupInlineKeyboard *var);
+void TdDestroyObject (struct TdReplyMarkupInlineKeyboard *var);
+void TdStackStorer (struct TdReplyMarkupInlineKeyboard *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::RichText> TdConvertToInternal (struct TdRichText *var);
+struct TdRichText *TdConvertFromInternal (const td::td_api::RichText &from);
+std::string TdToString (struct TdRichText *var);
+void TdDestroyObject (struct TdRichText *var);
+void TdStackStorer (struct TdRichText *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::richTextPlain> TdConvertToInternal (struct TdRichTextPlain *var);
+struct TdRichTextPlain *TdConvertFromInternal (const td::td_api::richTextPlain &from);
+std::string TdToString (struct TdRichTextPlain *var);
+void TdDestroyObject (struct TdRichTextPlain *var);
+void TdStackStorer (struct TdRichTextPlain *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::richTextBold> TdConvertToInternal (struct TdRichTextBold *var);
+struct TdRichTextBold *TdConvertFromInternal (const td::td_api::richTextBold &from);
+std::string TdToString (struct TdRichTextBold *var);
+void TdDestroyObject (struct TdRichTextBold *var);
+void TdStackStorer (struct TdRichTextBold *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::richTextItalic> TdConvertToInternal (struct TdRichTextItalic *var);
+struct TdRichTextItalic *TdConvertFromInternal (const td::td_api::richTextItalic &from);
+std::string TdToString (struct TdRichTextItalic *var);
+void TdDestroyObject (struct TdRichTextItalic *var);
+void TdStackStorer (struct TdRichTextItalic *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::richTextUnderline> TdConvertToInternal (struct TdRichTextUnderline *var);
+struct TdRichTextUnderline *TdConvertFromInternal (const td::td_api::richTextUnderline &from);
+std::string TdToString (struct TdRichTextUnderline *var);
+void TdDestroyObject (struct TdRichTextUnderline *var);
+void TdStackStorer (struct TdRichTextUnderline *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::richTextStrikethrough> TdConvertToInternal (struct TdRichTextStrikethrough *var);
+struct TdRichTextStrikethrough *TdConvertFromInternal (const td::td_api::richTextStrikethrough &from);
+std::string TdToString (struct TdRichTextStrikethrough *var);
+void TdDestroyObject (struct TdRichTextStrikethrough *var);
+void TdStackStorer (struct TdRichTextStrikethrough *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::richTextFixed> TdConvertToInternal (struct TdRichTextFixed *var);
+struct TdRichTextFixed *TdConvertFromInternal (const td::td_api::richTextFixed &from);
+std::string TdToString (struct TdRichTextFixed *var);
+void TdDestroyObject (struct TdRichTextFixed *var);
+void TdStackStorer (struct TdRichTextFixed *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::richTextUrl> TdConvertToInternal (struct TdRichTextUrl *var);
+struct TdRichTextUrl *TdConvertFromInternal (const td::td_api::richTextUrl &from);
+std::string TdToString (struct TdRichTextUrl *var);
+void TdDestroyObject (struct TdRichTextUrl *var);
+void TdStackStorer (struct TdRichTextUrl *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::richTextEmailAddress> TdConvertToInternal (struct TdRichTextEmailAddress *var);
+struct TdRichTextEmailAddress *TdConvertFromInternal (const td::td_api::richTextEmailAddress &from);
+std::string TdToString (struct TdRichTextEmailAddress *var);
+void TdDestroyObject (struct TdRichTextEmailAddress *var);
+void TdStackStorer (struct TdRichTextEmailAddress *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::richTexts> TdConvertToInternal (struct TdRichTexts *var);
+struct TdRichTexts *TdConvertFromInternal (const td::td_api::richTexts &from);
+std::string TdToString (struct TdRichTexts *var);
+void TdDestroyObject (struct TdRichTexts *var);
+void TdStackStorer (struct TdRichTexts *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::savedCredentials> TdConvertToInternal (struct TdSavedCredentials *var);
+struct TdSavedCredentials *TdConvertFromInternal (const td::td_api::savedCredentials &from);
+std::string TdToString (struct TdSavedCredentials *var);
+void TdDestroyObject (struct TdSavedCredentials *var);
+void TdStackStorer (struct TdSavedCredentials *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::SearchMessagesFilter> TdConvertToInternal (struct TdSearchMessagesFilter *var);
+struct TdSearchMessagesFilter *TdConvertFromInternal (const td::td_api::SearchMessagesFilter &from);
+std::string TdToString (struct TdSearchMessagesFilter *var);
+void TdDestroyObject (struct TdSearchMessagesFilter *var);
+void TdStackStorer (struct TdSearchMessagesFilter *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchMessagesFilterEmpty> TdConvertToInternal (struct TdSearchMessagesFilterEmpty *var);
+struct TdSearchMessagesFilterEmpty *TdConvertFromInternal (const td::td_api::searchMessagesFilterEmpty &from);
+std::string TdToString (struct TdSearchMessagesFilterEmpty *var);
+void TdDestroyObject (struct TdSearchMessagesFilterEmpty *var);
+void TdStackStorer (struct TdSearchMessagesFilterEmpty *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchMessagesFilterAnimation> TdConvertToInternal (struct TdSearchMessagesFilterAnimation *var);
+struct TdSearchMessagesFilterAnimation *TdConvertFromInternal (const td::td_api::searchMessagesFilterAnimation &from);
+std::string TdToString (struct TdSearchMessagesFilterAnimation *var);
+void TdDestroyObject (struct TdSearchMessagesFilterAnimation *var);
+void TdStackStorer (struct TdSearchMessagesFilterAnimation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchMessagesFilterAudio> TdConvertToInternal (struct TdSearchMessagesFilterAudio *var);
+struct TdSearchMessagesFilterAudio *TdConvertFromInternal (const td::td_api::searchMessagesFilterAudio &from);
+std::string TdToString (struct TdSearchMessagesFilterAudio *var);
+void TdDestroyObject (struct TdSearchMessagesFilterAudio *var);
+void TdStackStorer (struct TdSearchMessagesFilterAudio *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchMessagesFilterDocument> TdConvertToInternal (struct TdSearchMessagesFilterDocument *var);
+struct TdSearchMessagesFilterDocument *TdConvertFromInternal (const td::td_api::searchMessagesFilterDocument &from);
+std::string TdToString (struct TdSearchMessagesFilterDocument *var);
+void TdDestroyObject (struct TdSearchMessagesFilterDocument *var);
+void TdStackStorer (struct TdSearchMessagesFilterDocument *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchMessagesFilterPhoto> TdConvertToInternal (struct TdSearchMessagesFilterPhoto *var);
+struct TdSearchMessagesFilterPhoto *TdConvertFromInternal (const td::td_api::searchMessagesFilterPhoto &from);
+std::string TdToString (struct TdSearchMessagesFilterPhoto *var);
+void TdDestroyObject (struct TdSearchMessagesFilterPhoto *var);
+void TdStackStorer (struct TdSearchMessagesFilterPhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchMessagesFilterVideo> TdConvertToInternal (struct TdSearchMessagesFilterVideo *var);
+struct TdSearchMessagesFilterVideo *TdConvertFromInternal (const td::td_api::searchMessagesFilterVideo &from);
+std::string TdToString (struct TdSearchMessagesFilterVideo *var);
+void TdDestroyObject (struct TdSearchMessagesFilterVideo *var);
+void TdStackStorer (struct TdSearchMessagesFilterVideo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchMessagesFilterVoiceNote> TdConvertToInternal (struct TdSearchMessagesFilterVoiceNote *var);
+struct TdSearchMessagesFilterVoiceNote *TdConvertFromInternal (const td::td_api::searchMessagesFilterVoiceNote &from);
+std::string TdToString (struct TdSearchMessagesFilterVoiceNote *var);
+void TdDestroyObject (struct TdSearchMessagesFilterVoiceNote *var);
+void TdStackStorer (struct TdSearchMessagesFilterVoiceNote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchMessagesFilterPhotoAndVideo> TdConvertToInternal (struct TdSearchMessagesFilterPhotoAndVideo *var);
+struct TdSearchMessagesFilterPhotoAndVideo *TdConvertFromInternal (const td::td_api::searchMessagesFilterPhotoAndVideo &from);
+std::string TdToString (struct TdSearchMessagesFilterPhotoAndVideo *var);
+void TdDestroyObject (struct TdSearchMessagesFilterPhotoAndVideo *var);
+void TdStackStorer (struct TdSearchMessagesFilterPhotoAndVideo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchMessagesFilterUrl> TdConvertToInternal (struct TdSearchMessagesFilterUrl *var);
+struct TdSearchMessagesFilterUrl *TdConvertFromInternal (const td::td_api::searchMessagesFilterUrl &from);
+std::string TdToString (struct TdSearchMessagesFilterUrl *var);
+void TdDestroyObject (struct TdSearchMessagesFilterUrl *var);
+void TdStackStorer (struct TdSearchMessagesFilterUrl *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchMessagesFilterChatPhoto> TdConvertToInternal (struct TdSearchMessagesFilterChatPhoto *var);
+struct TdSearchMessagesFilterChatPhoto *TdConvertFromInternal (const td::td_api::searchMessagesFilterChatPhoto &from);
+std::string TdToString (struct TdSearchMessagesFilterChatPhoto *var);
+void TdDestroyObject (struct TdSearchMessagesFilterChatPhoto *var);
+void TdStackStorer (struct TdSearchMessagesFilterChatPhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchMessagesFilterCall> TdConvertToInternal (struct TdSearchMessagesFilterCall *var);
+struct TdSearchMessagesFilterCall *TdConvertFromInternal (const td::td_api::searchMessagesFilterCall &from);
+std::string TdToString (struct TdSearchMessagesFilterCall *var);
+void TdDestroyObject (struct TdSearchMessagesFilterCall *var);
+void TdStackStorer (struct TdSearchMessagesFilterCall *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchMessagesFilterMissedCall> TdConvertToInternal (struct TdSearchMessagesFilterMissedCall *var);
+struct TdSearchMessagesFilterMissedCall *TdConvertFromInternal (const td::td_api::searchMessagesFilterMissedCall &from);
+std::string TdToString (struct TdSearchMessagesFilterMissedCall *var);
+void TdDestroyObject (struct TdSearchMessagesFilterMissedCall *var);
+void TdStackStorer (struct TdSearchMessagesFilterMissedCall *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchMessagesFilterVideoNote> TdConvertToInternal (struct TdSearchMessagesFilterVideoNote *var);
+struct TdSearchMessagesFilterVideoNote *TdConvertFromInternal (const td::td_api::searchMessagesFilterVideoNote &from);
+std::string TdToString (struct TdSearchMessagesFilterVideoNote *var);
+void TdDestroyObject (struct TdSearchMessagesFilterVideoNote *var);
+void TdStackStorer (struct TdSearchMessagesFilterVideoNote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchMessagesFilterVoiceAndVideoNote> TdConvertToInternal (struct TdSearchMessagesFilterVoiceAndVideoNote *var);
+struct TdSearchMessagesFilterVoiceAndVideoNote *TdConvertFromInternal (const td::td_api::searchMessagesFilterVoiceAndVideoNote &from);
+std::string TdToString (struct TdSearchMessagesFilterVoiceAndVideoNote *var);
+void TdDestroyObject (struct TdSearchMessagesFilterVoiceAndVideoNote *var);
+void TdStackStorer (struct TdSearchMessagesFilterVoiceAndVideoNote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchMessagesFilterMention> TdConvertToInternal (struct TdSearchMessagesFilterMention *var);
+struct TdSearchMessagesFilterMention *TdConvertFromInternal (const td::td_api::searchMessagesFilterMention &from);
+std::string TdToString (struct TdSearchMessagesFilterMention *var);
+void TdDestroyObject (struct TdSearchMessagesFilterMention *var);
+void TdStackStorer (struct TdSearchMessagesFilterMention *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchMessagesFilterUnreadMention> TdConvertToInternal (struct TdSearchMessagesFilterUnreadMention *var);
+struct TdSearchMessagesFilterUnreadMention *TdConvertFromInternal (const td::td_api::searchMessagesFilterUnreadMention &from);
+std::string TdToString (struct TdSearchMessagesFilterUnreadMention *var);
+void TdDestroyObject (struct TdSearchMessagesFilterUnreadMention *var);
+void TdStackStorer (struct TdSearchMessagesFilterUnreadMention *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::secretChat> TdConvertToInternal (struct TdSecretChat *var);
+struct TdSecretChat *TdConvertFromInternal (const td::td_api::secretChat &from);
+std::string TdToString (struct TdSecretChat *var);
+void TdDestroyObject (struct TdSecretChat *var);
+void TdStackStorer (struct TdSecretChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::SecretChatState> TdConvertToInternal (struct TdSecretChatState *var);
+struct TdSecretChatState *TdConvertFromInternal (const td::td_api::SecretChatState &from);
+std::string TdToString (struct TdSecretChatState *var);
+void TdDestroyObject (struct TdSecretChatState *var);
+void TdStackStorer (struct TdSecretChatState *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::secretChatStatePending> TdConvertToInternal (struct TdSecretChatStatePending *var);
+struct TdSecretChatStatePending *TdConvertFromInternal (const td::td_api::secretChatStatePending &from);
+std::string TdToString (struct TdSecretChatStatePending *var);
+void TdDestroyObject (struct TdSecretChatStatePending *var);
+void TdStackStorer (struct TdSecretChatStatePending *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::secretChatStateReady> TdConvertToInternal (struct TdSecretChatStateReady *var);
+struct TdSecretChatStateReady *TdConvertFromInternal (const td::td_api::secretChatStateReady &from);
+std::string TdToString (struct TdSecretChatStateReady *var);
+void TdDestroyObject (struct TdSecretChatStateReady *var);
+void TdStackStorer (struct TdSecretChatStateReady *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::secretChatStateClosed> TdConvertToInternal (struct TdSecretChatStateClosed *var);
+struct TdSecretChatStateClosed *TdConvertFromInternal (const td::td_api::secretChatStateClosed &from);
+std::string TdToString (struct TdSecretChatStateClosed *var);
+void TdDestroyObject (struct TdSecretChatStateClosed *var);
+void TdStackStorer (struct TdSecretChatStateClosed *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::session> TdConvertToInternal (struct TdSession *var);
+struct TdSession *TdConvertFromInternal (const td::td_api::session &from);
+std::string TdToString (struct TdSession *var);
+void TdDestroyObject (struct TdSession *var);
+void TdStackStorer (struct TdSession *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::sessions> TdConvertToInternal (struct TdSessions *var);
+struct TdSessions *TdConvertFromInternal (const td::td_api::sessions &from);
+std::string TdToString (struct TdSessions *var);
+void TdDestroyObject (struct TdSessions *var);
+void TdStackStorer (struct TdSessions *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::shippingAddress> TdConvertToInternal (struct TdShippingAddress *var);
+struct TdShippingAddress *TdConvertFromInternal (const td::td_api::shippingAddress &from);
+std::string TdToString (struct TdShippingAddress *var);
+void TdDestroyObject (struct TdShippingAddress *var);
+void TdStackStorer (struct TdShippingAddress *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::shippingOption> TdConvertToInternal (struct TdShippingOption *var);
+struct TdShippingOption *TdConvertFromInternal (const td::td_api::shippingOption &from);
+std::string TdToString (struct TdShippingOption *var);
+void TdDestroyObject (struct TdShippingOption *var);
+void TdStackStorer (struct TdShippingOption *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::sticker> TdConvertToInternal (struct TdSticker *var);
+struct TdSticker *TdConvertFromInternal (const td::td_api::sticker &from);
+std::string TdToString (struct TdSticker *var);
+void TdDestroyObject (struct TdSticker *var);
+void TdStackStorer (struct TdSticker *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::stickerEmojis> TdConvertToInternal (struct TdStickerEmojis *var);
+struct TdStickerEmojis *TdConvertFromInternal (const td::td_api::stickerEmojis &from);
+std::string TdToString (struct TdStickerEmojis *var);
+void TdDestroyObject (struct TdStickerEmojis *var);
+void TdStackStorer (struct TdStickerEmojis *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::stickerSet> TdConvertToInternal (struct TdStickerSet *var);
+struct TdStickerSet *TdConvertFromInternal (const td::td_api::stickerSet &from);
+std::string TdToString (struct TdStickerSet *var);
+void TdDestroyObject (struct TdStickerSet *var);
+void TdStackStorer (struct TdStickerSet *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::stickerSetInfo> TdConvertToInternal (struct TdStickerSetInfo *var);
+struct TdStickerSetInfo *TdConvertFromInternal (const td::td_api::stickerSetInfo &from);
+std::string TdToString (struct TdStickerSetInfo *var);
+void TdDestroyObject (struct TdStickerSetInfo *var);
+void TdStackStorer (struct TdStickerSetInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::stickerSets> TdConvertToInternal (struct TdStickerSets *var);
+struct TdStickerSets *TdConvertFromInternal (const td::td_api::stickerSets &from);
+std::string TdToString (struct TdStickerSets *var);
+void TdDestroyObject (struct TdStickerSets *var);
+void TdStackStorer (struct TdStickerSets *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::stickers> TdConvertToInternal (struct TdStickers *var);
+struct TdStickers *TdConvertFromInternal (const td::td_api::stickers &from);
+std::string TdToString (struct TdStickers *var);
+void TdDestroyObject (struct TdStickers *var);
+void TdStackStorer (struct TdStickers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::storageStatistics> TdConvertToInternal (struct TdStorageStatistics *var);
+struct TdStorageStatistics *TdConvertFromInternal (const td::td_api::storageStatistics &from);
+std::string TdToString (struct TdStorageStatistics *var);
+void TdDestroyObject (struct TdStorageStatistics *var);
+void TdStackStorer (struct TdStorageStatistics *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::storageStatisticsByChat> TdConvertToInternal (struct TdStorageStatisticsByChat *var);
+struct TdStorageStatisticsByChat *TdConvertFromInternal (const td::td_api::storageStatisticsByChat &from);
+std::string TdToString (struct TdStorageStatisticsByChat *var);
+void TdDestroyObject (struct TdStorageStatisticsByChat *var);
+void TdStackStorer (struct TdStorageStatisticsByChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::storageStatisticsByFileType> TdConvertToInternal (struct TdStorageStatisticsByFileType *var);
+struct TdStorageStatisticsByFileType *TdConvertFromInternal (const td::td_api::storageStatisticsByFileType &from);
+std::string TdToString (struct TdStorageStatisticsByFileType *var);
+void TdDestroyObject (struct TdStorageStatisticsByFileType *var);
+void TdStackStorer (struct TdStorageStatisticsByFileType *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::storageStatisticsFast> TdConvertToInternal (struct TdStorageStatisticsFast *var);
+struct TdStorageStatisticsFast *TdConvertFromInternal (const td::td_api::storageStatisticsFast &from);
+std::string TdToString (struct TdStorageStatisticsFast *var);
+void TdDestroyObject (struct TdStorageStatisticsFast *var);
+void TdStackStorer (struct TdStorageStatisticsFast *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::supergroup> TdConvertToInternal (struct TdSupergroup *var);
+struct TdSupergroup *TdConvertFromInternal (const td::td_api::supergroup &from);
+std::string TdToString (struct TdSupergroup *var);
+void TdDestroyObject (struct TdSupergroup *var);
+void TdStackStorer (struct TdSupergroup *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::supergroupFullInfo> TdConvertToInternal (struct TdSupergroupFullInfo *var);
+struct TdSupergroupFullInfo *TdConvertFromInternal (const td::td_api::supergroupFullInfo &from);
+std::string TdToString (struct TdSupergroupFullInfo *var);
+void TdDestroyObject (struct TdSupergroupFullInfo *var);
+void TdStackStorer (struct TdSupergroupFullInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::SupergroupMembersFilter> TdConvertToInternal (struct TdSupergroupMembersFilter *var);
+struct TdSupergroupMembersFilter *TdConvertFromInternal (const td::td_api::SupergroupMembersFilter &from);
+std::string TdToString (struct TdSupergroupMembersFilter *var);
+void TdDestroyObject (struct TdSupergroupMembersFilter *var);
+void TdStackStorer (struct TdSupergroupMembersFilter *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::supergroupMembersFilterRecent> TdConvertToInternal (struct TdSupergroupMembersFilterRecent *var);
+struct TdSupergroupMembersFilterRecent *TdConvertFromInternal (const td::td_api::supergroupMembersFilterRecent &from);
+std::string TdToString (struct TdSupergroupMembersFilterRecent *var);
+void TdDestroyObject (struct TdSupergroupMembersFilterRecent *var);
+void TdStackStorer (struct TdSupergroupMembersFilterRecent *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::supergroupMembersFilterAdministrators> TdConvertToInternal (struct TdSupergroupMembersFilterAdministrators *var);
+struct TdSupergroupMembersFilterAdministrators *TdConvertFromInternal (const td::td_api::supergroupMembersFilterAdministrators &from);
+std::string TdToString (struct TdSupergroupMembersFilterAdministrators *var);
+void TdDestroyObject (struct TdSupergroupMembersFilterAdministrators *var);
+void TdStackStorer (struct TdSupergroupMembersFilterAdministrators *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::supergroupMembersFilterSearch> TdConvertToInternal (struct TdSupergroupMembersFilterSearch *var);
+struct TdSupergroupMembersFilterSearch *TdConvertFromInternal (const td::td_api::supergroupMembersFilterSearch &from);
+std::string TdToString (struct TdSupergroupMembersFilterSearch *var);
+void TdDestroyObject (struct TdSupergroupMembersFilterSearch *var);
+void TdStackStorer (struct TdSupergroupMembersFilterSearch *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::supergroupMembersFilterRestricted> TdConvertToInternal (struct TdSupergroupMembersFilterRestricted *var);
+struct TdSupergroupMembersFilterRestricted *TdConvertFromInternal (const td::td_api::supergroupMembersFilterRestricted &from);
+std::string TdToString (struct TdSupergroupMembersFilterRestricted *var);
+void TdDestroyObject (struct TdSupergroupMembersFilterRestricted *var);
+void TdStackStorer (struct TdSupergroupMembersFilterRestricted *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::supergroupMembersFilterBanned> TdConvertToInternal (struct TdSupergroupMembersFilterBanned *var);
+struct TdSupergroupMembersFilterBanned *TdConvertFromInternal (const td::td_api::supergroupMembersFilterBanned &from);
+std::string TdToString (struct TdSupergroupMembersFilterBanned *var);
+void TdDestroyObject (struct TdSupergroupMembersFilterBanned *var);
+void TdStackStorer (struct TdSupergroupMembersFilterBanned *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::supergroupMembersFilterBots> TdConvertToInternal (struct TdSupergroupMembersFilterBots *var);
+struct TdSupergroupMembersFilterBots *TdConvertFromInternal (const td::td_api::supergroupMembersFilterBots &from);
+std::string TdToString (struct TdSupergroupMembersFilterBots *var);
+void TdDestroyObject (struct TdSupergroupMembersFilterBots *var);
+void TdStackStorer (struct TdSupergroupMembersFilterBots *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::tMeUrl> TdConvertToInternal (struct TdTMeUrl *var);
+struct TdTMeUrl *TdConvertFromInternal (const td::td_api::tMeUrl &from);
+std::string TdToString (struct TdTMeUrl *var);
+void TdDestroyObject (struct TdTMeUrl *var);
+void TdStackStorer (struct TdTMeUrl *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::TMeUrlType> TdConvertToInternal (struct TdTMeUrlType *var);
+struct TdTMeUrlType *TdConvertFromInternal (const td::td_api::TMeUrlType &from);
+std::string TdToString (struct TdTMeUrlType *var);
+void TdDestroyObject (struct TdTMeUrlType *var);
+void TdStackStorer (struct TdTMeUrlType *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::tMeUrlTypeUser> TdConvertToInternal (struct TdTMeUrlTypeUser *var);
+struct TdTMeUrlTypeUser *TdConvertFromInternal (const td::td_api::tMeUrlTypeUser &from);
+std::string TdToString (struct TdTMeUrlTypeUser *var);
+void TdDestroyObject (struct TdTMeUrlTypeUser *var);
+void TdStackStorer (struct TdTMeUrlTypeUser *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::tMeUrlTypeSupergroup> TdConvertToInternal (struct TdTMeUrlTypeSupergroup *var);
+struct TdTMeUrlTypeSupergroup *TdConvertFromInternal (const td::td_api::tMeUrlTypeSupergroup &from);
+std::string TdToString (struct TdTMeUrlTypeSupergroup *var);
+void TdDestroyObject (struct TdTMeUrlTypeSupergroup *var);
+void TdStackStorer (struct TdTMeUrlTypeSupergroup *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::tMeUrlTypeChatInvite> TdConvertToInternal (struct TdTMeUrlTypeChatInvite *var);
+struct TdTMeUrlTypeChatInvite *TdConvertFromInternal (const td::td_api::tMeUrlTypeChatInvite &from);
+std::string TdToString (struct TdTMeUrlTypeChatInvite *var);
+void TdDestroyObject (struct TdTMeUrlTypeChatInvite *var);
+void TdStackStorer (struct TdTMeUrlTypeChatInvite *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::tMeUrlTypeStickerSet> TdConvertToInternal (struct TdTMeUrlTypeStickerSet *var);
+struct TdTMeUrlTypeStickerSet *TdConvertFromInternal (const td::td_api::tMeUrlTypeStickerSet &from);
+std::string TdToString (struct TdTMeUrlTypeStickerSet *var);
+void TdDestroyObject (struct TdTMeUrlTypeStickerSet *var);
+void TdStackStorer (struct TdTMeUrlTypeStickerSet *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::tMeUrls> TdConvertToInternal (struct TdTMeUrls *var);
+struct TdTMeUrls *TdConvertFromInternal (const td::td_api::tMeUrls &from);
+std::string TdToString (struct TdTMeUrls *var);
+void TdDestroyObject (struct TdTMeUrls *var);
+void TdStackStorer (struct TdTMeUrls *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::tdlibParameters> TdConvertToInternal (struct TdTdlibParameters *var);
+struct TdTdlibParameters *TdConvertFromInternal (const td::td_api::tdlibParameters &from);
+std::string TdToString (struct TdTdlibParameters *var);
+void TdDestroyObject (struct TdTdlibParameters *var);
+void TdStackStorer (struct TdTdlibParameters *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::temporaryPasswordState> TdConvertToInternal (struct TdTemporaryPasswordState *var);
+struct TdTemporaryPasswordState *TdConvertFromInternal (const td::td_api::temporaryPasswordState &from);
+std::string TdToString (struct TdTemporaryPasswordState *var);
+void TdDestroyObject (struct TdTemporaryPasswordState *var);
+void TdStackStorer (struct TdTemporaryPasswordState *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testBytes> TdConvertToInternal (struct TdTestBytes *var);
+struct TdTestBytes *TdConvertFromInternal (const td::td_api::testBytes &from);
+std::string TdToString (struct TdTestBytes *var);
+void TdDestroyObject (struct TdTestBytes *var);
+void TdStackStorer (struct TdTestBytes *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testInt> TdConvertToInternal (struct TdTestInt *var);
+struct TdTestInt *TdConvertFromInternal (const td::td_api::testInt &from);
+std::string TdToString (struct TdTestInt *var);
+void TdDestroyObject (struct TdTestInt *var);
+void TdStackStorer (struct TdTestInt *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testString> TdConvertToInternal (struct TdTestString *var);
+struct TdTestString *TdConvertFromInternal (const td::td_api::testString &from);
+std::string TdToString (struct TdTestString *var);
+void TdDestroyObject (struct TdTestString *var);
+void TdStackStorer (struct TdTestString *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testVectorInt> TdConvertToInternal (struct TdTestVectorInt *var);
+struct TdTestVectorInt *TdConvertFromInternal (const td::td_api::testVectorInt &from);
+std::string TdToString (struct TdTestVectorInt *var);
+void TdDestroyObject (struct TdTestVectorInt *var);
+void TdStackStorer (struct TdTestVectorInt *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testVectorIntObject> TdConvertToInternal (struct TdTestVectorIntObject *var);
+struct TdTestVectorIntObject *TdConvertFromInternal (const td::td_api::testVectorIntObject &from);
+std::string TdToString (struct TdTestVectorIntObject *var);
+void TdDestroyObject (struct TdTestVectorIntObject *var);
+void TdStackStorer (struct TdTestVectorIntObject *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testVectorString> TdConvertToInternal (struct TdTestVectorString *var);
+struct TdTestVectorString *TdConvertFromInternal (const td::td_api::testVectorString &from);
+std::string TdToString (struct TdTestVectorString *var);
+void TdDestroyObject (struct TdTestVectorString *var);
+void TdStackStorer (struct TdTestVectorString *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testVectorStringObject> TdConvertToInternal (struct TdTestVectorStringObject *var);
+struct TdTestVectorStringObject *TdConvertFromInternal (const td::td_api::testVectorStringObject &from);
+std::string TdToString (struct TdTestVectorStringObject *var);
+void TdDestroyObject (struct TdTestVectorStringObject *var);
+void TdStackStorer (struct TdTestVectorStringObject *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::text> TdConvertToInternal (struct TdText *var);
+struct TdText *TdConvertFromInternal (const td::td_api::text &from);
+std::string TdToString (struct TdText *var);
+void TdDestroyObject (struct TdText *var);
+void TdStackStorer (struct TdText *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::textEntities> TdConvertToInternal (struct TdTextEntities *var);
+struct TdTextEntities *TdConvertFromInternal (const td::td_api::textEntities &from);
+std::string TdToString (struct TdTextEntities *var);
+void TdDestroyObject (struct TdTextEntities *var);
+void TdStackStorer (struct TdTextEntities *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::textEntity> TdConvertToInternal (struct TdTextEntity *var);
+struct TdTextEntity *TdConvertFromInternal (const td::td_api::textEntity &from);
+std::string TdToString (struct TdTextEntity *var);
+void TdDestroyObject (struct TdTextEntity *var);
+void TdStackStorer (struct TdTextEntity *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::TextEntityType> TdConvertToInternal (struct TdTextEntityType *var);
+struct TdTextEntityType *TdConvertFromInternal (const td::td_api::TextEntityType &from);
+std::string TdToString (struct TdTextEntityType *var);
+void TdDestroyObject (struct TdTextEntityType *var);
+void TdStackStorer (struct TdTextEntityType *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::textEntityTypeMention> TdConvertToInternal (struct TdTextEntityTypeMention *var);
+struct TdTextEntityTypeMention *TdConvertFromInternal (const td::td_api::textEntityTypeMention &from);
+std::string TdToString (struct TdTextEntityTypeMention *var);
+void TdDestroyObject (struct TdTextEntityTypeMention *var);
+void TdStackStorer (struct TdTextEntityTypeMention *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::textEntityTypeHashtag> TdConvertToInternal (struct TdTextEntityTypeHashtag *var);
+struct TdTextEntityTypeHashtag *TdConvertFromInternal (const td::td_api::textEntityTypeHashtag &from);
+std::string TdToString (struct TdTextEntityTypeHashtag *var);
+void TdDestroyObject (struct TdTextEntityTypeHashtag *var);
+void TdStackStorer (struct TdTextEntityTypeHashtag *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::textEntityTypeBotCommand> TdConvertToInternal (struct TdTextEntityTypeBotCommand *var);
+struct TdTextEntityTypeBotCommand *TdConvertFromInternal (const td::td_api::textEntityTypeBotCommand &from);
+std::string TdToString (struct TdTextEntityTypeBotCommand *var);
+void TdDestroyObject (struct TdTextEntityTypeBotCommand *var);
+void TdStackStorer (struct TdTextEntityTypeBotCommand *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::textEntityTypeUrl> TdConvertToInternal (struct TdTextEntityTypeUrl *var);
+struct TdTextEntityTypeUrl *TdConvertFromInternal (const td::td_api::textEntityTypeUrl &from);
+std::string TdToString (struct TdTextEntityTypeUrl *var);
+void TdDestroyObject (struct TdTextEntityTypeUrl *var);
+void TdStackStorer (struct TdTextEntityTypeUrl *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::textEntityTypeEmailAddress> TdConvertToInternal (struct TdTextEntityTypeEmailAddress *var);
+struct TdTextEntityTypeEmailAddress *TdConvertFromInternal (const td::td_api::textEntityTypeEmailAddress &from);
+std::string TdToString (struct TdTextEntityTypeEmailAddress *var);
+void TdDestroyObject (struct TdTextEntityTypeEmailAddress *var);
+void TdStackStorer (struct TdTextEntityTypeEmailAddress *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::textEntityTypeBold> TdConvertToInternal (struct TdTextEntityTypeBold *var);
+struct TdTextEntityTypeBold *TdConvertFromInternal (const td::td_api::textEntityTypeBold &from);
+std::string TdToString (struct TdTextEntityTypeBold *var);
+void TdDestroyObject (struct TdTextEntityTypeBold *var);
+void TdStackStorer (struct TdTextEntityTypeBold *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::textEntityTypeItalic> TdConvertToInternal (struct TdTextEntityTypeItalic *var);
+struct TdTextEntityTypeItalic *TdConvertFromInternal (const td::td_api::textEntityTypeItalic &from);
+std::string TdToString (struct TdTextEntityTypeItalic *var);
+void TdDestroyObject (struct TdTextEntityTypeItalic *var);
+void TdStackStorer (struct TdTextEntityTypeItalic *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::textEntityTypeCode> TdConvertToInternal (struct TdTextEntityTypeCode *var);
+struct TdTextEntityTypeCode *TdConvertFromInternal (const td::td_api::textEntityTypeCode &from);
+std::string TdToString (struct TdTextEntityTypeCode *var);
+void TdDestroyObject (struct TdTextEntityTypeCode *var);
+void TdStackStorer (struct TdTextEntityTypeCode *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::textEntityTypePre> TdConvertToInternal (struct TdTextEntityTypePre *var);
+struct TdTextEntityTypePre *TdConvertFromInternal (const td::td_api::textEntityTypePre &from);
+std::string TdToString (struct TdTextEntityTypePre *var);
+void TdDestroyObject (struct TdTextEntityTypePre *var);
+void TdStackStorer (struct TdTextEntityTypePre *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::textEntityTypePreCode> TdConvertToInternal (struct TdTextEntityTypePreCode *var);
+struct TdTextEntityTypePreCode *TdConvertFromInternal (const td::td_api::textEntityTypePreCode &from);
+std::string TdToString (struct TdTextEntityTypePreCode *var);
+void TdDestroyObject (struct TdTextEntityTypePreCode *var);
+void TdStackStorer (struct TdTextEntityTypePreCode *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::textEntityTypeTextUrl> TdConvertToInternal (struct TdTextEntityTypeTextUrl *var);
+struct TdTextEntityTypeTextUrl *TdConvertFromInternal (const td::td_api::textEntityTypeTextUrl &from);
+std::string TdToString (struct TdTextEntityTypeTextUrl *var);
+void TdDestroyObject (struct TdTextEntityTypeTextUrl *var);
+void TdStackStorer (struct TdTextEntityTypeTextUrl *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::textEntityTypeMentionName> TdConvertToInternal (struct TdTextEntityTypeMentionName *var);
+struct TdTextEntityTypeMentionName *TdConvertFromInternal (const td::td_api::textEntityTypeMentionName &from);
+std::string TdToString (struct TdTextEntityTypeMentionName *var);
+void TdDestroyObject (struct TdTextEntityTypeMentionName *var);
+void TdStackStorer (struct TdTextEntityTypeMentionName *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::TextParseMode> TdConvertToInternal (struct TdTextParseMode *var);
+struct TdTextParseMode *TdConvertFromInternal (const td::td_api::TextParseMode &from);
+std::string TdToString (struct TdTextParseMode *var);
+void TdDestroyObject (struct TdTextParseMode *var);
+void TdStackStorer (struct TdTextParseMode *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::textParseModeMarkdown> TdConvertToInternal (struct TdTextParseModeMarkdown *var);
+struct TdTextParseModeMarkdown *TdConvertFromInternal (const td::td_api::textParseModeMarkdown &from);
+std::string TdToString (struct TdTextParseModeMarkdown *var);
+void TdDestroyObject (struct TdTextParseModeMarkdown *var);
+void TdStackStorer (struct TdTextParseModeMarkdown *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::textParseModeHTML> TdConvertToInternal (struct TdTextParseModeHTML *var);
+struct TdTextParseModeHTML *TdConvertFromInternal (const td::td_api::textParseModeHTML &from);
+std::string TdToString (struct TdTextParseModeHTML *var);
+void TdDestroyObject (struct TdTextParseModeHTML *var);
+void TdStackStorer (struct TdTextParseModeHTML *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::TopChatCategory> TdConvertToInternal (struct TdTopChatCategory *var);
+struct TdTopChatCategory *TdConvertFromInternal (const td::td_api::TopChatCategory &from);
+std::string TdToString (struct TdTopChatCategory *var);
+void TdDestroyObject (struct TdTopChatCategory *var);
+void TdStackStorer (struct TdTopChatCategory *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::topChatCategoryUsers> TdConvertToInternal (struct TdTopChatCategoryUsers *var);
+struct TdTopChatCategoryUsers *TdConvertFromInternal (const td::td_api::topChatCategoryUsers &from);
+std::string TdToString (struct TdTopChatCategoryUsers *var);
+void TdDestroyObject (struct TdTopChatCategoryUsers *var);
+void TdStackStorer (struct TdTopChatCategoryUsers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::topChatCategoryBots> TdConvertToInternal (struct TdTopChatCategoryBots *var);
+struct TdTopChatCategoryBots *TdConvertFromInternal (const td::td_api::topChatCategoryBots &from);
+std::string TdToString (struct TdTopChatCategoryBots *var);
+void TdDestroyObject (struct TdTopChatCategoryBots *var);
+void TdStackStorer (struct TdTopChatCategoryBots *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::topChatCategoryGroups> TdConvertToInternal (struct TdTopChatCategoryGroups *var);
+struct TdTopChatCategoryGroups *TdConvertFromInternal (const td::td_api::topChatCategoryGroups &from);
+std::string TdToString (struct TdTopChatCategoryGroups *var);
+void TdDestroyObject (struct TdTopChatCategoryGroups *var);
+void TdStackStorer (struct TdTopChatCategoryGroups *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::topChatCategoryChannels> TdConvertToInternal (struct TdTopChatCategoryChannels *var);
+struct TdTopChatCategoryChannels *TdConvertFromInternal (const td::td_api::topChatCategoryChannels &from);
+std::string TdToString (struct TdTopChatCategoryChannels *var);
+void TdDestroyObject (struct TdTopChatCategoryChannels *var);
+void TdStackStorer (struct TdTopChatCategoryChannels *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::topChatCategoryInlineBots> TdConvertToInternal (struct TdTopChatCategoryInlineBots *var);
+struct TdTopChatCategoryInlineBots *TdConvertFromInternal (const td::td_api::topChatCategoryInlineBots &from);
+std::string TdToString (struct TdTopChatCategoryInlineBots *var);
+void TdDestroyObject (struct TdTopChatCategoryInlineBots *var);
+void TdStackStorer (struct TdTopChatCategoryInlineBots *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::topChatCategoryCalls> TdConvertToInternal (struct TdTopChatCategoryCalls *var);
+struct TdTopChatCategoryCalls *TdConvertFromInternal (const td::td_api::topChatCategoryCalls &from);
+std::string TdToString (struct TdTopChatCategoryCalls *var);
+void TdDestroyObject (struct TdTopChatCategoryCalls *var);
+void TdStackStorer (struct TdTopChatCategoryCalls *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::Update> TdConvertToInternal (struct TdUpdate *var);
+struct TdUpdate *TdConvertFromInternal (const td::td_api::Update &from);
+std::string TdToString (struct TdUpdate *var);
+void TdDestroyObject (struct TdUpdate *var);
+void TdStackStorer (struct TdUpdate *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateAuthorizationState> TdConvertToInternal (struct TdUpdateAuthorizationState *var);
+struct TdUpdateAuthorizationState *TdConvertFromInternal (const td::td_api::updateAuthorizationState &from);
+std::string TdToString (struct TdUpdateAuthorizationState *var);
+void TdDestroyObject (struct TdUpdateAuthorizationState *var);
+void TdStackStorer (struct TdUpdateAuthorizationState *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateNewMessage> TdConvertToInternal (struct TdUpdateNewMessage *var);
+struct TdUpdateNewMessage *TdConvertFromInternal (const td::td_api::updateNewMessage &from);
+std::string TdToString (struct TdUpdateNewMessage *var);
+void TdDestroyObject (struct TdUpdateNewMessage *var);
+void TdStackStorer (struct TdUpdateNewMessage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateMessageSendAcknowledged> TdConvertToInternal (struct TdUpdateMessageSendAcknowledged *var);
+struct TdUpdateMessageSendAcknowledged *TdConvertFromInternal (const td::td_api::updateMessageSendAcknowledged &from);
+std::string TdToString (struct TdUpdateMessageSendAcknowledged *var);
+void TdDestroyObject (struct TdUpdateMessageSendAcknowledged *var);
+void TdStackStorer (struct TdUpdateMessageSendAcknowledged *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateMessageSendSucceeded> TdConvertToInternal (struct TdUpdateMessageSendSucceeded *var);
+struct TdUpdateMessageSendSucceeded *TdConvertFromInternal (const td::td_api::updateMessageSendSucceeded &from);
+std::string TdToString (struct TdUpdateMessageSendSucceeded *var);
+void TdDestroyObject (struct TdUpdateMessageSendSucceeded *var);
+void TdStackStorer (struct TdUpdateMessageSendSucceeded *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateMessageSendFailed> TdConvertToInternal (struct TdUpdateMessageSendFailed *var);
+struct TdUpdateMessageSendFailed *TdConvertFromInternal (const td::td_api::updateMessageSendFailed &from);
+std::string TdToString (struct TdUpdateMessageSendFailed *var);
+void TdDestroyObject (struct TdUpdateMessageSendFailed *var);
+void TdStackStorer (struct TdUpdateMessageSendFailed *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateMessageContent> TdConvertToInternal (struct TdUpdateMessageContent *var);
+struct TdUpdateMessageContent *TdConvertFromInternal (const td::td_api::updateMessageContent &from);
+std::string TdToString (struct TdUpdateMessageContent *var);
+void TdDestroyObject (struct TdUpdateMessageContent *var);
+void TdStackStorer (struct TdUpdateMessageContent *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateMessageEdited> TdConvertToInternal (struct TdUpdateMessageEdited *var);
+struct TdUpdateMessageEdited *TdConvertFromInternal (const td::td_api::updateMessageEdited &from);
+std::string TdToString (struct TdUpdateMessageEdited *var);
+void TdDestroyObject (struct TdUpdateMessageEdited *var);
+void TdStackStorer (struct TdUpdateMessageEdited *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateMessageViews> TdConvertToInternal (struct TdUpdateMessageViews *var);
+struct TdUpdateMessageViews *TdConvertFromInternal (const td::td_api::updateMessageViews &from);
+std::string TdToString (struct TdUpdateMessageViews *var);
+void TdDestroyObject (struct TdUpdateMessageViews *var);
+void TdStackStorer (struct TdUpdateMessageViews *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateMessageContentOpened> TdConvertToInternal (struct TdUpdateMessageContentOpened *var);
+struct TdUpdateMessageContentOpened *TdConvertFromInternal (const td::td_api::updateMessageContentOpened &from);
+std::string TdToString (struct TdUpdateMessageContentOpened *var);
+void TdDestroyObject (struct TdUpdateMessageContentOpened *var);
+void TdStackStorer (struct TdUpdateMessageContentOpened *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateMessageMentionRead> TdConvertToInternal (struct TdUpdateMessageMentionRead *var);
+struct TdUpdateMessageMentionRead *TdConvertFromInternal (const td::td_api::updateMessageMentionRead &from);
+std::string TdToString (struct TdUpdateMessageMentionRead *var);
+void TdDestroyObject (struct TdUpdateMessageMentionRead *var);
+void TdStackStorer (struct TdUpdateMessageMentionRead *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateNewChat> TdConvertToInternal (struct TdUpdateNewChat *var);
+struct TdUpdateNewChat *TdConvertFromInternal (const td::td_api::updateNewChat &from);
+std::string TdToString (struct TdUpdateNewChat *var);
+void TdDestroyObject (struct TdUpdateNewChat *var);
+void TdStackStorer (struct TdUpdateNewChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateChatTitle> TdConvertToInternal (struct TdUpdateChatTitle *var);
+struct TdUpdateChatTitle *TdConvertFromInternal (const td::td_api::updateChatTitle &from);
+std::string TdToString (struct TdUpdateChatTitle *var);
+void TdDestroyObject (struct TdUpdateChatTitle *var);
+void TdStackStorer (struct TdUpdateChatTitle *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateChatPhoto> TdConvertToInternal (struct TdUpdateChatPhoto *var);
+struct TdUpdateChatPhoto *TdConvertFromInternal (const td::td_api::updateChatPhoto &from);
+std::string TdToString (struct TdUpdateChatPhoto *var);
+void TdDestroyObject (struct TdUpdateChatPhoto *var);
+void TdStackStorer (struct TdUpdateChatPhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateChatLastMessage> TdConvertToInternal (struct TdUpdateChatLastMessage *var);
+struct TdUpdateChatLastMessage *TdConvertFromInternal (const td::td_api::updateChatLastMessage &from);
+std::string TdToString (struct TdUpdateChatLastMessage *var);
+void TdDestroyObject (struct TdUpdateChatLastMessage *var);
+void TdStackStorer (struct TdUpdateChatLastMessage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateChatOrder> TdConvertToInternal (struct TdUpdateChatOrder *var);
+struct TdUpdateChatOrder *TdConvertFromInternal (const td::td_api::updateChatOrder &from);
+std::string TdToString (struct TdUpdateChatOrder *var);
+void TdDestroyObject (struct TdUpdateChatOrder *var);
+void TdStackStorer (struct TdUpdateChatOrder *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateChatIsPinned> TdConvertToInternal (struct TdUpdateChatIsPinned *var);
+struct TdUpdateChatIsPinned *TdConvertFromInternal (const td::td_api::updateChatIsPinned &from);
+std::string TdToString (struct TdUpdateChatIsPinned *var);
+void TdDestroyObject (struct TdUpdateChatIsPinned *var);
+void TdStackStorer (struct TdUpdateChatIsPinned *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateChatReadInbox> TdConvertToInternal (struct TdUpdateChatReadInbox *var);
+struct TdUpdateChatReadInbox *TdConvertFromInternal (const td::td_api::updateChatReadInbox &from);
+std::string TdToString (struct TdUpdateChatReadInbox *var);
+void TdDestroyObject (struct TdUpdateChatReadInbox *var);
+void TdStackStorer (struct TdUpdateChatReadInbox *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateChatReadOutbox> TdConvertToInternal (struct TdUpdateChatReadOutbox *var);
+struct TdUpdateChatReadOutbox *TdConvertFromInternal (const td::td_api::updateChatReadOutbox &from);
+std::string TdToString (struct TdUpdateChatReadOutbox *var);
+void TdDestroyObject (struct TdUpdateChatReadOutbox *var);
+void TdStackStorer (struct TdUpdateChatReadOutbox *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateChatUnreadMentionCount> TdConvertToInternal (struct TdUpdateChatUnreadMentionCount *var);
+struct TdUpdateChatUnreadMentionCount *TdConvertFromInternal (const td::td_api::updateChatUnreadMentionCount &from);
+std::string TdToString (struct TdUpdateChatUnreadMentionCount *var);
+void TdDestroyObject (struct TdUpdateChatUnreadMentionCount *var);
+void TdStackStorer (struct TdUpdateChatUnreadMentionCount *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateNotificationSettings> TdConvertToInternal (struct TdUpdateNotificationSettings *var);
+struct TdUpdateNotificationSettings *TdConvertFromInternal (const td::td_api::updateNotificationSettings &from);
+std::string TdToString (struct TdUpdateNotificationSettings *var);
+void TdDestroyObject (struct TdUpdateNotificationSettings *var);
+void TdStackStorer (struct TdUpdateNotificationSettings *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateChatReplyMarkup> TdConvertToInternal (struct TdUpdateChatReplyMarkup *var);
+struct TdUpdateChatReplyMarkup *TdConvertFromInternal (const td::td_api::updateChatReplyMarkup &from);
+std::string TdToString (struct TdUpdateChatReplyMarkup *var);
+void TdDestroyObject (struct TdUpdateChatReplyMarkup *var);
+void TdStackStorer (struct TdUpdateChatReplyMarkup *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateChatDraftMessage> TdConvertToInternal (struct TdUpdateChatDraftMessage *var);
+struct TdUpdateChatDraftMessage *TdConvertFromInternal (const td::td_api::updateChatDraftMessage &from);
+std::string TdToString (struct TdUpdateChatDraftMessage *var);
+void TdDestroyObject (struct TdUpdateChatDraftMessage *var);
+void TdStackStorer (struct TdUpdateChatDraftMessage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateDeleteMessages> TdConvertToInternal (struct TdUpdateDeleteMessages *var);
+struct TdUpdateDeleteMessages *TdConvertFromInternal (const td::td_api::updateDeleteMessages &from);
+std::string TdToString (struct TdUpdateDeleteMessages *var);
+void TdDestroyObject (struct TdUpdateDeleteMessages *var);
+void TdStackStorer (struct TdUpdateDeleteMessages *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateUserChatAction> TdConvertToInternal (struct TdUpdateUserChatAction *var);
+struct TdUpdateUserChatAction *TdConvertFromInternal (const td::td_api::updateUserChatAction &from);
+std::string TdToString (struct TdUpdateUserChatAction *var);
+void TdDestroyObject (struct TdUpdateUserChatAction *var);
+void TdStackStorer (struct TdUpdateUserChatAction *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateUserStatus> TdConvertToInternal (struct TdUpdateUserStatus *var);
+struct TdUpdateUserStatus *TdConvertFromInternal (const td::td_api::updateUserStatus &from);
+std::string TdToString (struct TdUpdateUserStatus *var);
+void TdDestroyObject (struct TdUpdateUserStatus *var);
+void TdStackStorer (struct TdUpdateUserStatus *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateUser> TdConvertToInternal (struct TdUpdateUser *var);
+struct TdUpdateUser *TdConvertFromInternal (const td::td_api::updateUser &from);
+std::string TdToString (struct TdUpdateUser *var);
+void TdDestroyObject (struct TdUpdateUser *var);
+void TdStackStorer (struct TdUpdateUser *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateBasicGroup> TdConvertToInternal (struct TdUpdateBasicGroup *var);
+struct TdUpdateBasicGroup *TdConvertFromInternal (const td::td_api::updateBasicGroup &from);
+std::string TdToString (struct TdUpdateBasicGroup *var);
+void TdDestroyObject (struct TdUpdateBasicGroup *var);
+void TdStackStorer (struct TdUpdateBasicGroup *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateSupergroup> TdConvertToInternal (struct TdUpdateSupergroup *var);
+struct TdUpdateSupergroup *TdConvertFromInternal (const td::td_api::updateSupergroup &from);
+std::string TdToString (struct TdUpdateSupergroup *var);
+void TdDestroyObject (struct TdUpdateSupergroup *var);
+void TdStackStorer (struct TdUpdateSupergroup *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateSecretChat> TdConvertToInternal (struct TdUpdateSecretChat *var);
+struct TdUpdateSecretChat *TdConvertFromInternal (const td::td_api::updateSecretChat &from);
+std::string TdToString (struct TdUpdateSecretChat *var);
+void TdDestroyObject (struct TdUpdateSecretChat *var);
+void TdStackStorer (struct TdUpdateSecretChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateUserFullInfo> TdConvertToInternal (struct TdUpdateUserFullInfo *var);
+struct TdUpdateUserFullInfo *TdConvertFromInternal (const td::td_api::updateUserFullInfo &from);
+std::string TdToString (struct TdUpdateUserFullInfo *var);
+void TdDestroyObject (struct TdUpdateUserFullInfo *var);
+void TdStackStorer (struct TdUpdateUserFullInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateBasicGroupFullInfo> TdConvertToInternal (struct TdUpdateBasicGroupFullInfo *var);
+struct TdUpdateBasicGroupFullInfo *TdConvertFromInternal (const td::td_api::updateBasicGroupFullInfo &from);
+std::string TdToString (struct TdUpdateBasicGroupFullInfo *var);
+void TdDestroyObject (struct TdUpdateBasicGroupFullInfo *var);
+void TdStackStorer (struct TdUpdateBasicGroupFullInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateSupergroupFullInfo> TdConvertToInternal (struct TdUpdateSupergroupFullInfo *var);
+struct TdUpdateSupergroupFullInfo *TdConvertFromInternal (const td::td_api::updateSupergroupFullInfo &from);
+std::string TdToString (struct TdUpdateSupergroupFullInfo *var);
+void TdDestroyObject (struct TdUpdateSupergroupFullInfo *var);
+void TdStackStorer (struct TdUpdateSupergroupFullInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateServiceNotification> TdConvertToInternal (struct TdUpdateServiceNotification *var);
+struct TdUpdateServiceNotification *TdConvertFromInternal (const td::td_api::updateServiceNotification &from);
+std::string TdToString (struct TdUpdateServiceNotification *var);
+void TdDestroyObject (struct TdUpdateServiceNotification *var);
+void TdStackStorer (struct TdUpdateServiceNotification *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateFile> TdConvertToInternal (struct TdUpdateFile *var);
+struct TdUpdateFile *TdConvertFromInternal (const td::td_api::updateFile &from);
+std::string TdToString (struct TdUpdateFile *var);
+void TdDestroyObject (struct TdUpdateFile *var);
+void TdStackStorer (struct TdUpdateFile *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateFileGenerationStart> TdConvertToInternal (struct TdUpdateFileGenerationStart *var);
+struct TdUpdateFileGenerationStart *TdConvertFromInternal (const td::td_api::updateFileGenerationStart &from);
+std::string TdToString (struct TdUpdateFileGenerationStart *var);
+void TdDestroyObject (struct TdUpdateFileGenerationStart *var);
+void TdStackStorer (struct TdUpdateFileGenerationStart *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateFileGenerationStop> TdConvertToInternal (struct TdUpdateFileGenerationStop *var);
+struct TdUpdateFileGenerationStop *TdConvertFromInternal (const td::td_api::updateFileGenerationStop &from);
+std::string TdToString (struct TdUpdateFileGenerationStop *var);
+void TdDestroyObject (struct TdUpdateFileGenerationStop *var);
+void TdStackStorer (struct TdUpdateFileGenerationStop *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateCall> TdConvertToInternal (struct TdUpdateCall *var);
+struct TdUpdateCall *TdConvertFromInternal (const td::td_api::updateCall &from);
+std::string TdToString (struct TdUpdateCall *var);
+void TdDestroyObject (struct TdUpdateCall *var);
+void TdStackStorer (struct TdUpdateCall *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateUserPrivacySettingRules> TdConvertToInternal (struct TdUpdateUserPrivacySettingRules *var);
+struct TdUpdateUserPrivacySettingRules *TdConvertFromInternal (const td::td_api::updateUserPrivacySettingRules &from);
+std::string TdToString (struct TdUpdateUserPrivacySettingRules *var);
+void TdDestroyObject (struct TdUpdateUserPrivacySettingRules *var);
+void TdStackStorer (struct TdUpdateUserPrivacySettingRules *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateOption> TdConvertToInternal (struct TdUpdateOption *var);
+struct TdUpdateOption *TdConvertFromInternal (const td::td_api::updateOption &from);
+std::string TdToString (struct TdUpdateOption *var);
+void TdDestroyObject (struct TdUpdateOption *var);
+void TdStackStorer (struct TdUpdateOption *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateInstalledStickerSets> TdConvertToInternal (struct TdUpdateInstalledStickerSets *var);
+struct TdUpdateInstalledStickerSets *TdConvertFromInternal (const td::td_api::updateInstalledStickerSets &from);
+std::string TdToString (struct TdUpdateInstalledStickerSets *var);
+void TdDestroyObject (struct TdUpdateInstalledStickerSets *var);
+void TdStackStorer (struct TdUpdateInstalledStickerSets *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateTrendingStickerSets> TdConvertToInternal (struct TdUpdateTrendingStickerSets *var);
+struct TdUpdateTrendingStickerSets *TdConvertFromInternal (const td::td_api::updateTrendingStickerSets &from);
+std::string TdToString (struct TdUpdateTrendingStickerSets *var);
+void TdDestroyObject (struct TdUpdateTrendingStickerSets *var);
+void TdStackStorer (struct TdUpdateTrendingStickerSets *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateRecentStickers> TdConvertToInternal (struct TdUpdateRecentStickers *var);
+struct TdUpdateRecentStickers *TdConvertFromInternal (const td::td_api::updateRecentStickers &from);
+std::string TdToString (struct TdUpdateRecentStickers *var);
+void TdDestroyObject (struct TdUpdateRecentStickers *var);
+void TdStackStorer (struct TdUpdateRecentStickers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateFavoriteStickers> TdConvertToInternal (struct TdUpdateFavoriteStickers *var);
+struct TdUpdateFavoriteStickers *TdConvertFromInternal (const td::td_api::updateFavoriteStickers &from);
+std::string TdToString (struct TdUpdateFavoriteStickers *var);
+void TdDestroyObject (struct TdUpdateFavoriteStickers *var);
+void TdStackStorer (struct TdUpdateFavoriteStickers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateSavedAnimations> TdConvertToInternal (struct TdUpdateSavedAnimations *var);
+struct TdUpdateSavedAnimations *TdConvertFromInternal (const td::td_api::updateSavedAnimations &from);
+std::string TdToString (struct TdUpdateSavedAnimations *var);
+void TdDestroyObject (struct TdUpdateSavedAnimations *var);
+void TdStackStorer (struct TdUpdateSavedAnimations *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateConnectionState> TdConvertToInternal (struct TdUpdateConnectionState *var);
+struct TdUpdateConnectionState *TdConvertFromInternal (const td::td_api::updateConnectionState &from);
+std::string TdToString (struct TdUpdateConnectionState *var);
+void TdDestroyObject (struct TdUpdateConnectionState *var);
+void TdStackStorer (struct TdUpdateConnectionState *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateNewInlineQuery> TdConvertToInternal (struct TdUpdateNewInlineQuery *var);
+struct TdUpdateNewInlineQuery *TdConvertFromInternal (const td::td_api::updateNewInlineQuery &from);
+std::string TdToString (struct TdUpdateNewInlineQuery *var);
+void TdDestroyObject (struct TdUpdateNewInlineQuery *var);
+void TdStackStorer (struct TdUpdateNewInlineQuery *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateNewChosenInlineResult> TdConvertToInternal (struct TdUpdateNewChosenInlineResult *var);
+struct TdUpdateNewChosenInlineResult *TdConvertFromInternal (const td::td_api::updateNewChosenInlineResult &from);
+std::string TdToString (struct TdUpdateNewChosenInlineResult *var);
+void TdDestroyObject (struct TdUpdateNewChosenInlineResult *var);
+void TdStackStorer (struct TdUpdateNewChosenInlineResult *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateNewCallbackQuery> TdConvertToInternal (struct TdUpdateNewCallbackQuery *var);
+struct TdUpdateNewCallbackQuery *TdConvertFromInternal (const td::td_api::updateNewCallbackQuery &from);
+std::string TdToString (struct TdUpdateNewCallbackQuery *var);
+void TdDestroyObject (struct TdUpdateNewCallbackQuery *var);
+void TdStackStorer (struct TdUpdateNewCallbackQuery *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateNewInlineCallbackQuery> TdConvertToInternal (struct TdUpdateNewInlineCallbackQuery *var);
+struct TdUpdateNewInlineCallbackQuery *TdConvertFromInternal (const td::td_api::updateNewInlineCallbackQuery &from);
+std::string TdToString (struct TdUpdateNewInlineCallbackQuery *var);
+void TdDestroyObject (struct TdUpdateNewInlineCallbackQuery *var);
+void TdStackStorer (struct TdUpdateNewInlineCallbackQuery *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateNewShippingQuery> TdConvertToInternal (struct TdUpdateNewShippingQuery *var);
+struct TdUpdateNewShippingQuery *TdConvertFromInternal (const td::td_api::updateNewShippingQuery &from);
+std::string TdToString (struct TdUpdateNewShippingQuery *var);
+void TdDestroyObject (struct TdUpdateNewShippingQuery *var);
+void TdStackStorer (struct TdUpdateNewShippingQuery *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateNewPreCheckoutQuery> TdConvertToInternal (struct TdUpdateNewPreCheckoutQuery *var);
+struct TdUpdateNewPreCheckoutQuery *TdConvertFromInternal (const td::td_api::updateNewPreCheckoutQuery &from);
+std::string TdToString (struct TdUpdateNewPreCheckoutQuery *var);
+void TdDestroyObject (struct TdUpdateNewPreCheckoutQuery *var);
+void TdStackStorer (struct TdUpdateNewPreCheckoutQuery *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateNewCustomEvent> TdConvertToInternal (struct TdUpdateNewCustomEvent *var);
+struct TdUpdateNewCustomEvent *TdConvertFromInternal (const td::td_api::updateNewCustomEvent &from);
+std::string TdToString (struct TdUpdateNewCustomEvent *var);
+void TdDestroyObject (struct TdUpdateNewCustomEvent *var);
+void TdStackStorer (struct TdUpdateNewCustomEvent *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::updateNewCustomQuery> TdConvertToInternal (struct TdUpdateNewCustomQuery *var);
+struct TdUpdateNewCustomQuery *TdConvertFromInternal (const td::td_api::updateNewCustomQuery &from);
+std::string TdToString (struct TdUpdateNewCustomQuery *var);
+void TdDestroyObject (struct TdUpdateNewCustomQuery *var);
+void TdStackStorer (struct TdUpdateNewCustomQuery *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::user> TdConvertToInternal (struct TdUser *var);
+struct TdUser *TdConvertFromInternal (const td::td_api::user &from);
+std::string TdToString (struct TdUser *var);
+void TdDestroyObject (struct TdUser *var);
+void TdStackStorer (struct TdUser *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userFullInfo> TdConvertToInternal (struct TdUserFullInfo *var);
+struct TdUserFullInfo *TdConvertFromInternal (const td::td_api::userFullInfo &from);
+std::string TdToString (struct TdUserFullInfo *var);
+void TdDestroyObject (struct TdUserFullInfo *var);
+void TdStackStorer (struct TdUserFullInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::UserPrivacySetting> TdConvertToInternal (struct TdUserPrivacySetting *var);
+struct TdUserPrivacySetting *TdConvertFromInternal (const td::td_api::UserPrivacySetting &from);
+std::string TdToString (struct TdUserPrivacySetting *var);
+void TdDestroyObject (struct TdUserPrivacySetting *var);
+void TdStackStorer (struct TdUserPrivacySetting *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userPrivacySettingShowStatus> TdConvertToInternal (struct TdUserPrivacySettingShowStatus *var);
+struct TdUserPrivacySettingShowStatus *TdConvertFromInternal (const td::td_api::userPrivacySettingShowStatus &from);
+std::string TdToString (struct TdUserPrivacySettingShowStatus *var);
+void TdDestroyObject (struct TdUserPrivacySettingShowStatus *var);
+void TdStackStorer (struct TdUserPrivacySettingShowStatus *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userPrivacySettingAllowChatInvites> TdConvertToInternal (struct TdUserPrivacySettingAllowChatInvites *var);
+struct TdUserPrivacySettingAllowChatInvites *TdConvertFromInternal (const td::td_api::userPrivacySettingAllowChatInvites &from);
+std::string TdToString (struct TdUserPrivacySettingAllowChatInvites *var);
+void TdDestroyObject (struct TdUserPrivacySettingAllowChatInvites *var);
+void TdStackStorer (struct TdUserPrivacySettingAllowChatInvites *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userPrivacySettingAllowCalls> TdConvertToInternal (struct TdUserPrivacySettingAllowCalls *var);
+struct TdUserPrivacySettingAllowCalls *TdConvertFromInternal (const td::td_api::userPrivacySettingAllowCalls &from);
+std::string TdToString (struct TdUserPrivacySettingAllowCalls *var);
+void TdDestroyObject (struct TdUserPrivacySettingAllowCalls *var);
+void TdStackStorer (struct TdUserPrivacySettingAllowCalls *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::UserPrivacySettingRule> TdConvertToInternal (struct TdUserPrivacySettingRule *var);
+struct TdUserPrivacySettingRule *TdConvertFromInternal (const td::td_api::UserPrivacySettingRule &from);
+std::string TdToString (struct TdUserPrivacySettingRule *var);
+void TdDestroyObject (struct TdUserPrivacySettingRule *var);
+void TdStackStorer (struct TdUserPrivacySettingRule *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userPrivacySettingRuleAllowAll> TdConvertToInternal (struct TdUserPrivacySettingRuleAllowAll *var);
+struct TdUserPrivacySettingRuleAllowAll *TdConvertFromInternal (const td::td_api::userPrivacySettingRuleAllowAll &from);
+std::string TdToString (struct TdUserPrivacySettingRuleAllowAll *var);
+void TdDestroyObject (struct TdUserPrivacySettingRuleAllowAll *var);
+void TdStackStorer (struct TdUserPrivacySettingRuleAllowAll *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userPrivacySettingRuleAllowContacts> TdConvertToInternal (struct TdUserPrivacySettingRuleAllowContacts *var);
+struct TdUserPrivacySettingRuleAllowContacts *TdConvertFromInternal (const td::td_api::userPrivacySettingRuleAllowContacts &from);
+std::string TdToString (struct TdUserPrivacySettingRuleAllowContacts *var);
+void TdDestroyObject (struct TdUserPrivacySettingRuleAllowContacts *var);
+void TdStackStorer (struct TdUserPrivacySettingRuleAllowContacts *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userPrivacySettingRuleAllowUsers> TdConvertToInternal (struct TdUserPrivacySettingRuleAllowUsers *var);
+struct TdUserPrivacySettingRuleAllowUsers *TdConvertFromInternal (const td::td_api::userPrivacySettingRuleAllowUsers &from);
+std::string TdToString (struct TdUserPrivacySettingRuleAllowUsers *var);
+void TdDestroyObject (struct TdUserPrivacySettingRuleAllowUsers *var);
+void TdStackStorer (struct TdUserPrivacySettingRuleAllowUsers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userPrivacySettingRuleRestrictAll> TdConvertToInternal (struct TdUserPrivacySettingRuleRestrictAll *var);
+struct TdUserPrivacySettingRuleRestrictAll *TdConvertFromInternal (const td::td_api::userPrivacySettingRuleRestrictAll &from);
+std::string TdToString (struct TdUserPrivacySettingRuleRestrictAll *var);
+void TdDestroyObject (struct TdUserPrivacySettingRuleRestrictAll *var);
+void TdStackStorer (struct TdUserPrivacySettingRuleRestrictAll *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userPrivacySettingRuleRestrictContacts> TdConvertToInternal (struct TdUserPrivacySettingRuleRestrictContacts *var);
+struct TdUserPrivacySettingRuleRestrictContacts *TdConvertFromInternal (const td::td_api::userPrivacySettingRuleRestrictContacts &from);
+std::string TdToString (struct TdUserPrivacySettingRuleRestrictContacts *var);
+void TdDestroyObject (struct TdUserPrivacySettingRuleRestrictContacts *var);
+void TdStackStorer (struct TdUserPrivacySettingRuleRestrictContacts *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userPrivacySettingRuleRestrictUsers> TdConvertToInternal (struct TdUserPrivacySettingRuleRestrictUsers *var);
+struct TdUserPrivacySettingRuleRestrictUsers *TdConvertFromInternal (const td::td_api::userPrivacySettingRuleRestrictUsers &from);
+std::string TdToString (struct TdUserPrivacySettingRuleRestrictUsers *var);
+void TdDestroyObject (struct TdUserPrivacySettingRuleRestrictUsers *var);
+void TdStackStorer (struct TdUserPrivacySettingRuleRestrictUsers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userPrivacySettingRules> TdConvertToInternal (struct TdUserPrivacySettingRules *var);
+struct TdUserPrivacySettingRules *TdConvertFromInternal (const td::td_api::userPrivacySettingRules &from);
+std::string TdToString (struct TdUserPrivacySettingRules *var);
+void TdDestroyObject (struct TdUserPrivacySettingRules *var);
+void TdStackStorer (struct TdUserPrivacySettingRules *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userProfilePhotos> TdConvertToInternal (struct TdUserProfilePhotos *var);
+struct TdUserProfilePhotos *TdConvertFromInternal (const td::td_api::userProfilePhotos &from);
+std::string TdToString (struct TdUserProfilePhotos *var);
+void TdDestroyObject (struct TdUserProfilePhotos *var);
+void TdStackStorer (struct TdUserProfilePhotos *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::UserStatus> TdConvertToInternal (struct TdUserStatus *var);
+struct TdUserStatus *TdConvertFromInternal (const td::td_api::UserStatus &from);
+std::string TdToString (struct TdUserStatus *var);
+void TdDestroyObject (struct TdUserStatus *var);
+void TdStackStorer (struct TdUserStatus *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userStatusEmpty> TdConvertToInternal (struct TdUserStatusEmpty *var);
+struct TdUserStatusEmpty *TdConvertFromInternal (const td::td_api::userStatusEmpty &from);
+std::string TdToString (struct TdUserStatusEmpty *var);
+void TdDestroyObject (struct TdUserStatusEmpty *var);
+void TdStackStorer (struct TdUserStatusEmpty *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userStatusOnline> TdConvertToInternal (struct TdUserStatusOnline *var);
+struct TdUserStatusOnline *TdConvertFromInternal (const td::td_api::userStatusOnline &from);
+std::string TdToString (struct TdUserStatusOnline *var);
+void TdDestroyObject (struct TdUserStatusOnline *var);
+void TdStackStorer (struct TdUserStatusOnline *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userStatusOffline> TdConvertToInternal (struct TdUserStatusOffline *var);
+struct TdUserStatusOffline *TdConvertFromInternal (const td::td_api::userStatusOffline &from);
+std::string TdToString (struct TdUserStatusOffline *var);
+void TdDestroyObject (struct TdUserStatusOffline *var);
+void TdStackStorer (struct TdUserStatusOffline *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userStatusRecently> TdConvertToInternal (struct TdUserStatusRecently *var);
+struct TdUserStatusRecently *TdConvertFromInternal (const td::td_api::userStatusRecently &from);
+std::string TdToString (struct TdUserStatusRecently *var);
+void TdDestroyObject (struct TdUserStatusRecently *var);
+void TdStackStorer (struct TdUserStatusRecently *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userStatusLastWeek> TdConvertToInternal (struct TdUserStatusLastWeek *var);
+struct TdUserStatusLastWeek *TdConvertFromInternal (const td::td_api::userStatusLastWeek &from);
+std::string TdToString (struct TdUserStatusLastWeek *var);
+void TdDestroyObject (struct TdUserStatusLastWeek *var);
+void TdStackStorer (struct TdUserStatusLastWeek *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userStatusLastMonth> TdConvertToInternal (struct TdUserStatusLastMonth *var);
+struct TdUserStatusLastMonth *TdConvertFromInternal (const td::td_api::userStatusLastMonth &from);
+std::string TdToString (struct TdUserStatusLastMonth *var);
+void TdDestroyObject (struct TdUserStatusLastMonth *var);
+void TdStackStorer (struct TdUserStatusLastMonth *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::UserType> TdConvertToInternal (struct TdUserType *var);
+struct TdUserType *TdConvertFromInternal (const td::td_api::UserType &from);
+std::string TdToString (struct TdUserType *var);
+void TdDestroyObject (struct TdUserType *var);
+void TdStackStorer (struct TdUserType *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userTypeRegular> TdConvertToInternal (struct TdUserTypeRegular *var);
+struct TdUserTypeRegular *TdConvertFromInternal (const td::td_api::userTypeRegular &from);
+std::string TdToString (struct TdUserTypeRegular *var);
+void TdDestroyObject (struct TdUserTypeRegular *var);
+void TdStackStorer (struct TdUserTypeRegular *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userTypeDeleted> TdConvertToInternal (struct TdUserTypeDeleted *var);
+struct TdUserTypeDeleted *TdConvertFromInternal (const td::td_api::userTypeDeleted &from);
+std::string TdToString (struct TdUserTypeDeleted *var);
+void TdDestroyObject (struct TdUserTypeDeleted *var);
+void TdStackStorer (struct TdUserTypeDeleted *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userTypeBot> TdConvertToInternal (struct TdUserTypeBot *var);
+struct TdUserTypeBot *TdConvertFromInternal (const td::td_api::userTypeBot &from);
+std::string TdToString (struct TdUserTypeBot *var);
+void TdDestroyObject (struct TdUserTypeBot *var);
+void TdStackStorer (struct TdUserTypeBot *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::userTypeUnknown> TdConvertToInternal (struct TdUserTypeUnknown *var);
+struct TdUserTypeUnknown *TdConvertFromInternal (const td::td_api::userTypeUnknown &from);
+std::string TdToString (struct TdUserTypeUnknown *var);
+void TdDestroyObject (struct TdUserTypeUnknown *var);
+void TdStackStorer (struct TdUserTypeUnknown *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::users> TdConvertToInternal (struct TdUsers *var);
+struct TdUsers *TdConvertFromInternal (const td::td_api::users &from);
+std::string TdToString (struct TdUsers *var);
+void TdDestroyObject (struct TdUsers *var);
+void TdStackStorer (struct TdUsers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::validatedOrderInfo> TdConvertToInternal (struct TdValidatedOrderInfo *var);
+struct TdValidatedOrderInfo *TdConvertFromInternal (const td::td_api::validatedOrderInfo &from);
+std::string TdToString (struct TdValidatedOrderInfo *var);
+void TdDestroyObject (struct TdValidatedOrderInfo *var);
+void TdStackStorer (struct TdValidatedOrderInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::venue> TdConvertToInternal (struct TdVenue *var);
+struct TdVenue *TdConvertFromInternal (const td::td_api::venue &from);
+std::string TdToString (struct TdVenue *var);
+void TdDestroyObject (struct TdVenue *var);
+void TdStackStorer (struct TdVenue *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::video> TdConvertToInternal (struct TdVideo *var);
+struct TdVideo *TdConvertFromInternal (const td::td_api::video &from);
+std::string TdToString (struct TdVideo *var);
+void TdDestroyObject (struct TdVideo *var);
+void TdStackStorer (struct TdVideo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::videoNote> TdConvertToInternal (struct TdVideoNote *var);
+struct TdVideoNote *TdConvertFromInternal (const td::td_api::videoNote &from);
+std::string TdToString (struct TdVideoNote *var);
+void TdDestroyObject (struct TdVideoNote *var);
+void TdStackStorer (struct TdVideoNote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::voiceNote> TdConvertToInternal (struct TdVoiceNote *var);
+struct TdVoiceNote *TdConvertFromInternal (const td::td_api::voiceNote &from);
+std::string TdToString (struct TdVoiceNote *var);
+void TdDestroyObject (struct TdVoiceNote *var);
+void TdStackStorer (struct TdVoiceNote *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::wallpaper> TdConvertToInternal (struct TdWallpaper *var);
+struct TdWallpaper *TdConvertFromInternal (const td::td_api::wallpaper &from);
+std::string TdToString (struct TdWallpaper *var);
+void TdDestroyObject (struct TdWallpaper *var);
+void TdStackStorer (struct TdWallpaper *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::wallpapers> TdConvertToInternal (struct TdWallpapers *var);
+struct TdWallpapers *TdConvertFromInternal (const td::td_api::wallpapers &from);
+std::string TdToString (struct TdWallpapers *var);
+void TdDestroyObject (struct TdWallpapers *var);
+void TdStackStorer (struct TdWallpapers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::webPage> TdConvertToInternal (struct TdWebPage *var);
+struct TdWebPage *TdConvertFromInternal (const td::td_api::webPage &from);
+std::string TdToString (struct TdWebPage *var);
+void TdDestroyObject (struct TdWebPage *var);
+void TdStackStorer (struct TdWebPage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::webPageInstantView> TdConvertToInternal (struct TdWebPageInstantView *var);
+struct TdWebPageInstantView *TdConvertFromInternal (const td::td_api::webPageInstantView &from);
+std::string TdToString (struct TdWebPageInstantView *var);
+void TdDestroyObject (struct TdWebPageInstantView *var);
+void TdStackStorer (struct TdWebPageInstantView *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::acceptCall> TdConvertToInternal (struct TdAcceptCall *var);
+struct TdAcceptCall *TdConvertFromInternal (const td::td_api::acceptCall &from);
+std::string TdToString (struct TdAcceptCall *var);
+void TdDestroyObject (struct TdAcceptCall *var);
+void TdStackStorer (struct TdAcceptCall *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::addChatMember> TdConvertToInternal (struct TdAddChatMember *var);
+struct TdAddChatMember *TdConvertFromInternal (const td::td_api::addChatMember &from);
+std::string TdToString (struct TdAddChatMember *var);
+void TdDestroyObject (struct TdAddChatMember *var);
+void TdStackStorer (struct TdAddChatMember *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::addChatMembers> TdConvertToInternal (struct TdAddChatMembers *var);
+struct TdAddChatMembers *TdConvertFromInternal (const td::td_api::addChatMembers &from);
+std::string TdToString (struct TdAddChatMembers *var);
+void TdDestroyObject (struct TdAddChatMembers *var);
+void TdStackStorer (struct TdAddChatMembers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::addFavoriteSticker> TdConvertToInternal (struct TdAddFavoriteSticker *var);
+struct TdAddFavoriteSticker *TdConvertFromInternal (const td::td_api::addFavoriteSticker &from);
+std::string TdToString (struct TdAddFavoriteSticker *var);
+void TdDestroyObject (struct TdAddFavoriteSticker *var);
+void TdStackStorer (struct TdAddFavoriteSticker *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::addNetworkStatistics> TdConvertToInternal (struct TdAddNetworkStatistics *var);
+struct TdAddNetworkStatistics *TdConvertFromInternal (const td::td_api::addNetworkStatistics &from);
+std::string TdToString (struct TdAddNetworkStatistics *var);
+void TdDestroyObject (struct TdAddNetworkStatistics *var);
+void TdStackStorer (struct TdAddNetworkStatistics *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::addRecentSticker> TdConvertToInternal (struct TdAddRecentSticker *var);
+struct TdAddRecentSticker *TdConvertFromInternal (const td::td_api::addRecentSticker &from);
+std::string TdToString (struct TdAddRecentSticker *var);
+void TdDestroyObject (struct TdAddRecentSticker *var);
+void TdStackStorer (struct TdAddRecentSticker *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::addRecentlyFoundChat> TdConvertToInternal (struct TdAddRecentlyFoundChat *var);
+struct TdAddRecentlyFoundChat *TdConvertFromInternal (const td::td_api::addRecentlyFoundChat &from);
+std::string TdToString (struct TdAddRecentlyFoundChat *var);
+void TdDestroyObject (struct TdAddRecentlyFoundChat *var);
+void TdStackStorer (struct TdAddRecentlyFoundChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::addSavedAnimation> TdConvertToInternal (struct TdAddSavedAnimation *var);
+struct TdAddSavedAnimation *TdConvertFromInternal (const td::td_api::addSavedAnimation &from);
+std::string TdToString (struct TdAddSavedAnimation *var);
+void TdDestroyObject (struct TdAddSavedAnimation *var);
+void TdStackStorer (struct TdAddSavedAnimation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::addStickerToSet> TdConvertToInternal (struct TdAddStickerToSet *var);
+struct TdAddStickerToSet *TdConvertFromInternal (const td::td_api::addStickerToSet &from);
+std::string TdToString (struct TdAddStickerToSet *var);
+void TdDestroyObject (struct TdAddStickerToSet *var);
+void TdStackStorer (struct TdAddStickerToSet *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::answerCallbackQuery> TdConvertToInternal (struct TdAnswerCallbackQuery *var);
+struct TdAnswerCallbackQuery *TdConvertFromInternal (const td::td_api::answerCallbackQuery &from);
+std::string TdToString (struct TdAnswerCallbackQuery *var);
+void TdDestroyObject (struct TdAnswerCallbackQuery *var);
+void TdStackStorer (struct TdAnswerCallbackQuery *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::answerCustomQuery> TdConvertToInternal (struct TdAnswerCustomQuery *var);
+struct TdAnswerCustomQuery *TdConvertFromInternal (const td::td_api::answerCustomQuery &from);
+std::string TdToString (struct TdAnswerCustomQuery *var);
+void TdDestroyObject (struct TdAnswerCustomQuery *var);
+void TdStackStorer (struct TdAnswerCustomQuery *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::answerInlineQuery> TdConvertToInternal (struct TdAnswerInlineQuery *var);
+struct TdAnswerInlineQuery *TdConvertFromInternal (const td::td_api::answerInlineQuery &from);
+std::string TdToString (struct TdAnswerInlineQuery *var);
+void TdDestroyObject (struct TdAnswerInlineQuery *var);
+void TdStackStorer (struct TdAnswerInlineQuery *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::answerPreCheckoutQuery> TdConvertToInternal (struct TdAnswerPreCheckoutQuery *var);
+struct TdAnswerPreCheckoutQuery *TdConvertFromInternal (const td::td_api::answerPreCheckoutQuery &from);
+std::string TdToString (struct TdAnswerPreCheckoutQuery *var);
+void TdDestroyObject (struct TdAnswerPreCheckoutQuery *var);
+void TdStackStorer (struct TdAnswerPreCheckoutQuery *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::answerShippingQuery> TdConvertToInternal (struct TdAnswerShippingQuery *var);
+struct TdAnswerShippingQuery *TdConvertFromInternal (const td::td_api::answerShippingQuery &from);
+std::string TdToString (struct TdAnswerShippingQuery *var);
+void TdDestroyObject (struct TdAnswerShippingQuery *var);
+void TdStackStorer (struct TdAnswerShippingQuery *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::blockUser> TdConvertToInternal (struct TdBlockUser *var);
+struct TdBlockUser *TdConvertFromInternal (const td::td_api::blockUser &from);
+std::string TdToString (struct TdBlockUser *var);
+void TdDestroyObject (struct TdBlockUser *var);
+void TdStackStorer (struct TdBlockUser *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::cancelDownloadFile> TdConvertToInternal (struct TdCancelDownloadFile *var);
+struct TdCancelDownloadFile *TdConvertFromInternal (const td::td_api::cancelDownloadFile &from);
+std::string TdToString (struct TdCancelDownloadFile *var);
+void TdDestroyObject (struct TdCancelDownloadFile *var);
+void TdStackStorer (struct TdCancelDownloadFile *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::cancelUploadFile> TdConvertToInternal (struct TdCancelUploadFile *var);
+struct TdCancelUploadFile *TdConvertFromInternal (const td::td_api::cancelUploadFile &from);
+std::string TdToString (struct TdCancelUploadFile *var);
+void TdDestroyObject (struct TdCancelUploadFile *var);
+void TdStackStorer (struct TdCancelUploadFile *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::changeChatReportSpamState> TdConvertToInternal (struct TdChangeChatReportSpamState *var);
+struct TdChangeChatReportSpamState *TdConvertFromInternal (const td::td_api::changeChatReportSpamState &from);
+std::string TdToString (struct TdChangeChatReportSpamState *var);
+void TdDestroyObject (struct TdChangeChatReportSpamState *var);
+void TdStackStorer (struct TdChangeChatReportSpamState *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::changeImportedContacts> TdConvertToInternal (struct TdChangeImportedContacts *var);
+struct TdChangeImportedContacts *TdConvertFromInternal (const td::td_api::changeImportedContacts &from);
+std::string TdToString (struct TdChangeImportedContacts *var);
+void TdDestroyObject (struct TdChangeImportedContacts *var);
+void TdStackStorer (struct TdChangeImportedContacts *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::changePhoneNumber> TdConvertToInternal (struct TdChangePhoneNumber *var);
+struct TdChangePhoneNumber *TdConvertFromInternal (const td::td_api::changePhoneNumber &from);
+std::string TdToString (struct TdChangePhoneNumber *var);
+void TdDestroyObject (struct TdChangePhoneNumber *var);
+void TdStackStorer (struct TdChangePhoneNumber *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::changeStickerSet> TdConvertToInternal (struct TdChangeStickerSet *var);
+struct TdChangeStickerSet *TdConvertFromInternal (const td::td_api::changeStickerSet &from);
+std::string TdToString (struct TdChangeStickerSet *var);
+void TdDestroyObject (struct TdChangeStickerSet *var);
+void TdStackStorer (struct TdChangeStickerSet *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::checkAuthenticationBotToken> TdConvertToInternal (struct TdCheckAuthenticationBotToken *var);
+struct TdCheckAuthenticationBotToken *TdConvertFromInternal (const td::td_api::checkAuthenticationBotToken &from);
+std::string TdToString (struct TdCheckAuthenticationBotToken *var);
+void TdDestroyObject (struct TdCheckAuthenticationBotToken *var);
+void TdStackStorer (struct TdCheckAuthenticationBotToken *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::checkAuthenticationCode> TdConvertToInternal (struct TdCheckAuthenticationCode *var);
+struct TdCheckAuthenticationCode *TdConvertFromInternal (const td::td_api::checkAuthenticationCode &from);
+std::string TdToString (struct TdCheckAuthenticationCode *var);
+void TdDestroyObject (struct TdCheckAuthenticationCode *var);
+void TdStackStorer (struct TdCheckAuthenticationCode *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::checkAuthenticationPassword> TdConvertToInternal (struct TdCheckAuthenticationPassword *var);
+struct TdCheckAuthenticationPassword *TdConvertFromInternal (const td::td_api::checkAuthenticationPassword &from);
+std::string TdToString (struct TdCheckAuthenticationPassword *var);
+void TdDestroyObject (struct TdCheckAuthenticationPassword *var);
+void TdStackStorer (struct TdCheckAuthenticationPassword *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::checkChangePhoneNumberCode> TdConvertToInternal (struct TdCheckChangePhoneNumberCode *var);
+struct TdCheckChangePhoneNumberCode *TdConvertFromInternal (const td::td_api::checkChangePhoneNumberCode &from);
+std::string TdToString (struct TdCheckChangePhoneNumberCode *var);
+void TdDestroyObject (struct TdCheckChangePhoneNumberCode *var);
+void TdStackStorer (struct TdCheckChangePhoneNumberCode *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::checkChatInviteLink> TdConvertToInternal (struct TdCheckChatInviteLink *var);
+struct TdCheckChatInviteLink *TdConvertFromInternal (const td::td_api::checkChatInviteLink &from);
+std::string TdToString (struct TdCheckChatInviteLink *var);
+void TdDestroyObject (struct TdCheckChatInviteLink *var);
+void TdStackStorer (struct TdCheckChatInviteLink *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::checkDatabaseEncryptionKey> TdConvertToInternal (struct TdCheckDatabaseEncryptionKey *var);
+struct TdCheckDatabaseEncryptionKey *TdConvertFromInternal (const td::td_api::checkDatabaseEncryptionKey &from);
+std::string TdToString (struct TdCheckDatabaseEncryptionKey *var);
+void TdDestroyObject (struct TdCheckDatabaseEncryptionKey *var);
+void TdStackStorer (struct TdCheckDatabaseEncryptionKey *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::clearImportedContacts> TdConvertToInternal (struct TdClearImportedContacts *var);
+struct TdClearImportedContacts *TdConvertFromInternal (const td::td_api::clearImportedContacts &from);
+std::string TdToString (struct TdClearImportedContacts *var);
+void TdDestroyObject (struct TdClearImportedContacts *var);
+void TdStackStorer (struct TdClearImportedContacts *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::clearRecentStickers> TdConvertToInternal (struct TdClearRecentStickers *var);
+struct TdClearRecentStickers *TdConvertFromInternal (const td::td_api::clearRecentStickers &from);
+std::string TdToString (struct TdClearRecentStickers *var);
+void TdDestroyObject (struct TdClearRecentStickers *var);
+void TdStackStorer (struct TdClearRecentStickers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::clearRecentlyFoundChats> TdConvertToInternal (struct TdClearRecentlyFoundChats *var);
+struct TdClearRecentlyFoundChats *TdConvertFromInternal (const td::td_api::clearRecentlyFoundChats &from);
+std::string TdToString (struct TdClearRecentlyFoundChats *var);
+void TdDestroyObject (struct TdClearRecentlyFoundChats *var);
+void TdStackStorer (struct TdClearRecentlyFoundChats *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::close> TdConvertToInternal (struct TdClose *var);
+struct TdClose *TdConvertFromInternal (const td::td_api::close &from);
+std::string TdToString (struct TdClose *var);
+void TdDestroyObject (struct TdClose *var);
+void TdStackStorer (struct TdClose *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::closeChat> TdConvertToInternal (struct TdCloseChat *var);
+struct TdCloseChat *TdConvertFromInternal (const td::td_api::closeChat &from);
+std::string TdToString (struct TdCloseChat *var);
+void TdDestroyObject (struct TdCloseChat *var);
+void TdStackStorer (struct TdCloseChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::closeSecretChat> TdConvertToInternal (struct TdCloseSecretChat *var);
+struct TdCloseSecretChat *TdConvertFromInternal (const td::td_api::closeSecretChat &from);
+std::string TdToString (struct TdCloseSecretChat *var);
+void TdDestroyObject (struct TdCloseSecretChat *var);
+void TdStackStorer (struct TdCloseSecretChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::createBasicGroupChat> TdConvertToInternal (struct TdCreateBasicGroupChat *var);
+struct TdCreateBasicGroupChat *TdConvertFromInternal (const td::td_api::createBasicGroupChat &from);
+std::string TdToString (struct TdCreateBasicGroupChat *var);
+void TdDestroyObject (struct TdCreateBasicGroupChat *var);
+void TdStackStorer (struct TdCreateBasicGroupChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::createCall> TdConvertToInternal (struct TdCreateCall *var);
+struct TdCreateCall *TdConvertFromInternal (const td::td_api::createCall &from);
+std::string TdToString (struct TdCreateCall *var);
+void TdDestroyObject (struct TdCreateCall *var);
+void TdStackStorer (struct TdCreateCall *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::createNewBasicGroupChat> TdConvertToInternal (struct TdCreateNewBasicGroupChat *var);
+struct TdCreateNewBasicGroupChat *TdConvertFromInternal (const td::td_api::createNewBasicGroupChat &from);
+std::string TdToString (struct TdCreateNewBasicGroupChat *var);
+void TdDestroyObject (struct TdCreateNewBasicGroupChat *var);
+void TdStackStorer (struct TdCreateNewBasicGroupChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::createNewSecretChat> TdConvertToInternal (struct TdCreateNewSecretChat *var);
+struct TdCreateNewSecretChat *TdConvertFromInternal (const td::td_api::createNewSecretChat &from);
+std::string TdToString (struct TdCreateNewSecretChat *var);
+void TdDestroyObject (struct TdCreateNewSecretChat *var);
+void TdStackStorer (struct TdCreateNewSecretChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::createNewStickerSet> TdConvertToInternal (struct TdCreateNewStickerSet *var);
+struct TdCreateNewStickerSet *TdConvertFromInternal (const td::td_api::createNewStickerSet &from);
+std::string TdToString (struct TdCreateNewStickerSet *var);
+void TdDestroyObject (struct TdCreateNewStickerSet *var);
+void TdStackStorer (struct TdCreateNewStickerSet *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::createNewSupergroupChat> TdConvertToInternal (struct TdCreateNewSupergroupChat *var);
+struct TdCreateNewSupergroupChat *TdConvertFromInternal (const td::td_api::createNewSupergroupChat &from);
+std::string TdToString (struct TdCreateNewSupergroupChat *var);
+void TdDestroyObject (struct TdCreateNewSupergroupChat *var);
+void TdStackStorer (struct TdCreateNewSupergroupChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::createPrivateChat> TdConvertToInternal (struct TdCreatePrivateChat *var);
+struct TdCreatePrivateChat *TdConvertFromInternal (const td::td_api::createPrivateChat &from);
+std::string TdToString (struct TdCreatePrivateChat *var);
+void TdDestroyObject (struct TdCreatePrivateChat *var);
+void TdStackStorer (struct TdCreatePrivateChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::createSecretChat> TdConvertToInternal (struct TdCreateSecretChat *var);
+struct TdCreateSecretChat *TdConvertFromInternal (const td::td_api::createSecretChat &from);
+std::string TdToString (struct TdCreateSecretChat *var);
+void TdDestroyObject (struct TdCreateSecretChat *var);
+void TdStackStorer (struct TdCreateSecretChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::createSupergroupChat> TdConvertToInternal (struct TdCreateSupergroupChat *var);
+struct TdCreateSupergroupChat *TdConvertFromInternal (const td::td_api::createSupergroupChat &from);
+std::string TdToString (struct TdCreateSupergroupChat *var);
+void TdDestroyObject (struct TdCreateSupergroupChat *var);
+void TdStackStorer (struct TdCreateSupergroupChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::createTemporaryPassword> TdConvertToInternal (struct TdCreateTemporaryPassword *var);
+struct TdCreateTemporaryPassword *TdConvertFromInternal (const td::td_api::createTemporaryPassword &from);
+std::string TdToString (struct TdCreateTemporaryPassword *var);
+void TdDestroyObject (struct TdCreateTemporaryPassword *var);
+void TdStackStorer (struct TdCreateTemporaryPassword *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deleteAccount> TdConvertToInternal (struct TdDeleteAccount *var);
+struct TdDeleteAccount *TdConvertFromInternal (const td::td_api::deleteAccount &from);
+std::string TdToString (struct TdDeleteAccount *var);
+void TdDestroyObject (struct TdDeleteAccount *var);
+void TdStackStorer (struct TdDeleteAccount *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deleteChatHistory> TdConvertToInternal (struct TdDeleteChatHistory *var);
+struct TdDeleteChatHistory *TdConvertFromInternal (const td::td_api::deleteChatHistory &from);
+std::string TdToString (struct TdDeleteChatHistory *var);
+void TdDestroyObject (struct TdDeleteChatHistory *var);
+void TdStackStorer (struct TdDeleteChatHistory *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deleteChatMessagesFromUser> TdConvertToInternal (struct TdDeleteChatMessagesFromUser *var);
+struct TdDeleteChatMessagesFromUser *TdConvertFromInternal (const td::td_api::deleteChatMessagesFromUser &from);
+std::string TdToString (struct TdDeleteChatMessagesFromUser *var);
+void TdDestroyObject (struct TdDeleteChatMessagesFromUser *var);
+void TdStackStorer (struct TdDeleteChatMessagesFromUser *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deleteChatReplyMarkup> TdConvertToInternal (struct TdDeleteChatReplyMarkup *var);
+struct TdDeleteChatReplyMarkup *TdConvertFromInternal (const td::td_api::deleteChatReplyMarkup &from);
+std::string TdToString (struct TdDeleteChatReplyMarkup *var);
+void TdDestroyObject (struct TdDeleteChatReplyMarkup *var);
+void TdStackStorer (struct TdDeleteChatReplyMarkup *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deleteFile> TdConvertToInternal (struct TdDeleteFile *var);
+struct TdDeleteFile *TdConvertFromInternal (const td::td_api::deleteFile &from);
+std::string TdToString (struct TdDeleteFile *var);
+void TdDestroyObject (struct TdDeleteFile *var);
+void TdStackStorer (struct TdDeleteFile *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deleteMessages> TdConvertToInternal (struct TdDeleteMessages *var);
+struct TdDeleteMessages *TdConvertFromInternal (const td::td_api::deleteMessages &from);
+std::string TdToString (struct TdDeleteMessages *var);
+void TdDestroyObject (struct TdDeleteMessages *var);
+void TdStackStorer (struct TdDeleteMessages *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deleteProfilePhoto> TdConvertToInternal (struct TdDeleteProfilePhoto *var);
+struct TdDeleteProfilePhoto *TdConvertFromInternal (const td::td_api::deleteProfilePhoto &from);
+std::string TdToString (struct TdDeleteProfilePhoto *var);
+void TdDestroyObject (struct TdDeleteProfilePhoto *var);
+void TdStackStorer (struct TdDeleteProfilePhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deleteSavedCredentials> TdConvertToInternal (struct TdDeleteSavedCredentials *var);
+struct TdDeleteSavedCredentials *TdConvertFromInternal (const td::td_api::deleteSavedCredentials &from);
+std::string TdToString (struct TdDeleteSavedCredentials *var);
+void TdDestroyObject (struct TdDeleteSavedCredentials *var);
+void TdStackStorer (struct TdDeleteSavedCredentials *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deleteSavedOrderInfo> TdConvertToInternal (struct TdDeleteSavedOrderInfo *var);
+struct TdDeleteSavedOrderInfo *TdConvertFromInternal (const td::td_api::deleteSavedOrderInfo &from);
+std::string TdToString (struct TdDeleteSavedOrderInfo *var);
+void TdDestroyObject (struct TdDeleteSavedOrderInfo *var);
+void TdStackStorer (struct TdDeleteSavedOrderInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::deleteSupergroup> TdConvertToInternal (struct TdDeleteSupergroup *var);
+struct TdDeleteSupergroup *TdConvertFromInternal (const td::td_api::deleteSupergroup &from);
+std::string TdToString (struct TdDeleteSupergroup *var);
+void TdDestroyObject (struct TdDeleteSupergroup *var);
+void TdStackStorer (struct TdDeleteSupergroup *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::destroy> TdConvertToInternal (struct TdDestroy *var);
+struct TdDestroy *TdConvertFromInternal (const td::td_api::destroy &from);
+std::string TdToString (struct TdDestroy *var);
+void TdDestroyObject (struct TdDestroy *var);
+void TdStackStorer (struct TdDestroy *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::discardCall> TdConvertToInternal (struct TdDiscardCall *var);
+struct TdDiscardCall *TdConvertFromInternal (const td::td_api::discardCall &from);
+std::string TdToString (struct TdDiscardCall *var);
+void TdDestroyObject (struct TdDiscardCall *var);
+void TdStackStorer (struct TdDiscardCall *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::downloadFile> TdConvertToInternal (struct TdDownloadFile *var);
+struct TdDownloadFile *TdConvertFromInternal (const td::td_api::downloadFile &from);
+std::string TdToString (struct TdDownloadFile *var);
+void TdDestroyObject (struct TdDownloadFile *var);
+void TdStackStorer (struct TdDownloadFile *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::editInlineMessageCaption> TdConvertToInternal (struct TdEditInlineMessageCaption *var);
+struct TdEditInlineMessageCaption *TdConvertFromInternal (const td::td_api::editInlineMessageCaption &from);
+std::string TdToString (struct TdEditInlineMessageCaption *var);
+void TdDestroyObject (struct TdEditInlineMessageCaption *var);
+void TdStackStorer (struct TdEditInlineMessageCaption *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::editInlineMessageLiveLocation> TdConvertToInternal (struct TdEditInlineMessageLiveLocation *var);
+struct TdEditInlineMessageLiveLocation *TdConvertFromInternal (const td::td_api::editInlineMessageLiveLocation &from);
+std::string TdToString (struct TdEditInlineMessageLiveLocation *var);
+void TdDestroyObject (struct TdEditInlineMessageLiveLocation *var);
+void TdStackStorer (struct TdEditInlineMessageLiveLocation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::editInlineMessageReplyMarkup> TdConvertToInternal (struct TdEditInlineMessageReplyMarkup *var);
+struct TdEditInlineMessageReplyMarkup *TdConvertFromInternal (const td::td_api::editInlineMessageReplyMarkup &from);
+std::string TdToString (struct TdEditInlineMessageReplyMarkup *var);
+void TdDestroyObject (struct TdEditInlineMessageReplyMarkup *var);
+void TdStackStorer (struct TdEditInlineMessageReplyMarkup *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::editInlineMessageText> TdConvertToInternal (struct TdEditInlineMessageText *var);
+struct TdEditInlineMessageText *TdConvertFromInternal (const td::td_api::editInlineMessageText &from);
+std::string TdToString (struct TdEditInlineMessageText *var);
+void TdDestroyObject (struct TdEditInlineMessageText *var);
+void TdStackStorer (struct TdEditInlineMessageText *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::editMessageCaption> TdConvertToInternal (struct TdEditMessageCaption *var);
+struct TdEditMessageCaption *TdConvertFromInternal (const td::td_api::editMessageCaption &from);
+std::string TdToString (struct TdEditMessageCaption *var);
+void TdDestroyObject (struct TdEditMessageCaption *var);
+void TdStackStorer (struct TdEditMessageCaption *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::editMessageLiveLocation> TdConvertToInternal (struct TdEditMessageLiveLocation *var);
+struct TdEditMessageLiveLocation *TdConvertFromInternal (const td::td_api::editMessageLiveLocation &from);
+std::string TdToString (struct TdEditMessageLiveLocation *var);
+void TdDestroyObject (struct TdEditMessageLiveLocation *var);
+void TdStackStorer (struct TdEditMessageLiveLocation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::editMessageReplyMarkup> TdConvertToInternal (struct TdEditMessageReplyMarkup *var);
+struct TdEditMessageReplyMarkup *TdConvertFromInternal (const td::td_api::editMessageReplyMarkup &from);
+std::string TdToString (struct TdEditMessageReplyMarkup *var);
+void TdDestroyObject (struct TdEditMessageReplyMarkup *var);
+void TdStackStorer (struct TdEditMessageReplyMarkup *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::editMessageText> TdConvertToInternal (struct TdEditMessageText *var);
+struct TdEditMessageText *TdConvertFromInternal (const td::td_api::editMessageText &from);
+std::string TdToString (struct TdEditMessageText *var);
+void TdDestroyObject (struct TdEditMessageText *var);
+void TdStackStorer (struct TdEditMessageText *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::finishFileGeneration> TdConvertToInternal (struct TdFinishFileGeneration *var);
+struct TdFinishFileGeneration *TdConvertFromInternal (const td::td_api::finishFileGeneration &from);
+std::string TdToString (struct TdFinishFileGeneration *var);
+void TdDestroyObject (struct TdFinishFileGeneration *var);
+void TdStackStorer (struct TdFinishFileGeneration *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::forwardMessages> TdConvertToInternal (struct TdForwardMessages *var);
+struct TdForwardMessages *TdConvertFromInternal (const td::td_api::forwardMessages &from);
+std::string TdToString (struct TdForwardMessages *var);
+void TdDestroyObject (struct TdForwardMessages *var);
+void TdStackStorer (struct TdForwardMessages *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::generateChatInviteLink> TdConvertToInternal (struct TdGenerateChatInviteLink *var);
+struct TdGenerateChatInviteLink *TdConvertFromInternal (const td::td_api::generateChatInviteLink &from);
+std::string TdToString (struct TdGenerateChatInviteLink *var);
+void TdDestroyObject (struct TdGenerateChatInviteLink *var);
+void TdStackStorer (struct TdGenerateChatInviteLink *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getAccountTtl> TdConvertToInternal (struct TdGetAccountTtl *var);
+struct TdGetAccountTtl *TdConvertFromInternal (const td::td_api::getAccountTtl &from);
+std::string TdToString (struct TdGetAccountTtl *var);
+void TdDestroyObject (struct TdGetAccountTtl *var);
+void TdStackStorer (struct TdGetAccountTtl *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getActiveLiveLocationMessages> TdConvertToInternal (struct TdGetActiveLiveLocationMessages *var);
+struct TdGetActiveLiveLocationMessages *TdConvertFromInternal (const td::td_api::getActiveLiveLocationMessages &from);
+std::string TdToString (struct TdGetActiveLiveLocationMessages *var);
+void TdDestroyObject (struct TdGetActiveLiveLocationMessages *var);
+void TdStackStorer (struct TdGetActiveLiveLocationMessages *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getActiveSessions> TdConvertToInternal (struct TdGetActiveSessions *var);
+struct TdGetActiveSessions *TdConvertFromInternal (const td::td_api::getActiveSessions &from);
+std::string TdToString (struct TdGetActiveSessions *var);
+void TdDestroyObject (struct TdGetActiveSessions *var);
+void TdStackStorer (struct TdGetActiveSessions *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getArchivedStickerSets> TdConvertToInternal (struct TdGetArchivedStickerSets *var);
+struct TdGetArchivedStickerSets *TdConvertFromInternal (const td::td_api::getArchivedStickerSets &from);
+std::string TdToString (struct TdGetArchivedStickerSets *var);
+void TdDestroyObject (struct TdGetArchivedStickerSets *var);
+void TdStackStorer (struct TdGetArchivedStickerSets *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getAttachedStickerSets> TdConvertToInternal (struct TdGetAttachedStickerSets *var);
+struct TdGetAttachedStickerSets *TdConvertFromInternal (const td::td_api::getAttachedStickerSets &from);
+std::string TdToString (struct TdGetAttachedStickerSets *var);
+void TdDestroyObject (struct TdGetAttachedStickerSets *var);
+void TdStackStorer (struct TdGetAttachedStickerSets *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getAuthorizationState> TdConvertToInternal (struct TdGetAuthorizationState *var);
+struct TdGetAuthorizationState *TdConvertFromInternal (const td::td_api::getAuthorizationState &from);
+std::string TdToString (struct TdGetAuthorizationState *var);
+void TdDestroyObject (struct TdGetAuthorizationState *var);
+void TdStackStorer (struct TdGetAuthorizationState *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getBasicGroup> TdConvertToInternal (struct TdGetBasicGroup *var);
+struct TdGetBasicGroup *TdConvertFromInternal (const td::td_api::getBasicGroup &from);
+std::string TdToString (struct TdGetBasicGroup *var);
+void TdDestroyObject (struct TdGetBasicGroup *var);
+void TdStackStorer (struct TdGetBasicGroup *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getBasicGroupFullInfo> TdConvertToInternal (struct TdGetBasicGroupFullInfo *var);
+struct TdGetBasicGroupFullInfo *TdConvertFromInternal (const td::td_api::getBasicGroupFullInfo &from);
+std::string TdToString (struct TdGetBasicGroupFullInfo *var);
+void TdDestroyObject (struct TdGetBasicGroupFullInfo *var);
+void TdStackStorer (struct TdGetBasicGroupFullInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getBlockedUsers> TdConvertToInternal (struct TdGetBlockedUsers *var);
+struct TdGetBlockedUsers *TdConvertFromInternal (const td::td_api::getBlockedUsers &from);
+std::string TdToString (struct TdGetBlockedUsers *var);
+void TdDestroyObject (struct TdGetBlockedUsers *var);
+void TdStackStorer (struct TdGetBlockedUsers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getCallbackQueryAnswer> TdConvertToInternal (struct TdGetCallbackQueryAnswer *var);
+struct TdGetCallbackQueryAnswer *TdConvertFromInternal (const td::td_api::getCallbackQueryAnswer &from);
+std::string TdToString (struct TdGetCallbackQueryAnswer *var);
+void TdDestroyObject (struct TdGetCallbackQueryAnswer *var);
+void TdStackStorer (struct TdGetCallbackQueryAnswer *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getChat> TdConvertToInternal (struct TdGetChat *var);
+struct TdGetChat *TdConvertFromInternal (const td::td_api::getChat &from);
+std::string TdToString (struct TdGetChat *var);
+void TdDestroyObject (struct TdGetChat *var);
+void TdStackStorer (struct TdGetChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getChatAdministrators> TdConvertToInternal (struct TdGetChatAdministrators *var);
+struct TdGetChatAdministrators *TdConvertFromInternal (const td::td_api::getChatAdministrators &from);
+std::string TdToString (struct TdGetChatAdministrators *var);
+void TdDestroyObject (struct TdGetChatAdministrators *var);
+void TdStackStorer (struct TdGetChatAdministrators *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getChatEventLog> TdConvertToInternal (struct TdGetChatEventLog *var);
+struct TdGetChatEventLog *TdConvertFromInternal (const td::td_api::getChatEventLog &from);
+std::string TdToString (struct TdGetChatEventLog *var);
+void TdDestroyObject (struct TdGetChatEventLog *var);
+void TdStackStorer (struct TdGetChatEventLog *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getChatHistory> TdConvertToInternal (struct TdGetChatHistory *var);
+struct TdGetChatHistory *TdConvertFromInternal (const td::td_api::getChatHistory &from);
+std::string TdToString (struct TdGetChatHistory *var);
+void TdDestroyObject (struct TdGetChatHistory *var);
+void TdStackStorer (struct TdGetChatHistory *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getChatMember> TdConvertToInternal (struct TdGetChatMember *var);
+struct TdGetChatMember *TdConvertFromInternal (const td::td_api::getChatMember &from);
+std::string TdToString (struct TdGetChatMember *var);
+void TdDestroyObject (struct TdGetChatMember *var);
+void TdStackStorer (struct TdGetChatMember *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getChatMessageByDate> TdConvertToInternal (struct TdGetChatMessageByDate *var);
+struct TdGetChatMessageByDate *TdConvertFromInternal (const td::td_api::getChatMessageByDate &from);
+std::string TdToString (struct TdGetChatMessageByDate *var);
+void TdDestroyObject (struct TdGetChatMessageByDate *var);
+void TdStackStorer (struct TdGetChatMessageByDate *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getChatReportSpamState> TdConvertToInternal (struct TdGetChatReportSpamState *var);
+struct TdGetChatReportSpamState *TdConvertFromInternal (const td::td_api::getChatReportSpamState &from);
+std::string TdToString (struct TdGetChatReportSpamState *var);
+void TdDestroyObject (struct TdGetChatReportSpamState *var);
+void TdStackStorer (struct TdGetChatReportSpamState *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getChats> TdConvertToInternal (struct TdGetChats *var);
+struct TdGetChats *TdConvertFromInternal (const td::td_api::getChats &from);
+std::string TdToString (struct TdGetChats *var);
+void TdDestroyObject (struct TdGetChats *var);
+void TdStackStorer (struct TdGetChats *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getCreatedPublicChats> TdConvertToInternal (struct TdGetCreatedPublicChats *var);
+struct TdGetCreatedPublicChats *TdConvertFromInternal (const td::td_api::getCreatedPublicChats &from);
+std::string TdToString (struct TdGetCreatedPublicChats *var);
+void TdDestroyObject (struct TdGetCreatedPublicChats *var);
+void TdStackStorer (struct TdGetCreatedPublicChats *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getDatabaseStatistics> TdConvertToInternal (struct TdGetDatabaseStatistics *var);
+struct TdGetDatabaseStatistics *TdConvertFromInternal (const td::td_api::getDatabaseStatistics &from);
+std::string TdToString (struct TdGetDatabaseStatistics *var);
+void TdDestroyObject (struct TdGetDatabaseStatistics *var);
+void TdStackStorer (struct TdGetDatabaseStatistics *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getFavoriteStickers> TdConvertToInternal (struct TdGetFavoriteStickers *var);
+struct TdGetFavoriteStickers *TdConvertFromInternal (const td::td_api::getFavoriteStickers &from);
+std::string TdToString (struct TdGetFavoriteStickers *var);
+void TdDestroyObject (struct TdGetFavoriteStickers *var);
+void TdStackStorer (struct TdGetFavoriteStickers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getFile> TdConvertToInternal (struct TdGetFile *var);
+struct TdGetFile *TdConvertFromInternal (const td::td_api::getFile &from);
+std::string TdToString (struct TdGetFile *var);
+void TdDestroyObject (struct TdGetFile *var);
+void TdStackStorer (struct TdGetFile *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getFileExtension> TdConvertToInternal (struct TdGetFileExtension *var);
+struct TdGetFileExtension *TdConvertFromInternal (const td::td_api::getFileExtension &from);
+std::string TdToString (struct TdGetFileExtension *var);
+void TdDestroyObject (struct TdGetFileExtension *var);
+void TdStackStorer (struct TdGetFileExtension *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getFileMimeType> TdConvertToInternal (struct TdGetFileMimeType *var);
+struct TdGetFileMimeType *TdConvertFromInternal (const td::td_api::getFileMimeType &from);
+std::string TdToString (struct TdGetFileMimeType *var);
+void TdDestroyObject (struct TdGetFileMimeType *var);
+void TdStackStorer (struct TdGetFileMimeType *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getGameHighScores> TdConvertToInternal (struct TdGetGameHighScores *var);
+struct TdGetGameHighScores *TdConvertFromInternal (const td::td_api::getGameHighScores &from);
+std::string TdToString (struct TdGetGameHighScores *var);
+void TdDestroyObject (struct TdGetGameHighScores *var);
+void TdStackStorer (struct TdGetGameHighScores *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getGroupsInCommon> TdConvertToInternal (struct TdGetGroupsInCommon *var);
+struct TdGetGroupsInCommon *TdConvertFromInternal (const td::td_api::getGroupsInCommon &from);
+std::string TdToString (struct TdGetGroupsInCommon *var);
+void TdDestroyObject (struct TdGetGroupsInCommon *var);
+void TdStackStorer (struct TdGetGroupsInCommon *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getImportedContactCount> TdConvertToInternal (struct TdGetImportedContactCount *var);
+struct TdGetImportedContactCount *TdConvertFromInternal (const td::td_api::getImportedContactCount &from);
+std::string TdToString (struct TdGetImportedContactCount *var);
+void TdDestroyObject (struct TdGetImportedContactCount *var);
+void TdStackStorer (struct TdGetImportedContactCount *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getInlineGameHighScores> TdConvertToInternal (struct TdGetInlineGameHighScores *var);
+struct TdGetInlineGameHighScores *TdConvertFromInternal (const td::td_api::getInlineGameHighScores &from);
+std::string TdToString (struct TdGetInlineGameHighScores *var);
+void TdDestroyObject (struct TdGetInlineGameHighScores *var);
+void TdStackStorer (struct TdGetInlineGameHighScores *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getInlineQueryResults> TdConvertToInternal (struct TdGetInlineQueryResults *var);
+struct TdGetInlineQueryResults *TdConvertFromInternal (const td::td_api::getInlineQueryResults &from);
+std::string TdToString (struct TdGetInlineQueryResults *var);
+void TdDestroyObject (struct TdGetInlineQueryResults *var);
+void TdStackStorer (struct TdGetInlineQueryResults *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getInstalledStickerSets> TdConvertToInternal (struct TdGetInstalledStickerSets *var);
+struct TdGetInstalledStickerSets *TdConvertFromInternal (const td::td_api::getInstalledStickerSets &from);
+std::string TdToString (struct TdGetInstalledStickerSets *var);
+void TdDestroyObject (struct TdGetInstalledStickerSets *var);
+void TdStackStorer (struct TdGetInstalledStickerSets *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getInviteText> TdConvertToInternal (struct TdGetInviteText *var);
+struct TdGetInviteText *TdConvertFromInternal (const td::td_api::getInviteText &from);
+std::string TdToString (struct TdGetInviteText *var);
+void TdDestroyObject (struct TdGetInviteText *var);
+void TdStackStorer (struct TdGetInviteText *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getMe> TdConvertToInternal (struct TdGetMe *var);
+struct TdGetMe *TdConvertFromInternal (const td::td_api::getMe &from);
+std::string TdToString (struct TdGetMe *var);
+void TdDestroyObject (struct TdGetMe *var);
+void TdStackStorer (struct TdGetMe *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getMessage> TdConvertToInternal (struct TdGetMessage *var);
+struct TdGetMessage *TdConvertFromInternal (const td::td_api::getMessage &from);
+std::string TdToString (struct TdGetMessage *var);
+void TdDestroyObject (struct TdGetMessage *var);
+void TdStackStorer (struct TdGetMessage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getMessages> TdConvertToInternal (struct TdGetMessages *var);
+struct TdGetMessages *TdConvertFromInternal (const td::td_api::getMessages &from);
+std::string TdToString (struct TdGetMessages *var);
+void TdDestroyObject (struct TdGetMessages *var);
+void TdStackStorer (struct TdGetMessages *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getNetworkStatistics> TdConvertToInternal (struct TdGetNetworkStatistics *var);
+struct TdGetNetworkStatistics *TdConvertFromInternal (const td::td_api::getNetworkStatistics &from);
+std::string TdToString (struct TdGetNetworkStatistics *var);
+void TdDestroyObject (struct TdGetNetworkStatistics *var);
+void TdStackStorer (struct TdGetNetworkStatistics *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getNotificationSettings> TdConvertToInternal (struct TdGetNotificationSettings *var);
+struct TdGetNotificationSettings *TdConvertFromInternal (const td::td_api::getNotificationSettings &from);
+std::string TdToString (struct TdGetNotificationSettings *var);
+void TdDestroyObject (struct TdGetNotificationSettings *var);
+void TdStackStorer (struct TdGetNotificationSettings *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getOption> TdConvertToInternal (struct TdGetOption *var);
+struct TdGetOption *TdConvertFromInternal (const td::td_api::getOption &from);
+std::string TdToString (struct TdGetOption *var);
+void TdDestroyObject (struct TdGetOption *var);
+void TdStackStorer (struct TdGetOption *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getPasswordState> TdConvertToInternal (struct TdGetPasswordState *var);
+struct TdGetPasswordState *TdConvertFromInternal (const td::td_api::getPasswordState &from);
+std::string TdToString (struct TdGetPasswordState *var);
+void TdDestroyObject (struct TdGetPasswordState *var);
+void TdStackStorer (struct TdGetPasswordState *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getPaymentForm> TdConvertToInternal (struct TdGetPaymentForm *var);
+struct TdGetPaymentForm *TdConvertFromInternal (const td::td_api::getPaymentForm &from);
+std::string TdToString (struct TdGetPaymentForm *var);
+void TdDestroyObject (struct TdGetPaymentForm *var);
+void TdStackStorer (struct TdGetPaymentForm *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getPaymentReceipt> TdConvertToInternal (struct TdGetPaymentReceipt *var);
+struct TdGetPaymentReceipt *TdConvertFromInternal (const td::td_api::getPaymentReceipt &from);
+std::string TdToString (struct TdGetPaymentReceipt *var);
+void TdDestroyObject (struct TdGetPaymentReceipt *var);
+void TdStackStorer (struct TdGetPaymentReceipt *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getProxy> TdConvertToInternal (struct TdGetProxy *var);
+struct TdGetProxy *TdConvertFromInternal (const td::td_api::getProxy &from);
+std::string TdToString (struct TdGetProxy *var);
+void TdDestroyObject (struct TdGetProxy *var);
+void TdStackStorer (struct TdGetProxy *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getPublicMessageLink> TdConvertToInternal (struct TdGetPublicMessageLink *var);
+struct TdGetPublicMessageLink *TdConvertFromInternal (const td::td_api::getPublicMessageLink &from);
+std::string TdToString (struct TdGetPublicMessageLink *var);
+void TdDestroyObject (struct TdGetPublicMessageLink *var);
+void TdStackStorer (struct TdGetPublicMessageLink *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getRecentInlineBots> TdConvertToInternal (struct TdGetRecentInlineBots *var);
+struct TdGetRecentInlineBots *TdConvertFromInternal (const td::td_api::getRecentInlineBots &from);
+std::string TdToString (struct TdGetRecentInlineBots *var);
+void TdDestroyObject (struct TdGetRecentInlineBots *var);
+void TdStackStorer (struct TdGetRecentInlineBots *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getRecentStickers> TdConvertToInternal (struct TdGetRecentStickers *var);
+struct TdGetRecentStickers *TdConvertFromInternal (const td::td_api::getRecentStickers &from);
+std::string TdToString (struct TdGetRecentStickers *var);
+void TdDestroyObject (struct TdGetRecentStickers *var);
+void TdStackStorer (struct TdGetRecentStickers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getRecentlyVisitedTMeUrls> TdConvertToInternal (struct TdGetRecentlyVisitedTMeUrls *var);
+struct TdGetRecentlyVisitedTMeUrls *TdConvertFromInternal (const td::td_api::getRecentlyVisitedTMeUrls &from);
+std::string TdToString (struct TdGetRecentlyVisitedTMeUrls *var);
+void TdDestroyObject (struct TdGetRecentlyVisitedTMeUrls *var);
+void TdStackStorer (struct TdGetRecentlyVisitedTMeUrls *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getRecoveryEmailAddress> TdConvertToInternal (struct TdGetRecoveryEmailAddress *var);
+struct TdGetRecoveryEmailAddress *TdConvertFromInternal (const td::td_api::getRecoveryEmailAddress &from);
+std::string TdToString (struct TdGetRecoveryEmailAddress *var);
+void TdDestroyObject (struct TdGetRecoveryEmailAddress *var);
+void TdStackStorer (struct TdGetRecoveryEmailAddress *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getRemoteFile> TdConvertToInternal (struct TdGetRemoteFile *var);
+struct TdGetRemoteFile *TdConvertFromInternal (const td::td_api::getRemoteFile &from);
+std::string TdToString (struct TdGetRemoteFile *var);
+void TdDestroyObject (struct TdGetRemoteFile *var);
+void TdStackStorer (struct TdGetRemoteFile *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getSavedAnimations> TdConvertToInternal (struct TdGetSavedAnimations *var);
+struct TdGetSavedAnimations *TdConvertFromInternal (const td::td_api::getSavedAnimations &from);
+std::string TdToString (struct TdGetSavedAnimations *var);
+void TdDestroyObject (struct TdGetSavedAnimations *var);
+void TdStackStorer (struct TdGetSavedAnimations *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getSavedOrderInfo> TdConvertToInternal (struct TdGetSavedOrderInfo *var);
+struct TdGetSavedOrderInfo *TdConvertFromInternal (const td::td_api::getSavedOrderInfo &from);
+std::string TdToString (struct TdGetSavedOrderInfo *var);
+void TdDestroyObject (struct TdGetSavedOrderInfo *var);
+void TdStackStorer (struct TdGetSavedOrderInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getSecretChat> TdConvertToInternal (struct TdGetSecretChat *var);
+struct TdGetSecretChat *TdConvertFromInternal (const td::td_api::getSecretChat &from);
+std::string TdToString (struct TdGetSecretChat *var);
+void TdDestroyObject (struct TdGetSecretChat *var);
+void TdStackStorer (struct TdGetSecretChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getStickerEmojis> TdConvertToInternal (struct TdGetStickerEmojis *var);
+struct TdGetStickerEmojis *TdConvertFromInternal (const td::td_api::getStickerEmojis &from);
+std::string TdToString (struct TdGetStickerEmojis *var);
+void TdDestroyObject (struct TdGetStickerEmojis *var);
+void TdStackStorer (struct TdGetStickerEmojis *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getStickerSet> TdConvertToInternal (struct TdGetStickerSet *var);
+struct TdGetStickerSet *TdConvertFromInternal (const td::td_api::getStickerSet &from);
+std::string TdToString (struct TdGetStickerSet *var);
+void TdDestroyObject (struct TdGetStickerSet *var);
+void TdStackStorer (struct TdGetStickerSet *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getStickers> TdConvertToInternal (struct TdGetStickers *var);
+struct TdGetStickers *TdConvertFromInternal (const td::td_api::getStickers &from);
+std::string TdToString (struct TdGetStickers *var);
+void TdDestroyObject (struct TdGetStickers *var);
+void TdStackStorer (struct TdGetStickers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getStorageStatistics> TdConvertToInternal (struct TdGetStorageStatistics *var);
+struct TdGetStorageStatistics *TdConvertFromInternal (const td::td_api::getStorageStatistics &from);
+std::string TdToString (struct TdGetStorageStatistics *var);
+void TdDestroyObject (struct TdGetStorageStatistics *var);
+void TdStackStorer (struct TdGetStorageStatistics *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getStorageStatisticsFast> TdConvertToInternal (struct TdGetStorageStatisticsFast *var);
+struct TdGetStorageStatisticsFast *TdConvertFromInternal (const td::td_api::getStorageStatisticsFast &from);
+std::string TdToString (struct TdGetStorageStatisticsFast *var);
+void TdDestroyObject (struct TdGetStorageStatisticsFast *var);
+void TdStackStorer (struct TdGetStorageStatisticsFast *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getSupergroup> TdConvertToInternal (struct TdGetSupergroup *var);
+struct TdGetSupergroup *TdConvertFromInternal (const td::td_api::getSupergroup &from);
+std::string TdToString (struct TdGetSupergroup *var);
+void TdDestroyObject (struct TdGetSupergroup *var);
+void TdStackStorer (struct TdGetSupergroup *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getSupergroupFullInfo> TdConvertToInternal (struct TdGetSupergroupFullInfo *var);
+struct TdGetSupergroupFullInfo *TdConvertFromInternal (const td::td_api::getSupergroupFullInfo &from);
+std::string TdToString (struct TdGetSupergroupFullInfo *var);
+void TdDestroyObject (struct TdGetSupergroupFullInfo *var);
+void TdStackStorer (struct TdGetSupergroupFullInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getSupergroupMembers> TdConvertToInternal (struct TdGetSupergroupMembers *var);
+struct TdGetSupergroupMembers *TdConvertFromInternal (const td::td_api::getSupergroupMembers &from);
+std::string TdToString (struct TdGetSupergroupMembers *var);
+void TdDestroyObject (struct TdGetSupergroupMembers *var);
+void TdStackStorer (struct TdGetSupergroupMembers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getSupportUser> TdConvertToInternal (struct TdGetSupportUser *var);
+struct TdGetSupportUser *TdConvertFromInternal (const td::td_api::getSupportUser &from);
+std::string TdToString (struct TdGetSupportUser *var);
+void TdDestroyObject (struct TdGetSupportUser *var);
+void TdStackStorer (struct TdGetSupportUser *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getTemporaryPasswordState> TdConvertToInternal (struct TdGetTemporaryPasswordState *var);
+struct TdGetTemporaryPasswordState *TdConvertFromInternal (const td::td_api::getTemporaryPasswordState &from);
+std::string TdToString (struct TdGetTemporaryPasswordState *var);
+void TdDestroyObject (struct TdGetTemporaryPasswordState *var);
+void TdStackStorer (struct TdGetTemporaryPasswordState *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getTermsOfService> TdConvertToInternal (struct TdGetTermsOfService *var);
+struct TdGetTermsOfService *TdConvertFromInternal (const td::td_api::getTermsOfService &from);
+std::string TdToString (struct TdGetTermsOfService *var);
+void TdDestroyObject (struct TdGetTermsOfService *var);
+void TdStackStorer (struct TdGetTermsOfService *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getTextEntities> TdConvertToInternal (struct TdGetTextEntities *var);
+struct TdGetTextEntities *TdConvertFromInternal (const td::td_api::getTextEntities &from);
+std::string TdToString (struct TdGetTextEntities *var);
+void TdDestroyObject (struct TdGetTextEntities *var);
+void TdStackStorer (struct TdGetTextEntities *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getTopChats> TdConvertToInternal (struct TdGetTopChats *var);
+struct TdGetTopChats *TdConvertFromInternal (const td::td_api::getTopChats &from);
+std::string TdToString (struct TdGetTopChats *var);
+void TdDestroyObject (struct TdGetTopChats *var);
+void TdStackStorer (struct TdGetTopChats *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getTrendingStickerSets> TdConvertToInternal (struct TdGetTrendingStickerSets *var);
+struct TdGetTrendingStickerSets *TdConvertFromInternal (const td::td_api::getTrendingStickerSets &from);
+std::string TdToString (struct TdGetTrendingStickerSets *var);
+void TdDestroyObject (struct TdGetTrendingStickerSets *var);
+void TdStackStorer (struct TdGetTrendingStickerSets *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getUser> TdConvertToInternal (struct TdGetUser *var);
+struct TdGetUser *TdConvertFromInternal (const td::td_api::getUser &from);
+std::string TdToString (struct TdGetUser *var);
+void TdDestroyObject (struct TdGetUser *var);
+void TdStackStorer (struct TdGetUser *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getUserFullInfo> TdConvertToInternal (struct TdGetUserFullInfo *var);
+struct TdGetUserFullInfo *TdConvertFromInternal (const td::td_api::getUserFullInfo &from);
+std::string TdToString (struct TdGetUserFullInfo *var);
+void TdDestroyObject (struct TdGetUserFullInfo *var);
+void TdStackStorer (struct TdGetUserFullInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getUserPrivacySettingRules> TdConvertToInternal (struct TdGetUserPrivacySettingRules *var);
+struct TdGetUserPrivacySettingRules *TdConvertFromInternal (const td::td_api::getUserPrivacySettingRules &from);
+std::string TdToString (struct TdGetUserPrivacySettingRules *var);
+void TdDestroyObject (struct TdGetUserPrivacySettingRules *var);
+void TdStackStorer (struct TdGetUserPrivacySettingRules *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getUserProfilePhotos> TdConvertToInternal (struct TdGetUserProfilePhotos *var);
+struct TdGetUserProfilePhotos *TdConvertFromInternal (const td::td_api::getUserProfilePhotos &from);
+std::string TdToString (struct TdGetUserProfilePhotos *var);
+void TdDestroyObject (struct TdGetUserProfilePhotos *var);
+void TdStackStorer (struct TdGetUserProfilePhotos *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getWallpapers> TdConvertToInternal (struct TdGetWallpapers *var);
+struct TdGetWallpapers *TdConvertFromInternal (const td::td_api::getWallpapers &from);
+std::string TdToString (struct TdGetWallpapers *var);
+void TdDestroyObject (struct TdGetWallpapers *var);
+void TdStackStorer (struct TdGetWallpapers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getWebPageInstantView> TdConvertToInternal (struct TdGetWebPageInstantView *var);
+struct TdGetWebPageInstantView *TdConvertFromInternal (const td::td_api::getWebPageInstantView &from);
+std::string TdToString (struct TdGetWebPageInstantView *var);
+void TdDestroyObject (struct TdGetWebPageInstantView *var);
+void TdStackStorer (struct TdGetWebPageInstantView *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::getWebPagePreview> TdConvertToInternal (struct TdGetWebPagePreview *var);
+struct TdGetWebPagePreview *TdConvertFromInternal (const td::td_api::getWebPagePreview &from);
+std::string TdToString (struct TdGetWebPagePreview *var);
+void TdDestroyObject (struct TdGetWebPagePreview *var);
+void TdStackStorer (struct TdGetWebPagePreview *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::importContacts> TdConvertToInternal (struct TdImportContacts *var);
+struct TdImportContacts *TdConvertFromInternal (const td::td_api::importContacts &from);
+std::string TdToString (struct TdImportContacts *var);
+void TdDestroyObject (struct TdImportContacts *var);
+void TdStackStorer (struct TdImportContacts *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::joinChatByInviteLink> TdConvertToInternal (struct TdJoinChatByInviteLink *var);
+struct TdJoinChatByInviteLink *TdConvertFromInternal (const td::td_api::joinChatByInviteLink &from);
+std::string TdToString (struct TdJoinChatByInviteLink *var);
+void TdDestroyObject (struct TdJoinChatByInviteLink *var);
+void TdStackStorer (struct TdJoinChatByInviteLink *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::logOut> TdConvertToInternal (struct TdLogOut *var);
+struct TdLogOut *TdConvertFromInternal (const td::td_api::logOut &from);
+std::string TdToString (struct TdLogOut *var);
+void TdDestroyObject (struct TdLogOut *var);
+void TdStackStorer (struct TdLogOut *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::openChat> TdConvertToInternal (struct TdOpenChat *var);
+struct TdOpenChat *TdConvertFromInternal (const td::td_api::openChat &from);
+std::string TdToString (struct TdOpenChat *var);
+void TdDestroyObject (struct TdOpenChat *var);
+void TdStackStorer (struct TdOpenChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::openMessageContent> TdConvertToInternal (struct TdOpenMessageContent *var);
+struct TdOpenMessageContent *TdConvertFromInternal (const td::td_api::openMessageContent &from);
+std::string TdToString (struct TdOpenMessageContent *var);
+void TdDestroyObject (struct TdOpenMessageContent *var);
+void TdStackStorer (struct TdOpenMessageContent *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::optimizeStorage> TdConvertToInternal (struct TdOptimizeStorage *var);
+struct TdOptimizeStorage *TdConvertFromInternal (const td::td_api::optimizeStorage &from);
+std::string TdToString (struct TdOptimizeStorage *var);
+void TdDestroyObject (struct TdOptimizeStorage *var);
+void TdStackStorer (struct TdOptimizeStorage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::parseTextEntities> TdConvertToInternal (struct TdParseTextEntities *var);
+struct TdParseTextEntities *TdConvertFromInternal (const td::td_api::parseTextEntities &from);
+std::string TdToString (struct TdParseTextEntities *var);
+void TdDestroyObject (struct TdParseTextEntities *var);
+void TdStackStorer (struct TdParseTextEntities *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::pinSupergroupMessage> TdConvertToInternal (struct TdPinSupergroupMessage *var);
+struct TdPinSupergroupMessage *TdConvertFromInternal (const td::td_api::pinSupergroupMessage &from);
+std::string TdToString (struct TdPinSupergroupMessage *var);
+void TdDestroyObject (struct TdPinSupergroupMessage *var);
+void TdStackStorer (struct TdPinSupergroupMessage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::processDcUpdate> TdConvertToInternal (struct TdProcessDcUpdate *var);
+struct TdProcessDcUpdate *TdConvertFromInternal (const td::td_api::processDcUpdate &from);
+std::string TdToString (struct TdProcessDcUpdate *var);
+void TdDestroyObject (struct TdProcessDcUpdate *var);
+void TdStackStorer (struct TdProcessDcUpdate *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::readAllChatMentions> TdConvertToInternal (struct TdReadAllChatMentions *var);
+struct TdReadAllChatMentions *TdConvertFromInternal (const td::td_api::readAllChatMentions &from);
+std::string TdToString (struct TdReadAllChatMentions *var);
+void TdDestroyObject (struct TdReadAllChatMentions *var);
+void TdStackStorer (struct TdReadAllChatMentions *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::recoverAuthenticationPassword> TdConvertToInternal (struct TdRecoverAuthenticationPassword *var);
+struct TdRecoverAuthenticationPassword *TdConvertFromInternal (const td::td_api::recoverAuthenticationPassword &from);
+std::string TdToString (struct TdRecoverAuthenticationPassword *var);
+void TdDestroyObject (struct TdRecoverAuthenticationPassword *var);
+void TdStackStorer (struct TdRecoverAuthenticationPassword *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::recoverPassword> TdConvertToInternal (struct TdRecoverPassword *var);
+struct TdRecoverPassword *TdConvertFromInternal (const td::td_api::recoverPassword &from);
+std::string TdToString (struct TdRecoverPassword *var);
+void TdDestroyObject (struct TdRecoverPassword *var);
+void TdStackStorer (struct TdRecoverPassword *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::registerDevice> TdConvertToInternal (struct TdRegisterDevice *var);
+struct TdRegisterDevice *TdConvertFromInternal (const td::td_api::registerDevice &from);
+std::string TdToString (struct TdRegisterDevice *var);
+void TdDestroyObject (struct TdRegisterDevice *var);
+void TdStackStorer (struct TdRegisterDevice *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::removeContacts> TdConvertToInternal (struct TdRemoveContacts *var);
+struct TdRemoveContacts *TdConvertFromInternal (const td::td_api::removeContacts &from);
+std::string TdToString (struct TdRemoveContacts *var);
+void TdDestroyObject (struct TdRemoveContacts *var);
+void TdStackStorer (struct TdRemoveContacts *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::removeFavoriteSticker> TdConvertToInternal (struct TdRemoveFavoriteSticker *var);
+struct TdRemoveFavoriteSticker *TdConvertFromInternal (const td::td_api::removeFavoriteSticker &from);
+std::string TdToString (struct TdRemoveFavoriteSticker *var);
+void TdDestroyObject (struct TdRemoveFavoriteSticker *var);
+void TdStackStorer (struct TdRemoveFavoriteSticker *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::removeRecentHashtag> TdConvertToInternal (struct TdRemoveRecentHashtag *var);
+struct TdRemoveRecentHashtag *TdConvertFromInternal (const td::td_api::removeRecentHashtag &from);
+std::string TdToString (struct TdRemoveRecentHashtag *var);
+void TdDestroyObject (struct TdRemoveRecentHashtag *var);
+void TdStackStorer (struct TdRemoveRecentHashtag *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::removeRecentSticker> TdConvertToInternal (struct TdRemoveRecentSticker *var);
+struct TdRemoveRecentSticker *TdConvertFromInternal (const td::td_api::removeRecentSticker &from);
+std::string TdToString (struct TdRemoveRecentSticker *var);
+void TdDestroyObject (struct TdRemoveRecentSticker *var);
+void TdStackStorer (struct TdRemoveRecentSticker *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::removeRecentlyFoundChat> TdConvertToInternal (struct TdRemoveRecentlyFoundChat *var);
+struct TdRemoveRecentlyFoundChat *TdConvertFromInternal (const td::td_api::removeRecentlyFoundChat &from);
+std::string TdToString (struct TdRemoveRecentlyFoundChat *var);
+void TdDestroyObject (struct TdRemoveRecentlyFoundChat *var);
+void TdStackStorer (struct TdRemoveRecentlyFoundChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::removeSavedAnimation> TdConvertToInternal (struct TdRemoveSavedAnimation *var);
+struct TdRemoveSavedAnimation *TdConvertFromInternal (const td::td_api::removeSavedAnimation &from);
+std::string TdToString (struct TdRemoveSavedAnimation *var);
+void TdDestroyObject (struct TdRemoveSavedAnimation *var);
+void TdStackStorer (struct TdRemoveSavedAnimation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::removeStickerFromSet> TdConvertToInternal (struct TdRemoveStickerFromSet *var);
+struct TdRemoveStickerFromSet *TdConvertFromInternal (const td::td_api::removeStickerFromSet &from);
+std::string TdToString (struct TdRemoveStickerFromSet *var);
+void TdDestroyObject (struct TdRemoveStickerFromSet *var);
+void TdStackStorer (struct TdRemoveStickerFromSet *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::removeTopChat> TdConvertToInternal (struct TdRemoveTopChat *var);
+struct TdRemoveTopChat *TdConvertFromInternal (const td::td_api::removeTopChat &from);
+std::string TdToString (struct TdRemoveTopChat *var);
+void TdDestroyObject (struct TdRemoveTopChat *var);
+void TdStackStorer (struct TdRemoveTopChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::reorderInstalledStickerSets> TdConvertToInternal (struct TdReorderInstalledStickerSets *var);
+struct TdReorderInstalledStickerSets *TdConvertFromInternal (const td::td_api::reorderInstalledStickerSets &from);
+std::string TdToString (struct TdReorderInstalledStickerSets *var);
+void TdDestroyObject (struct TdReorderInstalledStickerSets *var);
+void TdStackStorer (struct TdReorderInstalledStickerSets *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::reportChat> TdConvertToInternal (struct TdReportChat *var);
+struct TdReportChat *TdConvertFromInternal (const td::td_api::reportChat &from);
+std::string TdToString (struct TdReportChat *var);
+void TdDestroyObject (struct TdReportChat *var);
+void TdStackStorer (struct TdReportChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::reportSupergroupSpam> TdConvertToInternal (struct TdReportSupergroupSpam *var);
+struct TdReportSupergroupSpam *TdConvertFromInternal (const td::td_api::reportSupergroupSpam &from);
+std::string TdToString (struct TdReportSupergroupSpam *var);
+void TdDestroyObject (struct TdReportSupergroupSpam *var);
+void TdStackStorer (struct TdReportSupergroupSpam *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::requestAuthenticationPasswordRecovery> TdConvertToInternal (struct TdRequestAuthenticationPasswordRecovery *var);
+struct TdRequestAuthenticationPasswordRecovery *TdConvertFromInternal (const td::td_api::requestAuthenticationPasswordRecovery &from);
+std::string TdToString (struct TdRequestAuthenticationPasswordRecovery *var);
+void TdDestroyObject (struct TdRequestAuthenticationPasswordRecovery *var);
+void TdStackStorer (struct TdRequestAuthenticationPasswordRecovery *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::requestPasswordRecovery> TdConvertToInternal (struct TdRequestPasswordRecovery *var);
+struct TdRequestPasswordRecovery *TdConvertFromInternal (const td::td_api::requestPasswordRecovery &from);
+std::string TdToString (struct TdRequestPasswordRecovery *var);
+void TdDestroyObject (struct TdRequestPasswordRecovery *var);
+void TdStackStorer (struct TdRequestPasswordRecovery *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::resendAuthenticationCode> TdConvertToInternal (struct TdResendAuthenticationCode *var);
+struct TdResendAuthenticationCode *TdConvertFromInternal (const td::td_api::resendAuthenticationCode &from);
+std::string TdToString (struct TdResendAuthenticationCode *var);
+void TdDestroyObject (struct TdResendAuthenticationCode *var);
+void TdStackStorer (struct TdResendAuthenticationCode *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::resendChangePhoneNumberCode> TdConvertToInternal (struct TdResendChangePhoneNumberCode *var);
+struct TdResendChangePhoneNumberCode *TdConvertFromInternal (const td::td_api::resendChangePhoneNumberCode &from);
+std::string TdToString (struct TdResendChangePhoneNumberCode *var);
+void TdDestroyObject (struct TdResendChangePhoneNumberCode *var);
+void TdStackStorer (struct TdResendChangePhoneNumberCode *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::resetAllNotificationSettings> TdConvertToInternal (struct TdResetAllNotificationSettings *var);
+struct TdResetAllNotificationSettings *TdConvertFromInternal (const td::td_api::resetAllNotificationSettings &from);
+std::string TdToString (struct TdResetAllNotificationSettings *var);
+void TdDestroyObject (struct TdResetAllNotificationSettings *var);
+void TdStackStorer (struct TdResetAllNotificationSettings *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::resetNetworkStatistics> TdConvertToInternal (struct TdResetNetworkStatistics *var);
+struct TdResetNetworkStatistics *TdConvertFromInternal (const td::td_api::resetNetworkStatistics &from);
+std::string TdToString (struct TdResetNetworkStatistics *var);
+void TdDestroyObject (struct TdResetNetworkStatistics *var);
+void TdStackStorer (struct TdResetNetworkStatistics *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchCallMessages> TdConvertToInternal (struct TdSearchCallMessages *var);
+struct TdSearchCallMessages *TdConvertFromInternal (const td::td_api::searchCallMessages &from);
+std::string TdToString (struct TdSearchCallMessages *var);
+void TdDestroyObject (struct TdSearchCallMessages *var);
+void TdStackStorer (struct TdSearchCallMessages *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchChatMembers> TdConvertToInternal (struct TdSearchChatMembers *var);
+struct TdSearchChatMembers *TdConvertFromInternal (const td::td_api::searchChatMembers &from);
+std::string TdToString (struct TdSearchChatMembers *var);
+void TdDestroyObject (struct TdSearchChatMembers *var);
+void TdStackStorer (struct TdSearchChatMembers *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchChatMessages> TdConvertToInternal (struct TdSearchChatMessages *var);
+struct TdSearchChatMessages *TdConvertFromInternal (const td::td_api::searchChatMessages &from);
+std::string TdToString (struct TdSearchChatMessages *var);
+void TdDestroyObject (struct TdSearchChatMessages *var);
+void TdStackStorer (struct TdSearchChatMessages *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchChatRecentLocationMessages> TdConvertToInternal (struct TdSearchChatRecentLocationMessages *var);
+struct TdSearchChatRecentLocationMessages *TdConvertFromInternal (const td::td_api::searchChatRecentLocationMessages &from);
+std::string TdToString (struct TdSearchChatRecentLocationMessages *var);
+void TdDestroyObject (struct TdSearchChatRecentLocationMessages *var);
+void TdStackStorer (struct TdSearchChatRecentLocationMessages *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchChats> TdConvertToInternal (struct TdSearchChats *var);
+struct TdSearchChats *TdConvertFromInternal (const td::td_api::searchChats &from);
+std::string TdToString (struct TdSearchChats *var);
+void TdDestroyObject (struct TdSearchChats *var);
+void TdStackStorer (struct TdSearchChats *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchChatsOnServer> TdConvertToInternal (struct TdSearchChatsOnServer *var);
+struct TdSearchChatsOnServer *TdConvertFromInternal (const td::td_api::searchChatsOnServer &from);
+std::string TdToString (struct TdSearchChatsOnServer *var);
+void TdDestroyObject (struct TdSearchChatsOnServer *var);
+void TdStackStorer (struct TdSearchChatsOnServer *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchContacts> TdConvertToInternal (struct TdSearchContacts *var);
+struct TdSearchContacts *TdConvertFromInternal (const td::td_api::searchContacts &from);
+std::string TdToString (struct TdSearchContacts *var);
+void TdDestroyObject (struct TdSearchContacts *var);
+void TdStackStorer (struct TdSearchContacts *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchHashtags> TdConvertToInternal (struct TdSearchHashtags *var);
+struct TdSearchHashtags *TdConvertFromInternal (const td::td_api::searchHashtags &from);
+std::string TdToString (struct TdSearchHashtags *var);
+void TdDestroyObject (struct TdSearchHashtags *var);
+void TdStackStorer (struct TdSearchHashtags *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchMessages> TdConvertToInternal (struct TdSearchMessages *var);
+struct TdSearchMessages *TdConvertFromInternal (const td::td_api::searchMessages &from);
+std::string TdToString (struct TdSearchMessages *var);
+void TdDestroyObject (struct TdSearchMessages *var);
+void TdStackStorer (struct TdSearchMessages *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchPublicChat> TdConvertToInternal (struct TdSearchPublicChat *var);
+struct TdSearchPublicChat *TdConvertFromInternal (const td::td_api::searchPublicChat &from);
+std::string TdToString (struct TdSearchPublicChat *var);
+void TdDestroyObject (struct TdSearchPublicChat *var);
+void TdStackStorer (struct TdSearchPublicChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchPublicChats> TdConvertToInternal (struct TdSearchPublicChats *var);
+struct TdSearchPublicChats *TdConvertFromInternal (const td::td_api::searchPublicChats &from);
+std::string TdToString (struct TdSearchPublicChats *var);
+void TdDestroyObject (struct TdSearchPublicChats *var);
+void TdStackStorer (struct TdSearchPublicChats *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchSecretMessages> TdConvertToInternal (struct TdSearchSecretMessages *var);
+struct TdSearchSecretMessages *TdConvertFromInternal (const td::td_api::searchSecretMessages &from);
+std::string TdToString (struct TdSearchSecretMessages *var);
+void TdDestroyObject (struct TdSearchSecretMessages *var);
+void TdStackStorer (struct TdSearchSecretMessages *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::searchStickerSet> TdConvertToInternal (struct TdSearchStickerSet *var);
+struct TdSearchStickerSet *TdConvertFromInternal (const td::td_api::searchStickerSet &from);
+std::string TdToString (struct TdSearchStickerSet *var);
+void TdDestroyObject (struct TdSearchStickerSet *var);
+void TdStackStorer (struct TdSearchStickerSet *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::sendBotStartMessage> TdConvertToInternal (struct TdSendBotStartMessage *var);
+struct TdSendBotStartMessage *TdConvertFromInternal (const td::td_api::sendBotStartMessage &from);
+std::string TdToString (struct TdSendBotStartMessage *var);
+void TdDestroyObject (struct TdSendBotStartMessage *var);
+void TdStackStorer (struct TdSendBotStartMessage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::sendCallDebugInformation> TdConvertToInternal (struct TdSendCallDebugInformation *var);
+struct TdSendCallDebugInformation *TdConvertFromInternal (const td::td_api::sendCallDebugInformation &from);
+std::string TdToString (struct TdSendCallDebugInformation *var);
+void TdDestroyObject (struct TdSendCallDebugInformation *var);
+void TdStackStorer (struct TdSendCallDebugInformation *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::sendCallRating> TdConvertToInternal (struct TdSendCallRating *var);
+struct TdSendCallRating *TdConvertFromInternal (const td::td_api::sendCallRating &from);
+std::string TdToString (struct TdSendCallRating *var);
+void TdDestroyObject (struct TdSendCallRating *var);
+void TdStackStorer (struct TdSendCallRating *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::sendChatAction> TdConvertToInternal (struct TdSendChatAction *var);
+struct TdSendChatAction *TdConvertFromInternal (const td::td_api::sendChatAction &from);
+std::string TdToString (struct TdSendChatAction *var);
+void TdDestroyObject (struct TdSendChatAction *var);
+void TdStackStorer (struct TdSendChatAction *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::sendChatScreenshotTakenNotification> TdConvertToInternal (struct TdSendChatScreenshotTakenNotification *var);
+struct TdSendChatScreenshotTakenNotification *TdConvertFromInternal (const td::td_api::sendChatScreenshotTakenNotification &from);
+std::string TdToString (struct TdSendChatScreenshotTakenNotification *var);
+void TdDestroyObject (struct TdSendChatScreenshotTakenNotification *var);
+void TdStackStorer (struct TdSendChatScreenshotTakenNotification *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::sendChatSetTtlMessage> TdConvertToInternal (struct TdSendChatSetTtlMessage *var);
+struct TdSendChatSetTtlMessage *TdConvertFromInternal (const td::td_api::sendChatSetTtlMessage &from);
+std::string TdToString (struct TdSendChatSetTtlMessage *var);
+void TdDestroyObject (struct TdSendChatSetTtlMessage *var);
+void TdStackStorer (struct TdSendChatSetTtlMessage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::sendCustomRequest> TdConvertToInternal (struct TdSendCustomRequest *var);
+struct TdSendCustomRequest *TdConvertFromInternal (const td::td_api::sendCustomRequest &from);
+std::string TdToString (struct TdSendCustomRequest *var);
+void TdDestroyObject (struct TdSendCustomRequest *var);
+void TdStackStorer (struct TdSendCustomRequest *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::sendInlineQueryResultMessage> TdConvertToInternal (struct TdSendInlineQueryResultMessage *var);
+struct TdSendInlineQueryResultMessage *TdConvertFromInternal (const td::td_api::sendInlineQueryResultMessage &from);
+std::string TdToString (struct TdSendInlineQueryResultMessage *var);
+void TdDestroyObject (struct TdSendInlineQueryResultMessage *var);
+void TdStackStorer (struct TdSendInlineQueryResultMessage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::sendMessage> TdConvertToInternal (struct TdSendMessage *var);
+struct TdSendMessage *TdConvertFromInternal (const td::td_api::sendMessage &from);
+std::string TdToString (struct TdSendMessage *var);
+void TdDestroyObject (struct TdSendMessage *var);
+void TdStackStorer (struct TdSendMessage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::sendMessageAlbum> TdConvertToInternal (struct TdSendMessageAlbum *var);
+struct TdSendMessageAlbum *TdConvertFromInternal (const td::td_api::sendMessageAlbum &from);
+std::string TdToString (struct TdSendMessageAlbum *var);
+void TdDestroyObject (struct TdSendMessageAlbum *var);
+void TdStackStorer (struct TdSendMessageAlbum *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::sendPaymentForm> TdConvertToInternal (struct TdSendPaymentForm *var);
+struct TdSendPaymentForm *TdConvertFromInternal (const td::td_api::sendPaymentForm &from);
+std::string TdToString (struct TdSendPaymentForm *var);
+void TdDestroyObject (struct TdSendPaymentForm *var);
+void TdStackStorer (struct TdSendPaymentForm *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setAccountTtl> TdConvertToInternal (struct TdSetAccountTtl *var);
+struct TdSetAccountTtl *TdConvertFromInternal (const td::td_api::setAccountTtl &from);
+std::string TdToString (struct TdSetAccountTtl *var);
+void TdDestroyObject (struct TdSetAccountTtl *var);
+void TdStackStorer (struct TdSetAccountTtl *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setAlarm> TdConvertToInternal (struct TdSetAlarm *var);
+struct TdSetAlarm *TdConvertFromInternal (const td::td_api::setAlarm &from);
+std::string TdToString (struct TdSetAlarm *var);
+void TdDestroyObject (struct TdSetAlarm *var);
+void TdStackStorer (struct TdSetAlarm *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setAuthenticationPhoneNumber> TdConvertToInternal (struct TdSetAuthenticationPhoneNumber *var);
+struct TdSetAuthenticationPhoneNumber *TdConvertFromInternal (const td::td_api::setAuthenticationPhoneNumber &from);
+std::string TdToString (struct TdSetAuthenticationPhoneNumber *var);
+void TdDestroyObject (struct TdSetAuthenticationPhoneNumber *var);
+void TdStackStorer (struct TdSetAuthenticationPhoneNumber *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setBio> TdConvertToInternal (struct TdSetBio *var);
+struct TdSetBio *TdConvertFromInternal (const td::td_api::setBio &from);
+std::string TdToString (struct TdSetBio *var);
+void TdDestroyObject (struct TdSetBio *var);
+void TdStackStorer (struct TdSetBio *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setBotUpdatesStatus> TdConvertToInternal (struct TdSetBotUpdatesStatus *var);
+struct TdSetBotUpdatesStatus *TdConvertFromInternal (const td::td_api::setBotUpdatesStatus &from);
+std::string TdToString (struct TdSetBotUpdatesStatus *var);
+void TdDestroyObject (struct TdSetBotUpdatesStatus *var);
+void TdStackStorer (struct TdSetBotUpdatesStatus *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setChatClientData> TdConvertToInternal (struct TdSetChatClientData *var);
+struct TdSetChatClientData *TdConvertFromInternal (const td::td_api::setChatClientData &from);
+std::string TdToString (struct TdSetChatClientData *var);
+void TdDestroyObject (struct TdSetChatClientData *var);
+void TdStackStorer (struct TdSetChatClientData *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setChatDraftMessage> TdConvertToInternal (struct TdSetChatDraftMessage *var);
+struct TdSetChatDraftMessage *TdConvertFromInternal (const td::td_api::setChatDraftMessage &from);
+std::string TdToString (struct TdSetChatDraftMessage *var);
+void TdDestroyObject (struct TdSetChatDraftMessage *var);
+void TdStackStorer (struct TdSetChatDraftMessage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setChatMemberStatus> TdConvertToInternal (struct TdSetChatMemberStatus *var);
+struct TdSetChatMemberStatus *TdConvertFromInternal (const td::td_api::setChatMemberStatus &from);
+std::string TdToString (struct TdSetChatMemberStatus *var);
+void TdDestroyObject (struct TdSetChatMemberStatus *var);
+void TdStackStorer (struct TdSetChatMemberStatus *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setChatPhoto> TdConvertToInternal (struct TdSetChatPhoto *var);
+struct TdSetChatPhoto *TdConvertFromInternal (const td::td_api::setChatPhoto &from);
+std::string TdToString (struct TdSetChatPhoto *var);
+void TdDestroyObject (struct TdSetChatPhoto *var);
+void TdStackStorer (struct TdSetChatPhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setChatTitle> TdConvertToInternal (struct TdSetChatTitle *var);
+struct TdSetChatTitle *TdConvertFromInternal (const td::td_api::setChatTitle &from);
+std::string TdToString (struct TdSetChatTitle *var);
+void TdDestroyObject (struct TdSetChatTitle *var);
+void TdStackStorer (struct TdSetChatTitle *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setDatabaseEncryptionKey> TdConvertToInternal (struct TdSetDatabaseEncryptionKey *var);
+struct TdSetDatabaseEncryptionKey *TdConvertFromInternal (const td::td_api::setDatabaseEncryptionKey &from);
+std::string TdToString (struct TdSetDatabaseEncryptionKey *var);
+void TdDestroyObject (struct TdSetDatabaseEncryptionKey *var);
+void TdStackStorer (struct TdSetDatabaseEncryptionKey *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setFileGenerationProgress> TdConvertToInternal (struct TdSetFileGenerationProgress *var);
+struct TdSetFileGenerationProgress *TdConvertFromInternal (const td::td_api::setFileGenerationProgress &from);
+std::string TdToString (struct TdSetFileGenerationProgress *var);
+void TdDestroyObject (struct TdSetFileGenerationProgress *var);
+void TdStackStorer (struct TdSetFileGenerationProgress *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setGameScore> TdConvertToInternal (struct TdSetGameScore *var);
+struct TdSetGameScore *TdConvertFromInternal (const td::td_api::setGameScore &from);
+std::string TdToString (struct TdSetGameScore *var);
+void TdDestroyObject (struct TdSetGameScore *var);
+void TdStackStorer (struct TdSetGameScore *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setInlineGameScore> TdConvertToInternal (struct TdSetInlineGameScore *var);
+struct TdSetInlineGameScore *TdConvertFromInternal (const td::td_api::setInlineGameScore &from);
+std::string TdToString (struct TdSetInlineGameScore *var);
+void TdDestroyObject (struct TdSetInlineGameScore *var);
+void TdStackStorer (struct TdSetInlineGameScore *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setName> TdConvertToInternal (struct TdSetName *var);
+struct TdSetName *TdConvertFromInternal (const td::td_api::setName &from);
+std::string TdToString (struct TdSetName *var);
+void TdDestroyObject (struct TdSetName *var);
+void TdStackStorer (struct TdSetName *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setNetworkType> TdConvertToInternal (struct TdSetNetworkType *var);
+struct TdSetNetworkType *TdConvertFromInternal (const td::td_api::setNetworkType &from);
+std::string TdToString (struct TdSetNetworkType *var);
+void TdDestroyObject (struct TdSetNetworkType *var);
+void TdStackStorer (struct TdSetNetworkType *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setNotificationSettings> TdConvertToInternal (struct TdSetNotificationSettings *var);
+struct TdSetNotificationSettings *TdConvertFromInternal (const td::td_api::setNotificationSettings &from);
+std::string TdToString (struct TdSetNotificationSettings *var);
+void TdDestroyObject (struct TdSetNotificationSettings *var);
+void TdStackStorer (struct TdSetNotificationSettings *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setOption> TdConvertToInternal (struct TdSetOption *var);
+struct TdSetOption *TdConvertFromInternal (const td::td_api::setOption &from);
+std::string TdToString (struct TdSetOption *var);
+void TdDestroyObject (struct TdSetOption *var);
+void TdStackStorer (struct TdSetOption *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setPassword> TdConvertToInternal (struct TdSetPassword *var);
+struct TdSetPassword *TdConvertFromInternal (const td::td_api::setPassword &from);
+std::string TdToString (struct TdSetPassword *var);
+void TdDestroyObject (struct TdSetPassword *var);
+void TdStackStorer (struct TdSetPassword *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setPinnedChats> TdConvertToInternal (struct TdSetPinnedChats *var);
+struct TdSetPinnedChats *TdConvertFromInternal (const td::td_api::setPinnedChats &from);
+std::string TdToString (struct TdSetPinnedChats *var);
+void TdDestroyObject (struct TdSetPinnedChats *var);
+void TdStackStorer (struct TdSetPinnedChats *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setProfilePhoto> TdConvertToInternal (struct TdSetProfilePhoto *var);
+struct TdSetProfilePhoto *TdConvertFromInternal (const td::td_api::setProfilePhoto &from);
+std::string TdToString (struct TdSetProfilePhoto *var);
+void TdDestroyObject (struct TdSetProfilePhoto *var);
+void TdStackStorer (struct TdSetProfilePhoto *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setProxy> TdConvertToInternal (struct TdSetProxy *var);
+struct TdSetProxy *TdConvertFromInternal (const td::td_api::setProxy &from);
+std::string TdToString (struct TdSetProxy *var);
+void TdDestroyObject (struct TdSetProxy *var);
+void TdStackStorer (struct TdSetProxy *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setRecoveryEmailAddress> TdConvertToInternal (struct TdSetRecoveryEmailAddress *var);
+struct TdSetRecoveryEmailAddress *TdConvertFromInternal (const td::td_api::setRecoveryEmailAddress &from);
+std::string TdToString (struct TdSetRecoveryEmailAddress *var);
+void TdDestroyObject (struct TdSetRecoveryEmailAddress *var);
+void TdStackStorer (struct TdSetRecoveryEmailAddress *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setStickerPositionInSet> TdConvertToInternal (struct TdSetStickerPositionInSet *var);
+struct TdSetStickerPositionInSet *TdConvertFromInternal (const td::td_api::setStickerPositionInSet &from);
+std::string TdToString (struct TdSetStickerPositionInSet *var);
+void TdDestroyObject (struct TdSetStickerPositionInSet *var);
+void TdStackStorer (struct TdSetStickerPositionInSet *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setSupergroupDescription> TdConvertToInternal (struct TdSetSupergroupDescription *var);
+struct TdSetSupergroupDescription *TdConvertFromInternal (const td::td_api::setSupergroupDescription &from);
+std::string TdToString (struct TdSetSupergroupDescription *var);
+void TdDestroyObject (struct TdSetSupergroupDescription *var);
+void TdStackStorer (struct TdSetSupergroupDescription *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setSupergroupStickerSet> TdConvertToInternal (struct TdSetSupergroupStickerSet *var);
+struct TdSetSupergroupStickerSet *TdConvertFromInternal (const td::td_api::setSupergroupStickerSet &from);
+std::string TdToString (struct TdSetSupergroupStickerSet *var);
+void TdDestroyObject (struct TdSetSupergroupStickerSet *var);
+void TdStackStorer (struct TdSetSupergroupStickerSet *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setSupergroupUsername> TdConvertToInternal (struct TdSetSupergroupUsername *var);
+struct TdSetSupergroupUsername *TdConvertFromInternal (const td::td_api::setSupergroupUsername &from);
+std::string TdToString (struct TdSetSupergroupUsername *var);
+void TdDestroyObject (struct TdSetSupergroupUsername *var);
+void TdStackStorer (struct TdSetSupergroupUsername *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setTdlibParameters> TdConvertToInternal (struct TdSetTdlibParameters *var);
+struct TdSetTdlibParameters *TdConvertFromInternal (const td::td_api::setTdlibParameters &from);
+std::string TdToString (struct TdSetTdlibParameters *var);
+void TdDestroyObject (struct TdSetTdlibParameters *var);
+void TdStackStorer (struct TdSetTdlibParameters *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setUserPrivacySettingRules> TdConvertToInternal (struct TdSetUserPrivacySettingRules *var);
+struct TdSetUserPrivacySettingRules *TdConvertFromInternal (const td::td_api::setUserPrivacySettingRules &from);
+std::string TdToString (struct TdSetUserPrivacySettingRules *var);
+void TdDestroyObject (struct TdSetUserPrivacySettingRules *var);
+void TdStackStorer (struct TdSetUserPrivacySettingRules *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::setUsername> TdConvertToInternal (struct TdSetUsername *var);
+struct TdSetUsername *TdConvertFromInternal (const td::td_api::setUsername &from);
+std::string TdToString (struct TdSetUsername *var);
+void TdDestroyObject (struct TdSetUsername *var);
+void TdStackStorer (struct TdSetUsername *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::terminateAllOtherSessions> TdConvertToInternal (struct TdTerminateAllOtherSessions *var);
+struct TdTerminateAllOtherSessions *TdConvertFromInternal (const td::td_api::terminateAllOtherSessions &from);
+std::string TdToString (struct TdTerminateAllOtherSessions *var);
+void TdDestroyObject (struct TdTerminateAllOtherSessions *var);
+void TdStackStorer (struct TdTerminateAllOtherSessions *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::terminateSession> TdConvertToInternal (struct TdTerminateSession *var);
+struct TdTerminateSession *TdConvertFromInternal (const td::td_api::terminateSession &from);
+std::string TdToString (struct TdTerminateSession *var);
+void TdDestroyObject (struct TdTerminateSession *var);
+void TdStackStorer (struct TdTerminateSession *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testCallBytes> TdConvertToInternal (struct TdTestCallBytes *var);
+struct TdTestCallBytes *TdConvertFromInternal (const td::td_api::testCallBytes &from);
+std::string TdToString (struct TdTestCallBytes *var);
+void TdDestroyObject (struct TdTestCallBytes *var);
+void TdStackStorer (struct TdTestCallBytes *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testCallEmpty> TdConvertToInternal (struct TdTestCallEmpty *var);
+struct TdTestCallEmpty *TdConvertFromInternal (const td::td_api::testCallEmpty &from);
+std::string TdToString (struct TdTestCallEmpty *var);
+void TdDestroyObject (struct TdTestCallEmpty *var);
+void TdStackStorer (struct TdTestCallEmpty *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testCallString> TdConvertToInternal (struct TdTestCallString *var);
+struct TdTestCallString *TdConvertFromInternal (const td::td_api::testCallString &from);
+std::string TdToString (struct TdTestCallString *var);
+void TdDestroyObject (struct TdTestCallString *var);
+void TdStackStorer (struct TdTestCallString *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testCallVectorInt> TdConvertToInternal (struct TdTestCallVectorInt *var);
+struct TdTestCallVectorInt *TdConvertFromInternal (const td::td_api::testCallVectorInt &from);
+std::string TdToString (struct TdTestCallVectorInt *var);
+void TdDestroyObject (struct TdTestCallVectorInt *var);
+void TdStackStorer (struct TdTestCallVectorInt *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testCallVectorIntObject> TdConvertToInternal (struct TdTestCallVectorIntObject *var);
+struct TdTestCallVectorIntObject *TdConvertFromInternal (const td::td_api::testCallVectorIntObject &from);
+std::string TdToString (struct TdTestCallVectorIntObject *var);
+void TdDestroyObject (struct TdTestCallVectorIntObject *var);
+void TdStackStorer (struct TdTestCallVectorIntObject *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testCallVectorString> TdConvertToInternal (struct TdTestCallVectorString *var);
+struct TdTestCallVectorString *TdConvertFromInternal (const td::td_api::testCallVectorString &from);
+std::string TdToString (struct TdTestCallVectorString *var);
+void TdDestroyObject (struct TdTestCallVectorString *var);
+void TdStackStorer (struct TdTestCallVectorString *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testCallVectorStringObject> TdConvertToInternal (struct TdTestCallVectorStringObject *var);
+struct TdTestCallVectorStringObject *TdConvertFromInternal (const td::td_api::testCallVectorStringObject &from);
+std::string TdToString (struct TdTestCallVectorStringObject *var);
+void TdDestroyObject (struct TdTestCallVectorStringObject *var);
+void TdStackStorer (struct TdTestCallVectorStringObject *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testGetDifference> TdConvertToInternal (struct TdTestGetDifference *var);
+struct TdTestGetDifference *TdConvertFromInternal (const td::td_api::testGetDifference &from);
+std::string TdToString (struct TdTestGetDifference *var);
+void TdDestroyObject (struct TdTestGetDifference *var);
+void TdStackStorer (struct TdTestGetDifference *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testNetwork> TdConvertToInternal (struct TdTestNetwork *var);
+struct TdTestNetwork *TdConvertFromInternal (const td::td_api::testNetwork &from);
+std::string TdToString (struct TdTestNetwork *var);
+void TdDestroyObject (struct TdTestNetwork *var);
+void TdStackStorer (struct TdTestNetwork *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testSquareInt> TdConvertToInternal (struct TdTestSquareInt *var);
+struct TdTestSquareInt *TdConvertFromInternal (const td::td_api::testSquareInt &from);
+std::string TdToString (struct TdTestSquareInt *var);
+void TdDestroyObject (struct TdTestSquareInt *var);
+void TdStackStorer (struct TdTestSquareInt *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testUseError> TdConvertToInternal (struct TdTestUseError *var);
+struct TdTestUseError *TdConvertFromInternal (const td::td_api::testUseError &from);
+std::string TdToString (struct TdTestUseError *var);
+void TdDestroyObject (struct TdTestUseError *var);
+void TdStackStorer (struct TdTestUseError *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::testUseUpdate> TdConvertToInternal (struct TdTestUseUpdate *var);
+struct TdTestUseUpdate *TdConvertFromInternal (const td::td_api::testUseUpdate &from);
+std::string TdToString (struct TdTestUseUpdate *var);
+void TdDestroyObject (struct TdTestUseUpdate *var);
+void TdStackStorer (struct TdTestUseUpdate *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::toggleBasicGroupAdministrators> TdConvertToInternal (struct TdToggleBasicGroupAdministrators *var);
+struct TdToggleBasicGroupAdministrators *TdConvertFromInternal (const td::td_api::toggleBasicGroupAdministrators &from);
+std::string TdToString (struct TdToggleBasicGroupAdministrators *var);
+void TdDestroyObject (struct TdToggleBasicGroupAdministrators *var);
+void TdStackStorer (struct TdToggleBasicGroupAdministrators *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::toggleChatIsPinned> TdConvertToInternal (struct TdToggleChatIsPinned *var);
+struct TdToggleChatIsPinned *TdConvertFromInternal (const td::td_api::toggleChatIsPinned &from);
+std::string TdToString (struct TdToggleChatIsPinned *var);
+void TdDestroyObject (struct TdToggleChatIsPinned *var);
+void TdStackStorer (struct TdToggleChatIsPinned *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::toggleSupergroupInvites> TdConvertToInternal (struct TdToggleSupergroupInvites *var);
+struct TdToggleSupergroupInvites *TdConvertFromInternal (const td::td_api::toggleSupergroupInvites &from);
+std::string TdToString (struct TdToggleSupergroupInvites *var);
+void TdDestroyObject (struct TdToggleSupergroupInvites *var);
+void TdStackStorer (struct TdToggleSupergroupInvites *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::toggleSupergroupIsAllHistoryAvailable> TdConvertToInternal (struct TdToggleSupergroupIsAllHistoryAvailable *var);
+struct TdToggleSupergroupIsAllHistoryAvailable *TdConvertFromInternal (const td::td_api::toggleSupergroupIsAllHistoryAvailable &from);
+std::string TdToString (struct TdToggleSupergroupIsAllHistoryAvailable *var);
+void TdDestroyObject (struct TdToggleSupergroupIsAllHistoryAvailable *var);
+void TdStackStorer (struct TdToggleSupergroupIsAllHistoryAvailable *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::toggleSupergroupSignMessages> TdConvertToInternal (struct TdToggleSupergroupSignMessages *var);
+struct TdToggleSupergroupSignMessages *TdConvertFromInternal (const td::td_api::toggleSupergroupSignMessages &from);
+std::string TdToString (struct TdToggleSupergroupSignMessages *var);
+void TdDestroyObject (struct TdToggleSupergroupSignMessages *var);
+void TdStackStorer (struct TdToggleSupergroupSignMessages *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::unblockUser> TdConvertToInternal (struct TdUnblockUser *var);
+struct TdUnblockUser *TdConvertFromInternal (const td::td_api::unblockUser &from);
+std::string TdToString (struct TdUnblockUser *var);
+void TdDestroyObject (struct TdUnblockUser *var);
+void TdStackStorer (struct TdUnblockUser *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::unpinSupergroupMessage> TdConvertToInternal (struct TdUnpinSupergroupMessage *var);
+struct TdUnpinSupergroupMessage *TdConvertFromInternal (const td::td_api::unpinSupergroupMessage &from);
+std::string TdToString (struct TdUnpinSupergroupMessage *var);
+void TdDestroyObject (struct TdUnpinSupergroupMessage *var);
+void TdStackStorer (struct TdUnpinSupergroupMessage *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::upgradeBasicGroupChatToSupergroupChat> TdConvertToInternal (struct TdUpgradeBasicGroupChatToSupergroupChat *var);
+struct TdUpgradeBasicGroupChatToSupergroupChat *TdConvertFromInternal (const td::td_api::upgradeBasicGroupChatToSupergroupChat &from);
+std::string TdToString (struct TdUpgradeBasicGroupChatToSupergroupChat *var);
+void TdDestroyObject (struct TdUpgradeBasicGroupChatToSupergroupChat *var);
+void TdStackStorer (struct TdUpgradeBasicGroupChatToSupergroupChat *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::uploadFile> TdConvertToInternal (struct TdUploadFile *var);
+struct TdUploadFile *TdConvertFromInternal (const td::td_api::uploadFile &from);
+std::string TdToString (struct TdUploadFile *var);
+void TdDestroyObject (struct TdUploadFile *var);
+void TdStackStorer (struct TdUploadFile *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::uploadStickerFile> TdConvertToInternal (struct TdUploadStickerFile *var);
+struct TdUploadStickerFile *TdConvertFromInternal (const td::td_api::uploadStickerFile &from);
+std::string TdToString (struct TdUploadStickerFile *var);
+void TdDestroyObject (struct TdUploadStickerFile *var);
+void TdStackStorer (struct TdUploadStickerFile *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::validateOrderInfo> TdConvertToInternal (struct TdValidateOrderInfo *var);
+struct TdValidateOrderInfo *TdConvertFromInternal (const td::td_api::validateOrderInfo &from);
+std::string TdToString (struct TdValidateOrderInfo *var);
+void TdDestroyObject (struct TdValidateOrderInfo *var);
+void TdStackStorer (struct TdValidateOrderInfo *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::viewMessages> TdConvertToInternal (struct TdViewMessages *var);
+struct TdViewMessages *TdConvertFromInternal (const td::td_api::viewMessages &from);
+std::string TdToString (struct TdViewMessages *var);
+void TdDestroyObject (struct TdViewMessages *var);
+void TdStackStorer (struct TdViewMessages *var, struct TdStackStorerMethods *M);
+td::td_api::object_ptr<td::td_api::viewTrendingStickerSets> TdConvertToInternal (struct TdViewTrendingStickerSets *var);
+struct TdViewTrendingStickerSets *TdConvertFromInternal (const td::td_api::viewTrendingStickerSets &from);
+std::string TdToString (struct TdViewTrendingStickerSets *var);
+void TdDestroyObject (struct TdViewTrendingStickerSets *var);
+void TdStackStorer (struct TdViewTrendingStickerSets *var, struct TdStackStorerMethods *M);
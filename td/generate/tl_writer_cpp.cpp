@@ -515,16 +515,30 @@ std::string TD_TL_writer_cpp::gen_fetch_function_begin(const std::string &parser
   std::string fetched_type = "object_ptr<" + class_name + "> ";
   assert(arity == 0);
 
+  bool use_arena = use_arena_allocation() && parser_name == "TlBufferParser";
+
   if (parser_type == 0) {
-    return "\n" + class_name + "::" + class_name + "(" + parser_name +
+    std::string arena_fetch;
+    if (use_arena) {
+      arena_fetch = "\n" + fetched_type + class_name + "::fetch(" + parser_name +
+                    " &p) {\n"
+                    "  return object_ptr<" +
+                    class_name + ">(new (p.get_arena()) " + class_name +
+                    "(p));\n"
+                    "}\n";
+    }
+    return arena_fetch + "\n" + class_name + "::" + class_name + "(" + parser_name +
            " &p)\n"
            "#define FAIL(error) p.set_error(error)\n";
   }
 
+  std::string create_object =
+      use_arena ? "(new (p.get_arena()) " + class_name + "())" : " = make_tl_object<" + class_name + ">()";
+
   return "\n" + fetched_type + class_name + "::fetch(" + parser_name +
          " &p) {\n"
          "#define FAIL(error) p.set_error(error); return nullptr;\n" +
-         (parser_type == -1 ? "" : "  " + fetched_type + "res = make_tl_object<" + class_name + ">();\n");
+         (parser_type == -1 ? "" : "  " + fetched_type + "res" + create_object + ";\n");
 }
 
 std::string TD_TL_writer_cpp::gen_fetch_function_end(int field_num, const std::vector<tl::var_description> &vars,
@@ -663,4 +677,103 @@ std::string TD_TL_writer_cpp::gen_constructor_end(const tl::tl_combinator *t, in
   return "{}\n";
 }
 
+
+std::string TD_TL_writer_cpp::gen_field_skip(const tl::arg &a, std::vector<tl::var_description> &vars) const {
+  assert(a.type->get_type() == tl::NODE_TYPE_TYPE);
+  assert(!(a.flags & tl::FLAG_EXCL));
+  assert(!(a.flags & tl::FLAG_OPT_VAR));
+  const tl::tl_tree_type *tree_type = static_cast<tl::tl_tree_type *>(a.type);
+
+  std::string res = "  ";
+  if (a.exist_var_num != -1) {
+    assert(0 <= a.exist_var_num && a.exist_var_num < static_cast<int>(vars.size()));
+    assert(vars[a.exist_var_num].is_stored);
+
+    res += "if (" + gen_var_name(vars[a.exist_var_num]) + " & " + int_to_string(1 << a.exist_var_bit) + ") { ";
+  }
+
+  bool store_to_var_num = false;
+  if (a.var_num >= 0) {
+    assert(tree_type->type->id == tl::ID_VAR_NUM);
+    assert(0 <= a.var_num && a.var_num < static_cast<int>(vars.size()));
+    assert(!vars[a.var_num].is_stored);
+    vars[a.var_num].is_stored = true;
+    store_to_var_num = true;
+
+    res += "if ((" + gen_var_name(vars[a.var_num]) + " = " + gen_full_fetch_class_name(tree_type) +
+           "::parse(p)) < 0) { p.set_error(\"Variable of type # can't be negative\"); return; }";
+  } else {
+    res += gen_full_fetch_class_name(tree_type) + "::skip(p);";
+  }
+
+  if (a.exist_var_num >= 0) {
+    res += " }";
+    if (store_to_var_num) {
+      res += " else { " + gen_var_name(vars[a.var_num]) + " = 0; }";
+    }
+  }
+  return res + "\n";
+}
+
+std::string TD_TL_writer_cpp::gen_additional_function(const std::string &function_name, const tl::tl_combinator *t,
+                                                      bool is_function) const {
+  assert(function_name == "skip");
+  if (is_function) {
+    return "";
+  }
+
+  std::vector<tl::var_description> vars(t->var_count);
+  std::string res = "\nvoid " + gen_class_name(t->name) + "::skip(TlBufferParser &p) {\n" + gen_vars(t, nullptr, vars);
+  if (t->args.empty()) {
+    res += "  (void)p;\n";
+  }
+  for (std::size_t i = 0; i < t->args.size(); i++) {
+    res += gen_field_skip(t->args[i], vars);
+  }
+  return res + "}\n";
+}
+
+std::string TD_TL_writer_cpp::gen_additional_proxy_function_begin(const std::string &function_name,
+                                                                  const tl::tl_type *type,
+                                                                  const std::string &class_name, int arity,
+                                                                  bool is_function) const {
+  assert(function_name == "skip");
+  if (is_function) {
+    return "";
+  }
+  return "\nvoid " + class_name + "::skip(TlBufferParser &p) {\n" + gen_fetch_switch_begin();
+}
+
+std::string TD_TL_writer_cpp::gen_additional_proxy_function_case(const std::string &function_name,
+                                                                 const tl::tl_type *type,
+                                                                 const std::string &class_name, int arity) const {
+  assert(function_name == "skip");
+  return "";
+}
+
+std::string TD_TL_writer_cpp::gen_additional_proxy_function_case(const std::string &function_name,
+                                                                 const tl::tl_type *type, const tl::tl_combinator *t,
+                                                                 int arity, bool is_function) const {
+  assert(function_name == "skip");
+  if (is_function) {
+    return "";
+  }
+  return "    case " + gen_class_name(t->name) +
+         "::ID:\n"
+         "      return " +
+         gen_class_name(t->name) + "::skip(p);\n";
+}
+
+std::string TD_TL_writer_cpp::gen_additional_proxy_function_end(const std::string &function_name,
+                                                                const tl::tl_type *type, bool is_function) const {
+  assert(function_name == "skip");
+  if (is_function) {
+    return "";
+  }
+  return "    default:\n"
+         "      p.set_error(PSTRING() << \"Unknown constructor found \" << format::as_hex(constructor));\n"
+         "  }\n"
+         "}\n";
+}
+
 }  // namespace td
@@ -23,6 +23,8 @@ class TD_TL_writer_cpp : public TD_TL_writer {
 
   std::string gen_store_class_name(const tl::tl_tree_type *tree_type) const;
 
+  std::string gen_field_skip(const tl::arg &a, std::vector<tl::var_description> &vars) const;
+
   std::string gen_full_store_class_name(const tl::tl_tree_type *tree_type) const;
 
   std::vector<std::string> ext_include;
@@ -100,6 +102,19 @@ class TD_TL_writer_cpp : public TD_TL_writer {
   std::string gen_constructor_field_init(int field_num, const std::string &class_name, const tl::arg &a,
                                          bool is_default) const override;
   std::string gen_constructor_end(const tl::tl_combinator *t, int fields_num, bool is_default) const override;
+
+  std::string gen_additional_function(const std::string &function_name, const tl::tl_combinator *t,
+                                      bool is_function) const override;
+  std::string gen_additional_proxy_function_begin(const std::string &function_name, const tl::tl_type *type,
+                                                  const std::string &class_name, int arity,
+                                                  bool is_function) const override;
+  std::string gen_additional_proxy_function_case(const std::string &function_name, const tl::tl_type *type,
+                                                 const std::string &class_name, int arity) const override;
+  std::string gen_additional_proxy_function_case(const std::string &function_name, const tl::tl_type *type,
+                                                 const tl::tl_combinator *t, int arity,
+                                                 bool is_function) const override;
+  std::string gen_additional_proxy_function_end(const std::string &function_name, const tl::tl_type *type,
+                                                bool is_function) const override;
 };
 
 }  // namespace td
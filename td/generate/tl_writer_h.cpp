@@ -46,9 +46,13 @@ std::string TD_TL_writer_h::gen_output_begin() const {
   if (!ext_forward_declaration.empty()) {
     ext_forward_declaration += "\n";
   }
+  if (use_arena_allocation()) {
+    ext_include_str = "#include \"td/utils/ArenaAllocator.h\"\n" + ext_include_str;
+  }
   return "#pragma once\n\n"
          "#include \"td/tl/TlObject.h\"\n\n" +
          ext_include_str +
+         "#include <cstddef>\n"
          "#include <cstdint>\n"
          "#include <memory>\n"
          "#include <utility>\n"
@@ -207,9 +211,26 @@ std::string TD_TL_writer_h::gen_forward_class_declaration(const std::string &cla
 
 std::string TD_TL_writer_h::gen_class_begin(const std::string &class_name, const std::string &base_class_name,
                                             bool is_proxy) const {
+  std::string allocation_functions;
+  if (use_arena_allocation() && is_proxy && base_class_name == gen_base_tl_class_name()) {
+    allocation_functions =
+        "  static void *operator new(std::size_t size) {\n"
+        "    return ArenaAllocator::allocate_heap(size);\n"
+        "  }\n"
+        "  static void *operator new(std::size_t size, ArenaAllocator &arena) {\n"
+        "    return arena.allocate(size);\n"
+        "  }\n"
+        "  static void operator delete(void *ptr) {\n"
+        "    ArenaAllocator::deallocate(ptr);\n"
+        "  }\n"
+        "  static void operator delete(void *ptr, ArenaAllocator &arena) {\n"
+        "    ArenaAllocator::deallocate(ptr);\n"
+        "  }\n";
+  }
   return "class " + class_name + (!is_proxy ? " final " : "") + ": public " + base_class_name +
          " {\n"
-         " public:\n";
+         " public:\n" +
+         allocation_functions;
 }
 
 std::string TD_TL_writer_h::gen_class_end() const {
@@ -259,6 +280,13 @@ std::string TD_TL_writer_h::gen_fetch_function_begin(const std::string &parser_n
   std::string fetched_type = "object_ptr<" + class_name + "> ";
 
   if (parser_type == 0) {
+    if (use_arena_allocation() && parser_name == "TlBufferParser") {
+      // the parser is incomplete here, so fetch is defined in the .cpp file
+      return "\n"
+             "  static " +
+             fetched_type + "fetch(" + parser_name + " &p);\n\n" + "  explicit " + class_name + "(" + parser_name +
+             " &p);\n";
+    }
     return "\n"
            "  static " +
            fetched_type + "fetch(" + parser_name +
@@ -347,4 +375,46 @@ std::string TD_TL_writer_h::gen_constructor_end(const tl::tl_combinator *t, int
   return ");\n";
 }
 
+
+std::string TD_TL_writer_h::gen_additional_function(const std::string &function_name, const tl::tl_combinator *t,
+                                                    bool is_function) const {
+  assert(function_name == "skip");
+  if (is_function) {
+    return "";
+  }
+  return "\n"
+         "  static void skip(TlBufferParser &p);\n";
+}
+
+std::string TD_TL_writer_h::gen_additional_proxy_function_begin(const std::string &function_name,
+                                                                const tl::tl_type *type, const std::string &class_name,
+                                                                int arity, bool is_function) const {
+  assert(function_name == "skip");
+  if (is_function) {
+    return "";
+  }
+  return "\n"
+         "  static void skip(TlBufferParser &p);\n";
+}
+
+std::string TD_TL_writer_h::gen_additional_proxy_function_case(const std::string &function_name,
+                                                               const tl::tl_type *type, const std::string &class_name,
+                                                               int arity) const {
+  assert(function_name == "skip");
+  return "";
+}
+
+std::string TD_TL_writer_h::gen_additional_proxy_function_case(const std::string &function_name,
+                                                               const tl::tl_type *type, const tl::tl_combinator *t,
+                                                               int arity, bool is_function) const {
+  assert(function_name == "skip");
+  return "";
+}
+
+std::string TD_TL_writer_h::gen_additional_proxy_function_end(const std::string &function_name,
+                                                              const tl::tl_type *type, bool is_function) const {
+  assert(function_name == "skip");
+  return "";
+}
+
 }  // namespace td
@@ -20,6 +20,14 @@ int TD_TL_writer::get_max_arity() const {
   return MAX_ARITY;
 }
 
+bool TD_TL_writer::use_arena_allocation() const {
+#ifdef TD_ENABLE_TL_ARENA  // objects parsed from server responses are placed in the parser arena
+  return tl_name == "telegram_api";
+#else
+  return false;
+#endif
+}
+
 bool TD_TL_writer::is_built_in_simple_type(const std::string &name) const {
   return name == "True" || name == "Bool" || name == "Int" || name == "Long" || name == "Double" || name == "String" ||
          name == "Int32" || name == "Int53" || name == "Int64" || name == "Int128" || name == "Int256" ||
@@ -99,6 +107,19 @@ std::vector<std::string> TD_TL_writer::get_storers() const {
   return storers;
 }
 
+std::vector<std::string> TD_TL_writer::get_additional_functions() const {
+  std::vector<std::string> additional_functions;
+  if (tl_name == "telegram_api") {
+    additional_functions.push_back("skip");
+  }
+  return additional_functions;
+}
+
+int TD_TL_writer::get_additional_function_type(const std::string &additional_function_name) const {
+  assert(additional_function_name == "skip");
+  return 2;
+}
+
 std::string TD_TL_writer::gen_base_tl_class_name() const {
   return base_tl_class_name;
 }
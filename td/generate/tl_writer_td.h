@@ -31,6 +31,8 @@ class TD_TL_writer : public tl::TL_writer {
 
   int get_max_arity() const override;
 
+  bool use_arena_allocation() const;
+
   bool is_built_in_simple_type(const std::string &name) const override;
   bool is_built_in_complex_type(const std::string &name) const override;
   bool is_type_bare(const tl::tl_type *t) const override;
@@ -41,6 +43,8 @@ class TD_TL_writer : public tl::TL_writer {
   Mode get_storer_mode(int type) const override;
   std::vector<std::string> get_parsers() const override;
   std::vector<std::string> get_storers() const override;
+  std::vector<std::string> get_additional_functions() const override;
+  int get_additional_function_type(const std::string &additional_function_name) const override;
 
   std::string gen_base_tl_class_name() const override;
   std::string gen_base_type_class_name(int arity) const override;
@@ -13,12 +13,16 @@
 #include "td/utils/logging.h"
 #include "td/utils/Slice.h"
 #include "td/utils/Status.h"
+#include "td/utils/Time.h"
 
+#include <limits>
 #include <utility>
 
 namespace td {
 namespace mtproto {
 
+constexpr double RawConnection::TCP_INFO_SAMPLE_PERIOD;
+
 void RawConnection::send_crypto(const Storer &storer, int64 session_id, int64 salt, const AuthKey &auth_key,
                                 uint64 quick_ack_token) {
   mtproto::PacketInfo info;
@@ -55,6 +59,30 @@ uint64 RawConnection::send_no_crypto(const Storer &storer) {
   return info.message_id;
 }
 
+void RawConnection::sample_tcp_info() {
+  auto now = Time::now_cached();
+  if (now < next_tcp_info_sample_at_) {
+    return;
+  }
+  next_tcp_info_sample_at_ = now + TCP_INFO_SAMPLE_PERIOD;
+
+  auto r_tcp_info = socket_fd_.get_tcp_info();
+  if (r_tcp_info.is_error()) {
+    LOG(DEBUG) << "Stop sampling TCP_INFO: " << r_tcp_info.error();
+    next_tcp_info_sample_at_ = std::numeric_limits<double>::infinity();
+    return;
+  }
+  tcp_info_ = r_tcp_info.move_as_ok();
+  if (tcp_info_.rtt > 0) {
+    // the kernel's retransmission timeout estimate is used as the RTT of the connection,
+    // so ping and disconnect delays follow the actual link quality
+    rtt_ = tcp_info_.rtt + 4 * tcp_info_.rtt_var;
+  }
+  LOG(DEBUG) << "Sample TCP_INFO of " << debug_str_ << ": " << tag("rtt", tcp_info_.rtt)
+             << tag("rtt_var", tcp_info_.rtt_var) << tag("retransmits", tcp_info_.total_retransmits)
+             << tag("send_rate", tcp_info_.send_rate);
+}
+
 Status RawConnection::flush_read(const AuthKey &auth_key, Callback &callback) {
   auto r = socket_fd_.flush_read();
   if (r.is_ok() && stats_callback_) {
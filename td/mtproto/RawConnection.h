@@ -92,10 +92,17 @@ class RawConnection {
         stats_callback_->on_error();
       }
       has_error_ = true;
+    } else {
+      sample_tcp_info();
     }
     return status;
   }
 
+  // the last sampled TCP_INFO of the connection, if it is supported
+  const TcpInfo &get_tcp_info() const {
+    return tcp_info_;
+  }
+
   bool has_error() const {
     return has_error_;
   }
@@ -119,6 +126,12 @@ class RawConnection {
 
   StateManager::ConnectionToken connection_token_;
 
+  static constexpr double TCP_INFO_SAMPLE_PERIOD = 1.0;
+  TcpInfo tcp_info_;
+  double next_tcp_info_sample_at_{0};
+
+  void sample_tcp_info();
+
   Status flush_read(const AuthKey &auth_key, Callback &callback);
   Status flush_write();
 
@@ -135,8 +135,8 @@ void RSA::decrypt(Slice from, MutableSlice to) const {
 }
 
 /*** DH ***/
-Status DhHandshake::dh_check(Slice prime_str, const BigNum &prime, int32 g_int, const BigNum &g_a, const BigNum &g_b,
-                             BigNumContext &ctx, DhCallback *callback) {
+Status DhHandshake::check_config(Slice prime_str, const BigNum &prime, int32 g_int, BigNumContext &ctx,
+                                 DhCallback *callback) {
   // 2. g generates a cyclic subgroup of prime order (p - 1) / 2, i.e. is a quadratic residue mod p.
   //    Since g is always equal to 2, 3, 4, 5, 6 or 7, this is easily done using quadratic reciprocity law,
   //    yielding a simple condition on
@@ -174,39 +174,11 @@ Status DhHandshake::dh_check(Slice prime_str, const BigNum &prime, int32 g_int,
     return Status::Error("Bad prime mod 4g");
   }
 
-  // IMPORTANT: Apart from the conditions on the Diffie-Hellman prime dh_prime and generator g, both sides are
-  // to check that g, g_a and g_b are greater than 1 and less than dh_prime - 1.
-  // We recommend checking that g_a and g_b are between 2^{2048-64} and dh_prime - 2^{2048-64} as well.
-
   // check that 2^2047 <= p < 2^2048
   if (prime.get_num_bits() != 2048) {
     return Status::Error("p is not 2048-bit number");
   }
 
-  BigNum left;
-  left.set_value(0);
-  left.set_bit(2048 - 64);
-
-  BigNum right;
-  BigNum::sub(right, prime, left);
-
-  if (BigNum::compare(left, g_a) > 0 || BigNum::compare(g_a, right) > 0 || BigNum::compare(left, g_b) > 0 ||
-      BigNum::compare(g_b, right) > 0) {
-    std::string x(2048, '0');
-    std::string y(2048, '0');
-    for (int i = 0; i < 2048; i++) {
-      if (g_a.is_bit_set(i)) {
-        x[i] = '1';
-      }
-      if (g_b.is_bit_set(i)) {
-        y[i] = '1';
-      }
-    }
-    LOG(ERROR) << x;
-    LOG(ERROR) << y;
-    return Status::Error("g^a or g^b is not between 2^{2048-64} and dh_prime - 2^{2048-64}");
-  }
-
   // check whether p = dh_prime is a safe 2048-bit prime (meaning that both p and (p - 1) / 2 are prime)
   int is_good_prime = -1;
   if (callback) {
@@ -253,6 +225,203 @@ Status DhHandshake::dh_check(Slice prime_str, const BigNum &prime, int32 g_int,
   return Status::OK();
 }
 
+Status DhHandshake::dh_check(Slice prime_str, const BigNum &prime, int32 g_int, const BigNum &g_a, const BigNum &g_b,
+                             BigNumContext &ctx, DhCallback *callback) {
+  TRY_STATUS(check_config(prime_str, prime, g_int, ctx, callback));
+
+  // IMPORTANT: Apart from the conditions on the Diffie-Hellman prime dh_prime and generator g, both sides are
+  // to check that g, g_a and g_b are greater than 1 and less than dh_prime - 1.
+  // We recommend checking that g_a and g_b are between 2^{2048-64} and dh_prime - 2^{2048-64} as well.
+
+  BigNum left;
+  left.set_value(0);
+  left.set_bit(2048 - 64);
+
+  BigNum right;
+  BigNum::sub(right, prime, left);
+
+  if (BigNum::compare(left, g_a) > 0 || BigNum::compare(g_a, right) > 0 || BigNum::compare(left, g_b) > 0 ||
+      BigNum::compare(g_b, right) > 0) {
+    std::string x(2048, '0');
+    std::string y(2048, '0');
+    for (int i = 0; i < 2048; i++) {
+      if (g_a.is_bit_set(i)) {
+        x[i] = '1';
+      }
+      if (g_b.is_bit_set(i)) {
+        y[i] = '1';
+      }
+    }
+    LOG(ERROR) << x;
+    LOG(ERROR) << y;
+    return Status::Error("g^a or g^b is not between 2^{2048-64} and dh_prime - 2^{2048-64}");
+  }
+
+  return Status::OK();
+}
+
+DhKeyPool::Prime::Prime(int32 g_int, Slice prime_str, BigNumContext &context)
+    : g_int(g_int)
+    , prime_str(prime_str.str())
+    , prime(BigNum::from_binary(prime_str))
+    , montgomery_context(prime, context) {
+  g.set_value(g_int);
+}
+
+DhKeyPool &DhKeyPool::instance() {
+  static DhKeyPool pool;
+  return pool;
+}
+
+std::shared_ptr<const DhKeyPool::Prime> DhKeyPool::get_prime(int32 g_int, Slice prime_str) {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto prime = find_prime(g_int, prime_str);
+    if (prime != nullptr) {
+      return prime;
+    }
+  }
+
+  // creation of the Montgomery context is expensive, so it is done without the lock
+  BigNumContext context;
+  auto new_prime = std::make_shared<const Prime>(g_int, prime_str, context);
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto prime = find_prime(g_int, prime_str);
+  if (prime != nullptr) {
+    return prime;
+  }
+  if (entries_.size() >= MAX_PRIME_COUNT) {
+    auto lru_entry = entries_.begin();
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->last_use < lru_entry->last_use) {
+        lru_entry = it;
+      }
+    }
+    entries_.erase(lru_entry);
+  }
+  Entry entry;
+  entry.prime = new_prime;
+  entry.last_use = ++use_count_;
+  entries_.push_back(std::move(entry));
+  need_refill_.store(true, std::memory_order_release);
+  return new_prime;
+}
+
+void DhKeyPool::prepare(int32 g_int, Slice prime_str) {
+  get_prime(g_int, prime_str);
+}
+
+std::shared_ptr<const DhKeyPool::Prime> DhKeyPool::find_prime(int32 g_int, Slice prime_str) {
+  for (auto &entry : entries_) {
+    if (entry.prime->g_int == g_int && entry.prime->prime_str == prime_str) {
+      entry.last_use = ++use_count_;
+      return entry.prime;
+    }
+  }
+  return nullptr;
+}
+
+DhKeyPool::Entry *DhKeyPool::get_entry(const Prime &prime) {
+  for (auto &entry : entries_) {
+    if (entry.prime.get() == &prime) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+bool DhKeyPool::pop_key_pair(const Prime &prime, BigNum &b, BigNum &g_b) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto entry = get_entry(prime);
+  if (entry == nullptr) {
+    return false;
+  }
+  entry->last_use = ++use_count_;
+  bool result = false;
+  if (!entry->key_pairs.empty()) {
+    b = std::move(entry->key_pairs.back().b);
+    g_b = std::move(entry->key_pairs.back().g_b);
+    entry->key_pairs.pop_back();
+    result = true;
+  }
+  if (entry->key_pairs.size() <= max_key_pair_count_ / 2) {
+    need_refill_.store(true, std::memory_order_release);
+  }
+  return result;
+}
+
+void DhKeyPool::gen_key_pair(const Prime &prime, BigNum &b, BigNum &g_b, BigNumContext &context) {
+  BigNum::random(b, 2048, -1, 0);
+  BigNum::mod_exp(g_b, prime.g, b, prime.prime, context, prime.montgomery_context);
+}
+
+bool DhKeyPool::precompute_key_pair(DhCallback *callback, BigNumContext &context) {
+  std::shared_ptr<const Prime> prime;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (auto &entry : entries_) {
+      if (entry.key_pairs.size() < max_key_pair_count_) {
+        prime = entry.prime;
+        break;
+      }
+    }
+    if (prime == nullptr) {
+      return false;
+    }
+  }
+
+  // the check is expensive only for the first time, because its result is cached by the callback
+  auto status = DhHandshake::check_config(prime->prime_str, prime->prime, prime->g_int, context, callback);
+  if (status.is_error()) {
+    LOG(WARNING) << "Don't pre-compute DH key pairs for a bad prime: " << status;
+    remove_prime(*prime);
+    return true;
+  }
+
+  KeyPair key_pair;
+  gen_key_pair(*prime, key_pair.b, key_pair.g_b, context);
+  add_key_pair(*prime, std::move(key_pair));
+  return true;
+}
+
+void DhKeyPool::set_max_key_pair_count(size_t max_key_pair_count) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  max_key_pair_count_ = max_key_pair_count;
+  for (auto &entry : entries_) {
+    if (entry.key_pairs.size() > max_key_pair_count_) {
+      entry.key_pairs.resize(max_key_pair_count_);
+    }
+  }
+}
+
+bool DhKeyPool::take_refill_request() {
+  if (!need_refill_.load(std::memory_order_relaxed)) {
+    return false;
+  }
+  return need_refill_.exchange(false, std::memory_order_acquire);
+}
+
+void DhKeyPool::remove_prime(const Prime &prime) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+    if (it->prime.get() == &prime) {
+      entries_.erase(it);
+      return;
+    }
+  }
+}
+
+bool DhKeyPool::add_key_pair(const Prime &prime, KeyPair key_pair) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto entry = get_entry(prime);
+  if (entry == nullptr || entry->key_pairs.size() >= max_key_pair_count_) {
+    return false;
+  }
+  entry->key_pairs.push_back(std::move(key_pair));
+  return true;
+}
+
 int64 dh_auth_key_id(const string &auth_key) {
   UInt<160> auth_key_sha1;
   sha1(auth_key, auth_key_sha1.raw);
@@ -261,19 +430,20 @@ int64 dh_auth_key_id(const string &auth_key) {
 
 void DhHandshake::set_config(int32 g_int, Slice prime_str) {
   has_config_ = true;
-  prime_ = BigNum::from_binary(prime_str);
+  dh_prime_ = DhKeyPool::instance().get_prime(g_int, prime_str);
+  prime_ = dh_prime_->prime.clone();
   prime_str_ = prime_str.str();
 
   b_ = BigNum();
   g_b_ = BigNum();
 
-  BigNum::random(b_, 2048, -1, 0);
-
-  // g^b
   g_int_ = g_int;
   g_.set_value(g_int_);
 
-  BigNum::mod_exp(g_b_, g_, b_, prime_, ctx_);
+  // b and g^b
+  if (!DhKeyPool::instance().pop_key_pair(*dh_prime_, b_, g_b_)) {
+    DhKeyPool::gen_key_pair(*dh_prime_, b_, g_b_, ctx_);
+  }
 }
 
 void DhHandshake::set_g_a_hash(Slice g_a_hash) {
@@ -320,8 +490,9 @@ Status DhHandshake::run_checks(DhCallback *callback) {
 
 std::pair<int64, string> DhHandshake::gen_key() {
   CHECK(has_g_a_ && has_config_);
+  CHECK(dh_prime_ != nullptr);
   BigNum g_ab;
-  BigNum::mod_exp(g_ab, g_a_, b_, prime_, ctx_);
+  BigNum::mod_exp(g_ab, g_a_, b_, prime_, ctx_, dh_prime_->montgomery_context);
   string key = g_ab.to_binary(2048 / 8);
   auto key_id = calc_key_id(key);
   return std::pair<int64, string>(key_id, std::move(key));
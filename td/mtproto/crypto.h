@@ -11,6 +11,9 @@
 #include "td/utils/Slice.h"
 #include "td/utils/Status.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <utility>
 
 namespace td {
@@ -55,6 +58,72 @@ class DhCallback {
   virtual void add_good_prime(Slice prime_str) const = 0;
   virtual void add_bad_prime(Slice prime_str) const = 0;
 };
+
+// Process-wide cache of data, which depends only on DH parameters: Montgomery context of the prime
+// and a bounded number of pre-computed (b, g^b) pairs, which are generated by background workers;
+// the least recently used prime is evicted, when there are too many of them
+class DhKeyPool {
+ public:
+  struct Prime {
+    int32 g_int;
+    string prime_str;
+    BigNum prime;
+    BigNum g;
+    BigNumMontgomeryContext montgomery_context;
+
+    Prime(int32 g_int, Slice prime_str, BigNumContext &context);
+  };
+
+  static DhKeyPool &instance();
+
+  // returns shared data for the parameters and remembers them to pre-compute key pairs in background
+  std::shared_ptr<const Prime> get_prime(int32 g_int, Slice prime_str);
+
+  // the same as get_prime, but can be called as soon as the parameters are known, so that the prime is checked
+  // in background before the first handshake
+  void prepare(int32 g_int, Slice prime_str);
+
+  // returns false if there are no pre-computed key pairs for the prime
+  bool pop_key_pair(const Prime &prime, BigNum &b, BigNum &g_b);
+
+  static void gen_key_pair(const Prime &prime, BigNum &b, BigNum &g_b, BigNumContext &context);
+
+  // checks one remembered prime or generates one key pair for it;
+  // returns false if there is nothing to do, i.e. all good primes have enough key pairs
+  bool precompute_key_pair(DhCallback *callback, BigNumContext &context);
+
+  void set_max_key_pair_count(size_t max_key_pair_count);
+
+  // returns true once after a new prime was added or pre-computed key pairs are running out;
+  // background workers poll it from their own threads and then call precompute_key_pair until it returns false
+  bool take_refill_request();
+
+ private:
+  static constexpr size_t MAX_PRIME_COUNT = 4;
+  static constexpr size_t DEFAULT_MAX_KEY_PAIR_COUNT = 16;
+
+  struct KeyPair {
+    BigNum b;
+    BigNum g_b;
+  };
+  struct Entry {
+    std::shared_ptr<const Prime> prime;
+    std::vector<KeyPair> key_pairs;
+    uint64 last_use = 0;
+  };
+
+  std::mutex mutex_;
+  std::vector<Entry> entries_;
+  uint64 use_count_ = 0;
+  size_t max_key_pair_count_ = DEFAULT_MAX_KEY_PAIR_COUNT;
+  std::atomic<bool> need_refill_{false};
+
+  std::shared_ptr<const Prime> find_prime(int32 g_int, Slice prime_str);
+  Entry *get_entry(const Prime &prime);
+  void remove_prime(const Prime &prime);
+  bool add_key_pair(const Prime &prime, KeyPair key_pair);
+};
+
 class DhHandshake {
  public:
   void set_config(int32 g_int, Slice prime_str);
@@ -72,6 +141,10 @@ class DhHandshake {
   string get_g_b_hash() const;
   Status run_checks(DhCallback *callback) TD_WARN_UNUSED_RESULT;
 
+  // checks only the parameters, which don't depend on g_a and g_b
+  static Status check_config(Slice prime_str, const BigNum &prime, int32 g_int, BigNumContext &ctx,
+                             DhCallback *callback) TD_WARN_UNUSED_RESULT;
+
   std::pair<int64, string> gen_key();
 
   static int64 calc_key_id(const string &auth_key);
@@ -118,6 +191,7 @@ class DhHandshake {
 
       g_int_ = parser.fetch_int();
       g_.set_value(g_int_);
+      dh_prime_ = DhKeyPool::instance().get_prime(g_int_, prime_str_);
 
       g_b_ = BigNum::from_binary(parser.template fetch_string<string>());
     }
@@ -137,6 +211,7 @@ class DhHandshake {
   BigNum b_;
   BigNum g_b_;
   BigNum g_a_;
+  std::shared_ptr<const DhKeyPool::Prime> dh_prime_;
 
   string g_a_hash_;
   bool has_g_a_hash_{false};
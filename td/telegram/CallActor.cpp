@@ -432,6 +432,7 @@ void CallActor::do_load_dh_config(Promise<std::shared_ptr<DhConfig>> promise) {
                           dh_config->version = dh->version_;
                           dh_config->prime = dh->p_.as_slice().str();
                           dh_config->g = dh->g_;
+                          DhKeyPool::instance().prepare(dh_config->g, dh_config->prime);
                           G()->set_dh_config(dh_config);
                           return std::move(dh_config);
                         }
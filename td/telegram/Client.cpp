@@ -10,12 +10,17 @@
 
 #include "td/utils/crypto.h"
 #include "td/utils/logging.h"
+#include "td/utils/misc.h"
 #include "td/utils/MpscPollableQueue.h"
 #include "td/utils/Observer.h"
 #include "td/utils/port/Fd.h"
 #include "td/utils/port/Poll.h"
 #include "td/utils/port/thread.h"
+#include "td/utils/port/thread_options.h"
+#include "td/utils/Slice.h"
 
+#include <atomic>
+#include <cstdlib>
 #include <deque>
 
 namespace td {
@@ -190,6 +195,50 @@ class TdProxy : public Actor {
   }
 };
 
+// Scheduler 0 runs Td and network connections, scheduler 1 runs databases, scheduler 2 runs files GC and
+// scheduler 3 runs slow network queries.
+// Options of scheduler <i> thread can be changed through environment variables:
+//   TD_SCHEDULER_<i>_CPUS - list of allowed CPUs like "0-3,8" or "numa:<node>"
+//   TD_SCHEDULER_<i>_NICE - nice value of the thread
+//   TD_SCHEDULER_<i>_REALTIME_PRIORITY - SCHED_FIFO priority of the thread
+// If TD_NUMA_NODES is set to a list of nodes like "0,1", clients are distributed among the nodes round-robin and
+// schedulers without explicitly specified CPUs are bound to CPUs of the client's node.
+static ThreadOptions get_scheduler_thread_options(int32 sched_id, int32 client_num) {
+  auto get_env = [sched_id](Slice name) -> Slice {
+    string env_name = PSTRING() << "TD_SCHEDULER_" << sched_id << '_' << name;
+    auto value = std::getenv(env_name.c_str());
+    return value == nullptr ? Slice() : Slice(value);
+  };
+
+  ThreadOptions options;
+  auto cpus = get_env("CPUS");
+  if (!cpus.empty()) {
+    auto r_cpus = parse_cpu_list(cpus);
+    if (r_cpus.is_error()) {
+      LOG(ERROR) << "Failed to parse CPU list of scheduler " << sched_id << ": " << r_cpus.error();
+    } else {
+      options.cpus = r_cpus.move_as_ok();
+    }
+  } else {
+    auto numa_nodes_env = std::getenv("TD_NUMA_NODES");
+    if (numa_nodes_env != nullptr) {
+      auto numa_nodes = full_split(Slice(numa_nodes_env), ',');
+      if (!numa_nodes.empty()) {
+        auto numa_node = to_integer<int32>(numa_nodes[client_num % numa_nodes.size()]);
+        auto r_cpus = get_numa_node_cpus(numa_node);
+        if (r_cpus.is_error()) {
+          LOG(ERROR) << "Failed to get CPUs of NUMA node " << numa_node << ": " << r_cpus.error();
+        } else {
+          options.cpus = r_cpus.move_as_ok();
+        }
+      }
+    }
+  }
+  options.nice = to_integer<int32>(get_env("NICE"));
+  options.realtime_priority = to_integer<int32>(get_env("REALTIME_PRIORITY"));
+  return options;
+}
+
 /*** Client::Impl ***/
 class Client::Impl final : ObserverBase {
  public:
@@ -235,13 +284,20 @@ class Client::Impl final : ObserverBase {
   thread scheduler_thread_;
   bool notify_flag_{false};
 
+  static constexpr int32 SCHEDULER_THREAD_COUNT = 3;
+
   void init() {
     input_queue_ = std::make_shared<InputQueue>();
     input_queue_->init();
     output_queue_ = std::make_shared<OutputQueue>();
     output_queue_->init();
     scheduler_ = std::make_shared<ConcurrentScheduler>();
-    scheduler_->init(3);
+    scheduler_->init(SCHEDULER_THREAD_COUNT);
+    static std::atomic<int32> client_count{0};
+    auto client_num = client_count.fetch_add(1, std::memory_order_relaxed);
+    for (int32 i = 0; i <= SCHEDULER_THREAD_COUNT; i++) {
+      scheduler_->set_thread_options(i, get_scheduler_thread_options(i, client_num));
+    }
     scheduler_->create_actor_unsafe<TdProxy>(0, "TdProxy", input_queue_, output_queue_).release();
     scheduler_->start();
 
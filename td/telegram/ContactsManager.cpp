@@ -4879,11 +4879,29 @@ void ContactsManager::load_user_from_database_impl(UserId user_id, Promise<Unit>
   auto &load_user_queries = load_user_from_database_queries_[user_id];
   load_user_queries.push_back(std::move(promise));
   if (load_user_queries.size() == 1u) {
-    G()->td_db()->get_sqlite_pmc()->get(get_user_database_key(user_id), PromiseCreator::lambda([user_id](string value) {
-                                          send_closure(G()->contacts_manager(),
-                                                       &ContactsManager::on_load_user_from_database, user_id,
-                                                       std::move(value));
-                                        }));
+    pending_load_user_from_database_ids_.push_back(user_id);
+    if (pending_load_user_from_database_ids_.size() == 1u) {
+      send_closure_later(actor_id(this), &ContactsManager::load_pending_users_from_database);
+    }
+  }
+}
+
+void ContactsManager::load_pending_users_from_database() {
+  auto user_ids = std::move(pending_load_user_from_database_ids_);
+  pending_load_user_from_database_ids_.clear();
+  LOG(INFO) << "Load " << user_ids.size() << " users from database";
+  auto keys = transform(user_ids, [](const UserId &user_id) { return get_user_database_key(user_id); });
+  G()->td_db()->get_sqlite_pmc()->get_multi(
+      std::move(keys), PromiseCreator::lambda([user_ids = std::move(user_ids)](vector<string> values) mutable {
+        send_closure(G()->contacts_manager(), &ContactsManager::on_load_users_from_database, std::move(user_ids),
+                     std::move(values));
+      }));
+}
+
+void ContactsManager::on_load_users_from_database(vector<UserId> user_ids, vector<string> values) {
+  CHECK(user_ids.size() == values.size());
+  for (size_t i = 0; i < user_ids.size(); i++) {
+    on_load_user_from_database(user_ids[i], std::move(values[i]));
   }
 }
 
@@ -5095,11 +5113,29 @@ void ContactsManager::load_chat_from_database_impl(ChatId chat_id, Promise<Unit>
   auto &load_chat_queries = load_chat_from_database_queries_[chat_id];
   load_chat_queries.push_back(std::move(promise));
   if (load_chat_queries.size() == 1u) {
-    G()->td_db()->get_sqlite_pmc()->get(get_chat_database_key(chat_id), PromiseCreator::lambda([chat_id](string value) {
-                                          send_closure(G()->contacts_manager(),
-                                                       &ContactsManager::on_load_chat_from_database, chat_id,
-                                                       std::move(value));
-                                        }));
+    pending_load_chat_from_database_ids_.push_back(chat_id);
+    if (pending_load_chat_from_database_ids_.size() == 1u) {
+      send_closure_later(actor_id(this), &ContactsManager::load_pending_chats_from_database);
+    }
+  }
+}
+
+void ContactsManager::load_pending_chats_from_database() {
+  auto chat_ids = std::move(pending_load_chat_from_database_ids_);
+  pending_load_chat_from_database_ids_.clear();
+  LOG(INFO) << "Load " << chat_ids.size() << " chats from database";
+  auto keys = transform(chat_ids, [](const ChatId &chat_id) { return get_chat_database_key(chat_id); });
+  G()->td_db()->get_sqlite_pmc()->get_multi(
+      std::move(keys), PromiseCreator::lambda([chat_ids = std::move(chat_ids)](vector<string> values) mutable {
+        send_closure(G()->contacts_manager(), &ContactsManager::on_load_chats_from_database, std::move(chat_ids),
+                     std::move(values));
+      }));
+}
+
+void ContactsManager::on_load_chats_from_database(vector<ChatId> chat_ids, vector<string> values) {
+  CHECK(chat_ids.size() == values.size());
+  for (size_t i = 0; i < chat_ids.size(); i++) {
+    on_load_chat_from_database(chat_ids[i], std::move(values[i]));
   }
 }
 
@@ -5319,11 +5355,29 @@ void ContactsManager::load_channel_from_database_impl(ChannelId channel_id, Prom
   auto &load_channel_queries = load_channel_from_database_queries_[channel_id];
   load_channel_queries.push_back(std::move(promise));
   if (load_channel_queries.size() == 1u) {
-    G()->td_db()->get_sqlite_pmc()->get(
-        get_channel_database_key(channel_id), PromiseCreator::lambda([channel_id](string value) {
-          send_closure(G()->contacts_manager(), &ContactsManager::on_load_channel_from_database, channel_id,
-                       std::move(value));
-        }));
+    pending_load_channel_from_database_ids_.push_back(channel_id);
+    if (pending_load_channel_from_database_ids_.size() == 1u) {
+      send_closure_later(actor_id(this), &ContactsManager::load_pending_channels_from_database);
+    }
+  }
+}
+
+void ContactsManager::load_pending_channels_from_database() {
+  auto channel_ids = std::move(pending_load_channel_from_database_ids_);
+  pending_load_channel_from_database_ids_.clear();
+  LOG(INFO) << "Load " << channel_ids.size() << " channels from database";
+  auto keys = transform(channel_ids, [](const ChannelId &channel_id) { return get_channel_database_key(channel_id); });
+  G()->td_db()->get_sqlite_pmc()->get_multi(
+      std::move(keys), PromiseCreator::lambda([channel_ids = std::move(channel_ids)](vector<string> values) mutable {
+        send_closure(G()->contacts_manager(), &ContactsManager::on_load_channels_from_database, std::move(channel_ids),
+                     std::move(values));
+      }));
+}
+
+void ContactsManager::on_load_channels_from_database(vector<ChannelId> channel_ids, vector<string> values) {
+  CHECK(channel_ids.size() == values.size());
+  for (size_t i = 0; i < channel_ids.size(); i++) {
+    on_load_channel_from_database(channel_ids[i], std::move(values[i]));
   }
 }
 
@@ -5539,11 +5593,32 @@ void ContactsManager::load_secret_chat_from_database_impl(SecretChatId secret_ch
   auto &load_secret_chat_queries = load_secret_chat_from_database_queries_[secret_chat_id];
   load_secret_chat_queries.push_back(std::move(promise));
   if (load_secret_chat_queries.size() == 1u) {
-    G()->td_db()->get_sqlite_pmc()->get(
-        get_secret_chat_database_key(secret_chat_id), PromiseCreator::lambda([secret_chat_id](string value) {
-          send_closure(G()->contacts_manager(), &ContactsManager::on_load_secret_chat_from_database, secret_chat_id,
-                       std::move(value));
-        }));
+    pending_load_secret_chat_from_database_ids_.push_back(secret_chat_id);
+    if (pending_load_secret_chat_from_database_ids_.size() == 1u) {
+      send_closure_later(actor_id(this), &ContactsManager::load_pending_secret_chats_from_database);
+    }
+  }
+}
+
+void ContactsManager::load_pending_secret_chats_from_database() {
+  auto secret_chat_ids = std::move(pending_load_secret_chat_from_database_ids_);
+  pending_load_secret_chat_from_database_ids_.clear();
+  LOG(INFO) << "Load " << secret_chat_ids.size() << " secret chats from database";
+  auto keys = transform(secret_chat_ids, [](const SecretChatId &secret_chat_id) {
+    return get_secret_chat_database_key(secret_chat_id);
+  });
+  G()->td_db()->get_sqlite_pmc()->get_multi(
+      std::move(keys),
+      PromiseCreator::lambda([secret_chat_ids = std::move(secret_chat_ids)](vector<string> values) mutable {
+        send_closure(G()->contacts_manager(), &ContactsManager::on_load_secret_chats_from_database,
+                     std::move(secret_chat_ids), std::move(values));
+      }));
+}
+
+void ContactsManager::on_load_secret_chats_from_database(vector<SecretChatId> secret_chat_ids, vector<string> values) {
+  CHECK(secret_chat_ids.size() == values.size());
+  for (size_t i = 0; i < secret_chat_ids.size(); i++) {
+    on_load_secret_chat_from_database(secret_chat_ids[i], std::move(values[i]));
   }
 }
 
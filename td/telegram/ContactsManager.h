@@ -849,6 +849,8 @@ class ContactsManager : public Actor {
   void on_save_user_to_database(UserId user_id, bool success);
   void load_user_from_database(User *u, UserId user_id, Promise<Unit> promise);
   void load_user_from_database_impl(UserId user_id, Promise<Unit> promise);
+  void load_pending_users_from_database();
+  void on_load_users_from_database(vector<UserId> user_ids, vector<string> values);
   void on_load_user_from_database(UserId user_id, string value);
 
   void save_chat(Chat *c, ChatId chat_id, bool from_binlog);
@@ -859,6 +861,8 @@ class ContactsManager : public Actor {
   void on_save_chat_to_database(ChatId chat_id, bool success);
   void load_chat_from_database(Chat *c, ChatId chat_id, Promise<Unit> promise);
   void load_chat_from_database_impl(ChatId chat_id, Promise<Unit> promise);
+  void load_pending_chats_from_database();
+  void on_load_chats_from_database(vector<ChatId> chat_ids, vector<string> values);
   void on_load_chat_from_database(ChatId chat_id, string value);
 
   void save_channel(Channel *c, ChannelId channel_id, bool from_binlog);
@@ -869,6 +873,8 @@ class ContactsManager : public Actor {
   void on_save_channel_to_database(ChannelId channel_id, bool success);
   void load_channel_from_database(Channel *c, ChannelId channel_id, Promise<Unit> promise);
   void load_channel_from_database_impl(ChannelId channel_id, Promise<Unit> promise);
+  void load_pending_channels_from_database();
+  void on_load_channels_from_database(vector<ChannelId> channel_ids, vector<string> values);
   void on_load_channel_from_database(ChannelId channel_id, string value);
 
   void save_secret_chat(SecretChat *c, SecretChatId secret_chat_id, bool from_binlog);
@@ -879,6 +885,8 @@ class ContactsManager : public Actor {
   void on_save_secret_chat_to_database(SecretChatId secret_chat_id, bool success);
   void load_secret_chat_from_database(SecretChat *c, SecretChatId secret_chat_id, Promise<Unit> promise);
   void load_secret_chat_from_database_impl(SecretChatId secret_chat_id, Promise<Unit> promise);
+  void load_pending_secret_chats_from_database();
+  void on_load_secret_chats_from_database(vector<SecretChatId> secret_chat_ids, vector<string> values);
   void on_load_secret_chat_from_database(SecretChatId secret_chat_id, string value);
 
   void update_user(User *u, UserId user_id, bool from_binlog = false, bool from_database = false);
@@ -1011,15 +1019,19 @@ class ContactsManager : public Actor {
   vector<ChannelId> created_public_channels_;
 
   std::unordered_map<UserId, vector<Promise<Unit>>, UserIdHash> load_user_from_database_queries_;
+  vector<UserId> pending_load_user_from_database_ids_;
   std::unordered_set<UserId, UserIdHash> loaded_from_database_users_;
 
   std::unordered_map<ChatId, vector<Promise<Unit>>, ChatIdHash> load_chat_from_database_queries_;
+  vector<ChatId> pending_load_chat_from_database_ids_;
   std::unordered_set<ChatId, ChatIdHash> loaded_from_database_chats_;
 
   std::unordered_map<ChannelId, vector<Promise<Unit>>, ChannelIdHash> load_channel_from_database_queries_;
+  vector<ChannelId> pending_load_channel_from_database_ids_;
   std::unordered_set<ChannelId, ChannelIdHash> loaded_from_database_channels_;
 
   std::unordered_map<SecretChatId, vector<Promise<Unit>>, SecretChatIdHash> load_secret_chat_from_database_queries_;
+  vector<SecretChatId> pending_load_secret_chat_from_database_ids_;
   std::unordered_set<SecretChatId, SecretChatIdHash> loaded_from_database_secret_chats_;
 
   std::unordered_map<UserId, vector<Promise<Unit>>, UserIdHash> get_user_full_queries_;
@@ -0,0 +1,49 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/DhWorker.h"
+
+#include "td/telegram/DhCache.h"
+
+#include "td/mtproto/crypto.h"
+
+#include "td/utils/logging.h"
+
+namespace td {
+
+DhWorker::DhWorker(ActorShared<> parent) : parent_(std::move(parent)) {
+}
+
+void DhWorker::start_up() {
+  need_refill_ = true;
+  loop();
+  set_timeout_in(REFILL_CHECK_PERIOD);
+}
+
+// the pool is shared by all Td instances, so it is polled instead of calling back into an actor of some of them
+void DhWorker::timeout_expired() {
+  if (DhKeyPool::instance().take_refill_request()) {
+    need_refill_ = true;
+    loop();
+  }
+  set_timeout_in(REFILL_CHECK_PERIOD);
+}
+
+void DhWorker::loop() {
+  while (need_refill_) {
+    if (!DhKeyPool::instance().precompute_key_pair(DhCache::instance(), context_)) {
+      need_refill_ = false;
+      break;
+    }
+    if (need_yield()) {
+      LOG(DEBUG) << "Yield DH key pair pre-computation";
+      yield();
+      break;
+    }
+  }
+}
+
+}  // namespace td
@@ -0,0 +1,34 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/actor/actor.h"
+
+#include "td/utils/BigNum.h"
+#include "td/utils/common.h"
+
+namespace td {
+
+// Checks DH primes and fills DhKeyPool with pre-computed key pairs in background,
+// so that DH handshakes don't run modular exponentiations on the caller's scheduler
+class DhWorker : public Actor {
+ public:
+  explicit DhWorker(ActorShared<> parent);
+
+ private:
+  static constexpr double REFILL_CHECK_PERIOD = 1.0;
+
+  ActorShared<> parent_;
+  bool need_refill_ = false;
+  BigNumContext context_;
+
+  void start_up() override;
+  void timeout_expired() override;
+  void loop() override;
+};
+
+}  // namespace td
@@ -16,6 +16,7 @@
 
 #include "td/utils/format.h"
 #include "td/utils/logging.h"
+#include "td/utils/misc.h"
 #include "td/utils/ScopeGuard.h"
 #include "td/utils/Slice.h"
 #include "td/utils/StackAllocator.h"
@@ -509,6 +510,9 @@ class MessagesDbImpl : public MessagesDbSyncInterface {
 
   static string prepare_query(Slice query) {
     auto is_word_character = [](uint32 a) {
+      if (a < 0x80) {
+        return is_alnum(static_cast<char>(a)) || a == '_';
+      }
       switch (get_unicode_simple_category(a)) {
         case UnicodeSimpleCategory::Letter:
         case UnicodeSimpleCategory::DecimalNumber:
@@ -56,6 +56,7 @@
 #include "td/telegram/WebPagesManager.h"
 
 #include "td/utils/format.h"
+#include "td/utils/Gzip.h"
 #include "td/utils/HttpUrl.h"
 #include "td/utils/MimeType.h"
 #include "td/utils/misc.h"
@@ -7539,6 +7540,8 @@ void MessagesManager::delete_dialog_messages_from_user(DialogId dialog_id, UserI
     G()->td_db()->get_messages_db_async()->delete_dialog_messages_from_user(dialog_id, user_id,
                                                                             Auto());  // TODO Promise
   }
+  // senders of cold messages are unknown without parsing them, so all of them are dropped
+  delete_dialog_cold_messages(dialog_id, MessageId::max());
 
   vector<MessageId> message_ids;
   find_messages_from_user(d->messages, user_id, message_ids);
@@ -10067,6 +10070,104 @@ void MessagesManager::unload_message(Dialog *d, MessageId message_id) {
   bool need_update_dialog_pos = false;
   auto m = do_delete_message(d, message_id, false, true, &need_update_dialog_pos, "unload_message");
   CHECK(!need_update_dialog_pos);
+  if (m != nullptr) {
+    add_cold_message(d->dialog_id, m.get());
+  }
+}
+
+void MessagesManager::add_cold_message(DialogId dialog_id, const Message *m) {
+  auto max_size = static_cast<size_t>(G()->shared_config().get_option_integer("cold_message_cache_size"));
+  if (max_size == 0 || m->ttl > 0) {
+    return;
+  }
+
+  FullMessageId full_message_id{dialog_id, m->message_id};
+  ColdMessage cold_message;
+  cold_message.data = log_event_store(*m);
+  if (cold_message.data.size() >= MIN_COMPRESSED_COLD_MESSAGE_SIZE) {
+    auto compressed_data = gzencode(cold_message.data.as_slice(), 0.9);
+    if (!compressed_data.empty()) {
+      cold_message.data = std::move(compressed_data);
+      cold_message.is_compressed = true;
+    }
+  }
+  cold_message.seq_no = ++cold_message_seq_no_;
+  cold_messages_size_ += cold_message.data.size();
+  cold_message_queue_.emplace_back(cold_message.seq_no, full_message_id);
+
+  auto &old_cold_message = cold_messages_[full_message_id];
+  cold_messages_size_ -= old_cold_message.data.size();
+  old_cold_message = std::move(cold_message);
+
+  trim_cold_messages(max_size);
+}
+
+BufferSlice MessagesManager::get_cold_message(FullMessageId full_message_id) {
+  auto it = cold_messages_.find(full_message_id);
+  if (it == cold_messages_.end()) {
+    return BufferSlice();
+  }
+
+  auto cold_message = std::move(it->second);
+  cold_messages_.erase(it);
+  cold_messages_size_ -= cold_message.data.size();
+  if (!cold_message.is_compressed) {
+    return std::move(cold_message.data);
+  }
+  return gzdecode(cold_message.data.as_slice());
+}
+
+void MessagesManager::delete_cold_message(FullMessageId full_message_id) {
+  auto it = cold_messages_.find(full_message_id);
+  if (it != cold_messages_.end()) {
+    cold_messages_size_ -= it->second.data.size();
+    cold_messages_.erase(it);
+  }
+}
+
+void MessagesManager::delete_dialog_cold_messages(DialogId dialog_id, MessageId max_message_id) {
+  if (cold_messages_.empty()) {
+    return;
+  }
+
+  for (auto it = cold_messages_.begin(); it != cold_messages_.end();) {
+    if (it->first.get_dialog_id() == dialog_id && it->first.get_message_id().get() <= max_message_id.get()) {
+      cold_messages_size_ -= it->second.data.size();
+      it = cold_messages_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void MessagesManager::trim_cold_messages(size_t max_size) {
+  while (cold_messages_size_ > max_size) {
+    CHECK(!cold_message_queue_.empty());
+    auto seq_no = cold_message_queue_.front().first;
+    auto full_message_id = cold_message_queue_.front().second;
+    cold_message_queue_.pop_front();
+
+    auto it = cold_messages_.find(full_message_id);
+    if (it != cold_messages_.end() && it->second.seq_no == seq_no) {
+      cold_messages_size_ -= it->second.data.size();
+      cold_messages_.erase(it);
+    }
+  }
+  if (cold_messages_.empty()) {
+    cold_message_queue_.clear();
+  } else if (cold_message_queue_.size() > 2 * cold_messages_.size()) {
+    // entries of loaded and deleted messages are left in the queue, so it must be compacted from time to time
+    auto is_stale = [this](const std::pair<uint64, FullMessageId> &queue_entry) {
+      auto it = cold_messages_.find(queue_entry.second);
+      return it == cold_messages_.end() || it->second.seq_no != queue_entry.first;
+    };
+    cold_message_queue_.erase(std::remove_if(cold_message_queue_.begin(), cold_message_queue_.end(), is_stale),
+                              cold_message_queue_.end());
+  }
+}
+
+void MessagesManager::on_update_cold_message_cache_size() {
+  trim_cold_messages(static_cast<size_t>(G()->shared_config().get_option_integer("cold_message_cache_size")));
 }
 
 unique_ptr<MessagesManager::Message> MessagesManager::delete_message(Dialog *d, MessageId message_id,
@@ -10143,6 +10244,7 @@ unique_ptr<MessagesManager::Message> MessagesManager::do_delete_message(Dialog *
   bool need_get_history = false;
   if (!only_from_memory) {
     delete_message_from_database(d, message_id, m, is_permanently_deleted);
+    delete_cold_message(full_message_id);
 
     delete_active_live_location(d->dialog_id, m);
 
@@ -19646,11 +19748,17 @@ MessagesManager::Message *MessagesManager::get_message_force(Dialog *d, MessageI
     return result;
   }
 
-  if (!G()->parameters().use_message_db || message_id.is_yet_unsent()) {
+  if (message_id.is_yet_unsent() || d->deleted_message_ids.count(message_id)) {
     return nullptr;
   }
 
-  if (d->deleted_message_ids.count(message_id)) {
+  auto cold_message = get_cold_message({d->dialog_id, message_id});
+  if (!cold_message.empty()) {
+    LOG(INFO) << "Restore " << FullMessageId{d->dialog_id, message_id} << " from memory";
+    return on_get_message_from_database(d->dialog_id, d, cold_message);
+  }
+
+  if (!G()->parameters().use_message_db) {
     return nullptr;
   }
 
@@ -21422,12 +21530,14 @@ void MessagesManager::add_message_to_database(const Dialog *d, const Message *m,
 
 void MessagesManager::delete_all_dialog_messages_from_database(DialogId dialog_id, MessageId message_id,
                                                                const char *source) {
-  if (!G()->parameters().use_message_db) {
+  CHECK(dialog_id.is_valid());
+  if (!message_id.is_valid()) {
     return;
   }
 
-  CHECK(dialog_id.is_valid());
-  if (!message_id.is_valid()) {
+  delete_dialog_cold_messages(dialog_id, message_id);
+
+  if (!G()->parameters().use_message_db) {
     return;
   }
 
@@ -22997,11 +23107,49 @@ void MessagesManager::do_get_channel_difference(DialogId dialog_id, int32 pts, b
                                                 const char *source) {
   auto inserted = active_get_channel_differencies_.emplace(dialog_id, source);
   if (!inserted.second) {
+    auto it = pending_get_channel_differences_.find(dialog_id);
+    if (it != pending_get_channel_differences_.end()) {
+      // the request is still waiting for its turn, so the dialog may need to be moved forward in the queue
+      auto &pending = it->second;
+      pending.force |= force;
+      auto priority = get_channel_difference_priority(dialog_id);
+      if (-priority < pending.queue_key.first) {
+        get_channel_difference_queue_.erase(pending.queue_key);
+        pending.queue_key = {-priority, pending.queue_key.second};
+        get_channel_difference_queue_.emplace(pending.queue_key, dialog_id);
+      }
+    }
     LOG(INFO) << "Skip running channels.getDifference for " << dialog_id << " from " << source
               << " because it has already been run";
     return;
   }
 
+  if (sent_get_channel_difference_count_ == 0 && get_channel_difference_queue_.empty()) {
+    get_channel_difference_start_time_ = Time::now();
+    finished_get_channel_difference_count_ = 0;
+    received_channel_difference_message_count_ = 0;
+  }
+
+  auto concurrency = G()->shared_config().get_option_integer("channel_difference_concurrency",
+                                                             DEFAULT_GET_CHANNEL_DIFFERENCE_CONCURRENCY);
+  if (sent_get_channel_difference_count_ < concurrency) {
+    return send_get_channel_difference_query(dialog_id, pts, force, std::move(input_channel));
+  }
+
+  auto priority = get_channel_difference_priority(dialog_id);
+  LOG(INFO) << "Postpone channels.getDifference for " << dialog_id << " with pts " << pts << " and priority "
+            << priority << " from " << source << ", because there are already " << sent_get_channel_difference_count_
+            << " running requests";
+  PendingGetChannelDifference pending;
+  pending.pts = pts;
+  pending.force = force;
+  pending.queue_key = {-priority, ++get_channel_difference_seq_no_};
+  get_channel_difference_queue_.emplace(pending.queue_key, dialog_id);
+  pending_get_channel_differences_.emplace(dialog_id, pending);
+}
+
+void MessagesManager::send_get_channel_difference_query(DialogId dialog_id, int32 pts, bool force,
+                                                        tl_object_ptr<telegram_api::InputChannel> &&input_channel) {
   int32 limit = td_->auth_manager_->is_bot() ? MAX_BOT_CHANNEL_DIFFERENCE : MAX_CHANNEL_DIFFERENCE;
   if (pts <= 0) {
     pts = 1;
@@ -23009,11 +23157,68 @@ void MessagesManager::do_get_channel_difference(DialogId dialog_id, int32 pts, b
   }
 
   LOG(INFO) << "-----BEGIN GET CHANNEL DIFFERENCE----- for " << dialog_id << " with pts " << pts << " and limit "
-            << limit << " from " << source;
+            << limit << " from " << active_get_channel_differencies_[dialog_id];
 
+  sent_get_channel_difference_count_++;
   td_->create_handler<GetChannelDifferenceQuery>()->send(dialog_id, std::move(input_channel), pts, limit, force);
 }
 
+// opened dialogs are caught up first, then pinned dialogs, then dialogs with enabled notifications
+int32 MessagesManager::get_channel_difference_priority(DialogId dialog_id) const {
+  auto d = get_dialog(dialog_id);
+  if (d == nullptr) {
+    return 0;
+  }
+  if (d->is_opened) {
+    return 3;
+  }
+  if (d->pinned_order != DEFAULT_ORDER) {
+    return 2;
+  }
+  if (d->notification_settings.mute_until <= G()->unix_time()) {
+    return 1;
+  }
+  return 0;
+}
+
+void MessagesManager::run_pending_get_channel_differences() {
+  if (G()->close_flag()) {
+    return;
+  }
+
+  auto concurrency = G()->shared_config().get_option_integer("channel_difference_concurrency",
+                                                             DEFAULT_GET_CHANNEL_DIFFERENCE_CONCURRENCY);
+  while (sent_get_channel_difference_count_ < concurrency && !get_channel_difference_queue_.empty()) {
+    auto queue_it = get_channel_difference_queue_.begin();
+    auto dialog_id = queue_it->second;
+    get_channel_difference_queue_.erase(queue_it);
+
+    auto it = pending_get_channel_differences_.find(dialog_id);
+    CHECK(it != pending_get_channel_differences_.end());
+    auto pending = it->second;
+    pending_get_channel_differences_.erase(it);
+
+    auto input_channel = td_->contacts_manager_->get_input_channel(dialog_id.get_channel_id());
+    if (input_channel == nullptr) {
+      LOG(ERROR) << "Skip running postponed channels.getDifference for " << dialog_id
+                 << " because have no info about the chat";
+      active_get_channel_differencies_.erase(dialog_id);
+      after_get_channel_difference(dialog_id, false);
+      continue;
+    }
+    send_get_channel_difference_query(dialog_id, pending.pts, pending.force, std::move(input_channel));
+  }
+
+  if (sent_get_channel_difference_count_ == 0 && get_channel_difference_queue_.empty() &&
+      finished_get_channel_difference_count_ > 1) {
+    auto elapsed = Time::now() - get_channel_difference_start_time_;
+    LOG(INFO) << "Finish channel difference catch-up: " << finished_get_channel_difference_count_
+              << " requests with " << received_channel_difference_message_count_ << " messages in " << elapsed
+              << " seconds, " << finished_get_channel_difference_count_ / (elapsed + 1e-3) << " requests per second";
+    finished_get_channel_difference_count_ = 0;
+  }
+}
+
 void MessagesManager::process_get_channel_difference_updates(
     DialogId dialog_id, vector<tl_object_ptr<telegram_api::Message>> &&new_messages,
     vector<tl_object_ptr<telegram_api::Update>> &&other_updates) {
@@ -23155,6 +23360,19 @@ void MessagesManager::on_get_channel_difference(
   LOG(INFO) << "----- END  GET CHANNEL DIFFERENCE----- for " << dialog_id;
   CHECK(active_get_channel_differencies_.count(dialog_id) == 1);
   active_get_channel_differencies_.erase(dialog_id);
+  CHECK(sent_get_channel_difference_count_ > 0);
+  sent_get_channel_difference_count_--;
+  finished_get_channel_difference_count_++;
+  if (finished_get_channel_difference_count_ % 100 == 0) {
+    LOG(INFO) << "Channel difference catch-up progress: " << finished_get_channel_difference_count_
+              << " requests finished, " << sent_get_channel_difference_count_ << " are running and "
+              << get_channel_difference_queue_.size() << " are waiting, "
+              << finished_get_channel_difference_count_ / (Time::now() - get_channel_difference_start_time_ + 1e-3)
+              << " requests per second";
+  }
+  // the freed slot is taken by the next request for the same channel if the difference isn't final,
+  // so postponed requests are sent later
+  send_closure_later(actor_id(this), &MessagesManager::run_pending_get_channel_differences);
   auto d = get_dialog_force(dialog_id);
 
   if (difference_ptr == nullptr) {
@@ -23229,6 +23447,7 @@ void MessagesManager::on_get_channel_difference(
       td_->contacts_manager_->on_get_users(std::move(difference->users_));
       td_->contacts_manager_->on_get_chats(std::move(difference->chats_));
 
+      received_channel_difference_message_count_ += narrow_cast<int32>(difference->new_messages_.size());
       process_get_channel_difference_updates(dialog_id, std::move(difference->new_messages_),
                                              std::move(difference->other_updates_));
 
@@ -52,6 +52,7 @@
 #include "td/utils/tl_storers.h"
 
 #include <array>
+#include <deque>
 #include <functional>
 #include <limits>
 #include <map>
@@ -1276,6 +1277,10 @@ class MessagesManager : public Actor {
   void on_get_channel_difference(DialogId dialog_id, int32 request_pts, int32 request_limit,
                                  tl_object_ptr<telegram_api::updates_ChannelDifference> &&difference_ptr);
 
+  void run_pending_get_channel_differences();
+
+  void on_update_cold_message_cache_size();
+
   void force_create_dialog(DialogId dialog_id, const char *source, bool force_update_dialog_pos = false);
 
   void on_get_dialog_success(DialogId dialog_id);
@@ -1736,6 +1741,10 @@ class MessagesManager : public Actor {
   static constexpr int32 MIN_PINNED_DIALOG_DATE = 2147000000;  // some big date
   static constexpr int32 MAX_PRIVATE_MESSAGE_TTL = 60;         // server side limit
 
+  static constexpr int32 DEFAULT_GET_CHANNEL_DIFFERENCE_CONCURRENCY = 10;
+
+  static constexpr size_t MIN_COMPRESSED_COLD_MESSAGE_SIZE = 512;
+
   static constexpr int32 UPDATE_CHANNEL_TO_LONG_FLAG_HAS_PTS = 1 << 0;
 
   static constexpr int32 CHANNEL_DIFFERENCE_FLAG_IS_FINAL = 1 << 0;
@@ -1893,6 +1902,16 @@ class MessagesManager : public Actor {
 
   void unload_message(Dialog *d, MessageId message_id);
 
+  void add_cold_message(DialogId dialog_id, const Message *m);
+
+  BufferSlice get_cold_message(FullMessageId full_message_id);
+
+  void delete_cold_message(FullMessageId full_message_id);
+
+  void delete_dialog_cold_messages(DialogId dialog_id, MessageId max_message_id);
+
+  void trim_cold_messages(size_t max_size);
+
   unique_ptr<Message> delete_message(Dialog *d, MessageId message_id, bool is_permanently_deleted,
                                      bool *need_update_dialog_pos, const char *source);
 
@@ -2335,6 +2354,11 @@ class MessagesManager : public Actor {
   void do_get_channel_difference(DialogId dialog_id, int32 pts, bool force,
                                  tl_object_ptr<telegram_api::InputChannel> &&input_channel, const char *source);
 
+  void send_get_channel_difference_query(DialogId dialog_id, int32 pts, bool force,
+                                         tl_object_ptr<telegram_api::InputChannel> &&input_channel);
+
+  int32 get_channel_difference_priority(DialogId dialog_id) const;
+
   void process_get_channel_difference_updates(DialogId dialog_id,
                                               vector<tl_object_ptr<telegram_api::Message>> &&new_messages,
                                               vector<tl_object_ptr<telegram_api::Update>> &&other_updates);
@@ -2565,6 +2589,17 @@ class MessagesManager : public Actor {
 
   std::unordered_set<FullMessageId, FullMessageIdHash> waiting_for_web_page_messages_;
 
+  // unloaded messages, serialized in the same format as in the message database
+  struct ColdMessage {
+    BufferSlice data;
+    bool is_compressed = false;
+    uint64 seq_no = 0;
+  };
+  std::unordered_map<FullMessageId, ColdMessage, FullMessageIdHash> cold_messages_;
+  std::deque<std::pair<uint64, FullMessageId>> cold_message_queue_;  // in order of unloading
+  uint64 cold_message_seq_no_ = 0;
+  size_t cold_messages_size_ = 0;
+
   NotificationSettings users_notification_settings_;
   NotificationSettings chats_notification_settings_;
   NotificationSettings dialogs_notification_settings_;
@@ -2591,6 +2626,22 @@ class MessagesManager : public Actor {
   std::unordered_map<DialogId, string, DialogIdHash> active_get_channel_differencies_;
   std::unordered_map<DialogId, uint64, DialogIdHash> get_channel_difference_to_logevent_id_;
 
+  // channels.getDifference requests, which are waiting for a free slot; they are also active
+  struct PendingGetChannelDifference {
+    int32 pts = 0;
+    bool force = false;
+    std::pair<int32, uint64> queue_key;
+  };
+  std::unordered_map<DialogId, PendingGetChannelDifference, DialogIdHash> pending_get_channel_differences_;
+  std::map<std::pair<int32, uint64>, DialogId> get_channel_difference_queue_;  // (-priority, seq_no) -> dialog_id
+  uint64 get_channel_difference_seq_no_ = 0;
+  int32 sent_get_channel_difference_count_ = 0;
+
+  // statistics of the current channel difference catch-up
+  double get_channel_difference_start_time_ = 0;
+  int32 finished_get_channel_difference_count_ = 0;
+  int32 received_channel_difference_message_count_ = 0;
+
   MultiTimeout channel_get_difference_timeout_;
   MultiTimeout channel_get_difference_retry_timeout_;
   MultiTimeout pending_message_views_timeout_;
@@ -392,6 +392,7 @@ std::unique_ptr<SecretChatActor::Context> SecretChatsManager::make_secret_chat_c
       return G()->get_dh_config();
     }
     void set_dh_config(std::shared_ptr<DhConfig> dh_config) override {
+      DhKeyPool::instance().prepare(dh_config->g, dh_config->prime);
       G()->set_dh_config(std::move(dh_config));
     }
     void send_net_query(NetQueryPtr query, ActorShared<NetQueryCallback> callback, bool ordered) override {
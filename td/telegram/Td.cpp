@@ -7,6 +7,9 @@
 #include "td/telegram/Td.h"
 
 #include "td/db/binlog/BinlogEvent.h"
+#include "td/db/SqliteDb.h"
+#include "td/db/SqliteMaintenance.h"
+#include "td/db/SqliteStatement.h"
 
 #include "td/telegram/net/ConnectionCreator.h"
 #include "td/telegram/net/MtprotoHeader.h"
@@ -29,6 +32,7 @@
 #include "td/telegram/ConfigShared.h"
 #include "td/telegram/ContactsManager.h"
 #include "td/telegram/DeviceTokenManager.h"
+#include "td/telegram/DhWorker.h"
 #include "td/telegram/DialogId.h"
 #include "td/telegram/DialogParticipant.h"
 #include "td/telegram/DocumentsManager.h"
@@ -66,6 +70,8 @@
 
 #include "td/mtproto/utils.h"  // for create_storer, fetch_result, etc, TODO
 
+#include "memprof/memprof.h"
+
 #include "td/utils/buffer.h"
 #include "td/utils/format.h"
 #include "td/utils/MimeType.h"
@@ -3542,6 +3548,10 @@ void Td::on_alarm_timeout(int64 request_id) {
     on_online_updated(false, true);
     return;
   }
+  if (request_id == PENDING_UPDATES_TIMEOUT_ID) {
+    flush_pending_updates();
+    return;
+  }
   send_result(static_cast<uint64>(request_id), make_tl_object<td_api::ok>());
 }
 
@@ -3712,6 +3722,9 @@ void Td::on_result(NetQueryPtr query) {
       return;
     }
     auto ok = query->move_as_ok();
+    if (traffic_recorder_ != nullptr) {
+      traffic_recorder_->add_update(ok.as_slice());
+    }
     TlBufferParser parser(&ok);
     auto ptr = telegram_api::Updates::fetch(parser);
     if (parser.get_error()) {
@@ -3722,6 +3735,9 @@ void Td::on_result(NetQueryPtr query) {
     }
     return;
   }
+  if (traffic_recorder_ != nullptr && query->is_ok()) {
+    traffic_recorder_->add_result(query->tl_constructor(), query->ok().as_slice());
+  }
   auto handler = extract_handler(query->id());
   if (handler == nullptr) {
     query->clear();
@@ -3753,6 +3769,19 @@ void Td::on_config_option_updated(const string &name) {
     send_closure(storage_manager_, &StorageManager::update_use_storage_optimizer);
   } else if (name == "rating_e_decay") {
     return send_closure(top_dialog_manager_, &TopDialogManager::update_rating_e_decay);
+  } else if (name == "channel_difference_concurrency") {
+    send_closure(messages_manager_actor_, &MessagesManager::run_pending_get_channel_differences);
+  } else if (name == "cold_message_cache_size") {
+    send_closure(messages_manager_actor_, &MessagesManager::on_update_cold_message_cache_size);
+  } else if (name == "update_coalescing_delay_ms") {
+    update_coalescing_delay_ms_ = G()->shared_config().get_option_integer(name);
+    if (update_coalescing_delay_ms_ == 0) {
+      flush_pending_updates();
+    }
+  } else if (name == "database_slow_query_threshold_ms") {
+    update_database_slow_query_threshold();
+  } else if (name == "use_database_full_vacuum") {
+    update_database_full_vacuum();
   } else if (name == "call_ring_timeout_ms" || name == "call_receive_timeout_ms" ||
              name == "channels_read_media_period") {
     return;
@@ -3895,6 +3924,7 @@ void Td::dec_actor_refcnt() {
       close_flag_ = 5;
       send_update(td_api::make_object<td_api::updateAuthorizationState>(
           td_api::make_object<td_api::authorizationStateClosed>()));
+      flush_pending_updates();
       callback_->on_closed();
       dec_stop_cnt();
     } else {
@@ -3976,6 +4006,8 @@ void Td::clear() {
   LOG(DEBUG) << "ConfigManager was cleared " << timer;
   device_token_manager_.reset();
   LOG(DEBUG) << "DeviceTokenManager was cleared " << timer;
+  dh_worker_.reset();
+  LOG(DEBUG) << "DhWorker was cleared " << timer;
   hashtag_hints_.reset();
   LOG(DEBUG) << "HashtagHints was cleared " << timer;
   net_stats_manager_.reset();
@@ -4140,6 +4172,9 @@ Status Td::init(DbKey key) {
 
   G()->set_shared_config(
       std::make_unique<ConfigShared>(G()->td_db()->get_config_pmc(), std::make_unique<ConfigSharedCallback>()));
+  update_coalescing_delay_ms_ = G()->shared_config().get_option_integer("update_coalescing_delay_ms");
+  update_database_slow_query_threshold();
+  update_database_full_vacuum();
   config_manager_ = create_actor<ConfigManager>("ConfigManager", create_reference());
   G()->set_config_manager(config_manager_.get());
 
@@ -4208,6 +4243,7 @@ Status Td::init(DbKey key) {
   call_manager_ = create_actor<CallManager>("CallManager", create_reference());
   G()->set_call_manager(call_manager_.get());
   device_token_manager_ = create_actor<DeviceTokenManager>("DeviceTokenManager", create_reference());
+  dh_worker_ = create_actor_on_scheduler<DhWorker>("DhWorker", G()->get_gc_scheduler_id(), create_reference());
   hashtag_hints_ = create_actor<HashtagHints>("HashtagHints", "text", create_reference());
   password_manager_ = create_actor<PasswordManager>("PasswordManager", create_reference());
   privacy_manager_ = create_actor<PrivacyManager>("PrivacyManager", create_reference());
@@ -4281,6 +4317,65 @@ Status Td::init(DbKey key) {
 }
 
 void Td::send_update(tl_object_ptr<td_api::Update> &&object) {
+  CHECK(object != nullptr);
+  if (update_coalescing_delay_ms_ > 0 &&
+      (!update_coalescer_.empty() || UpdateCoalescer::is_mergeable(object.get()))) {
+    if (update_coalescer_.empty()) {
+      alarm_timeout_.set_timeout_in(PENDING_UPDATES_TIMEOUT_ID, update_coalescing_delay_ms_ * 0.001);
+    }
+    update_coalescer_.add_update(std::move(object));
+    if (update_coalescer_.size() >= MAX_PENDING_UPDATES) {
+      flush_pending_updates();
+    }
+    return;
+  }
+
+  send_update_impl(std::move(object));
+}
+
+void Td::flush_pending_updates() {
+  if (update_coalescer_.empty()) {
+    return;
+  }
+  alarm_timeout_.cancel_timeout(PENDING_UPDATES_TIMEOUT_ID);
+
+  auto updates = update_coalescer_.get_updates();
+  VLOG(td_requests) << "Flush " << updates.size() << " pending updates, " << update_coalescer_.get_merged_update_count()
+                    << " out of " << update_coalescer_.get_added_update_count() << " updates were merged in total";
+  for (auto &update : updates) {
+    send_update_impl(std::move(update));
+  }
+}
+
+void Td::update_traffic_recorder() {
+  traffic_recorder_ = nullptr;
+  if (traffic_dump_path_.empty()) {
+    return;
+  }
+
+  auto r_traffic_recorder = TrafficRecorder::open(traffic_dump_path_);
+  if (r_traffic_recorder.is_error()) {
+    LOG(ERROR) << "Failed to open traffic dump file \"" << traffic_dump_path_ << "\": " << r_traffic_recorder.error();
+    return;
+  }
+  LOG(WARNING) << "Record received updates and query results, including private data, to \"" << traffic_dump_path_
+               << '"';
+  traffic_recorder_ = r_traffic_recorder.move_as_ok();
+}
+
+void Td::update_database_slow_query_threshold() {
+  auto threshold_ms = G()->shared_config().get_option_integer("database_slow_query_threshold_ms");
+  SqliteStatement::set_slow_query_threshold(static_cast<double>(threshold_ms) * 0.001);
+}
+
+void Td::update_database_full_vacuum() {
+  auto sqlite_maintenance = G()->td_db()->get_sqlite_maintenance();
+  if (sqlite_maintenance != nullptr) {
+    sqlite_maintenance->set_allow_full_vacuum(G()->shared_config().get_option_boolean("use_database_full_vacuum"));
+  }
+}
+
+void Td::send_update_impl(tl_object_ptr<td_api::Update> &&object) {
   switch (object->get_id()) {
     case td_api::updateFavoriteStickers::ID:
     case td_api::updateInstalledStickerSets::ID:
@@ -4302,6 +4397,7 @@ void Td::send_update(tl_object_ptr<td_api::Update> &&object) {
 void Td::send_result(uint64 id, tl_object_ptr<td_api::Object> object) {
   LOG_IF(ERROR, id == 0) << "Sending " << to_string(object) << " through send_result";
   if (id == 0 || request_set_.erase(id)) {
+    flush_pending_updates();  // updates, sent before the result, must be received before it
     VLOG(td_requests) << "Sending result for request " << id << ": " << to_string(object);
     if (object == nullptr) {
       object = make_tl_object<td_api::error>(404, "Not Found");
@@ -4315,6 +4411,7 @@ void Td::send_error_impl(uint64 id, tl_object_ptr<td_api::error> error) {
   CHECK(callback_ != nullptr);
   CHECK(error != nullptr);
   if (request_set_.erase(id)) {
+    flush_pending_updates();
     VLOG(td_requests) << "Sending error for request " << id << ": " << oneline(to_string(error));
     callback_->on_error(id, std::move(error));
   }
@@ -4439,6 +4536,39 @@ Status Td::set_td_parameters(td_api::object_ptr<td_api::tdlibParameters> paramet
   parameters_.use_chat_info_db = parameters->use_chat_info_database_;
   parameters_.use_message_db = parameters->use_message_database_;
 
+  SqliteDb::Options database_options;
+  if (parameters->database_tuning_profile_ != nullptr) {
+    switch (parameters->database_tuning_profile_->get_id()) {
+      case td_api::databaseTuningProfileDefault::ID:
+        break;
+      case td_api::databaseTuningProfileServer::ID:
+        database_options = SqliteDb::Options::server();
+        break;
+      case td_api::databaseTuningProfileCustom::ID: {
+        auto profile =
+            static_cast<const td_api::databaseTuningProfileCustom *>(parameters->database_tuning_profile_.get());
+        if (profile->cache_size_ < 0 || profile->mmap_size_ < 0 || profile->wal_autocheckpoint_ < 0) {
+          return Status::Error(400, "Database tuning parameters must be non-negative");
+        }
+        auto page_size = profile->page_size_;
+        if (page_size != 0 && (page_size < 512 || page_size > 65536 || (page_size & (page_size - 1)) != 0)) {
+          return Status::Error(400, "Database page size must be a power of 2 between 512 and 65536");
+        }
+        database_options.cache_size = profile->cache_size_;
+        database_options.mmap_size = profile->mmap_size_;
+        database_options.page_size = page_size;
+        database_options.wal_autocheckpoint = profile->wal_autocheckpoint_;
+        break;
+      }
+      default:
+        UNREACHABLE();
+    }
+  }
+  parameters_.database_cache_size = database_options.cache_size;
+  parameters_.database_mmap_size = database_options.mmap_size;
+  parameters_.database_page_size = database_options.page_size;
+  parameters_.database_wal_autocheckpoint = database_options.wal_autocheckpoint;
+
   TRY_STATUS(fix_parameters(parameters_));
   TRY_RESULT(encryption_info, TdDb::check_encryption(parameters_));
   encryption_info_ = std::move(encryption_info);
@@ -6118,6 +6248,15 @@ void Td::on_request(uint64 id, td_api::getOption &request) {
         option_value = make_tl_object<td_api::optionValueBoolean>(is_online_);
       }
       break;
+    case 't':
+      if (request.name_ == "traffic_dump_path") {
+        if (traffic_dump_path_.empty()) {
+          option_value = make_tl_object<td_api::optionValueEmpty>();
+        } else {
+          option_value = make_tl_object<td_api::optionValueString>(traffic_dump_path_);
+        }
+      }
+      break;
     case 'v':
       if (request.name_ == "version") {
         option_value = make_tl_object<td_api::optionValueString>(tdlib_version);
@@ -6179,7 +6318,18 @@ void Td::on_request(uint64 id, td_api::setOption &request) {
   };
 
   switch (request.name_[0]) {
+    case 'c':
+      if (set_integer_option("channel_difference_concurrency", 1, 100)) {
+        return;
+      }
+      if (set_integer_option("cold_message_cache_size", 0, 1 << 30)) {
+        return;
+      }
+      break;
     case 'd':
+      if (set_integer_option("database_slow_query_threshold_ms", 0, 3600000)) {
+        return;
+      }
       if (set_boolean_option("disable_contact_registered_notifications")) {
         return;
       }
@@ -6218,6 +6368,17 @@ void Td::on_request(uint64 id, td_api::setOption &request) {
       if (set_integer_option("storage_immunity_delay")) {
         return;
       }
+      for (auto connection_class : {"main", "upload", "download"}) {
+        if (set_integer_option(PSLICE() << "socket_send_buffer_size_" << connection_class, 0, 1 << 26)) {
+          return;
+        }
+        if (set_integer_option(PSLICE() << "socket_receive_buffer_size_" << connection_class, 0, 1 << 26)) {
+          return;
+        }
+        if (set_integer_option(PSLICE() << "socket_keepalive_timeout_" << connection_class, 0, 86400)) {
+          return;
+        }
+      }
       break;
     case 'X':
     case 'x': {
@@ -6245,7 +6406,31 @@ void Td::on_request(uint64 id, td_api::setOption &request) {
       }
       return send_closure(actor_id(this), &Td::send_result, id, make_tl_object<td_api::ok>());
     }
+    case 't':
+      // the traffic dump contains private data, so it is never enabled implicitly after a restart
+      if (request.name_ == "traffic_dump_path") {
+        if (value_constructor_id != td_api::optionValueString::ID &&
+            value_constructor_id != td_api::optionValueEmpty::ID) {
+          return send_error_raw(id, 3, "Option \"traffic_dump_path\" must have string value");
+        }
+        string traffic_dump_path;
+        if (value_constructor_id == td_api::optionValueString::ID) {
+          traffic_dump_path = static_cast<const td_api::optionValueString *>(request.value_.get())->value_;
+        }
+        if (traffic_dump_path != traffic_dump_path_) {
+          traffic_dump_path_ = std::move(traffic_dump_path);
+          update_traffic_recorder();
+        }
+        return send_closure(actor_id(this), &Td::send_result, id, make_tl_object<td_api::ok>());
+      }
+      break;
     case 'u':
+      if (set_integer_option("update_coalescing_delay_ms", 0, 1000)) {
+        return;
+      }
+      if (set_boolean_option("use_database_full_vacuum")) {
+        return;
+      }
       if (set_boolean_option("use_pfs")) {
         return;
       }
@@ -6255,6 +6440,12 @@ void Td::on_request(uint64 id, td_api::setOption &request) {
       if (set_boolean_option("use_storage_optimizer")) {
         return;
       }
+      if (set_boolean_option("use_tcp_fast_open")) {
+        return;
+      }
+      if (set_boolean_option("use_tcp_quick_ack")) {
+        return;
+      }
       break;
   }
 
@@ -6489,6 +6680,55 @@ void Td::on_request(uint64 id, const td_api::getFileExtension &request) {
   send_result(id, do_static_request(request));
 }
 
+namespace {
+string get_database_statement_statistics() {
+  string result;
+  for (auto &statement_stats : SqliteStatement::get_stats()) {
+    result += PSTRING() << statement_stats << '\n';
+  }
+  return result;
+}
+}  // namespace
+
+void Td::on_request(uint64 id, const td_api::getDatabaseStatistics &request) {
+  // don't check authorization state
+  auto sqlite_maintenance = G()->td_db()->get_sqlite_maintenance();
+  if (sqlite_maintenance == nullptr) {
+    return send_result(id, do_static_request(request));
+  }
+
+  CREATE_REQUEST_PROMISE(promise);
+  auto query_promise = PromiseCreator::lambda(
+      [promise = std::move(promise)](Result<SqliteMaintenanceInterface::Stats> result) mutable {
+        if (result.is_error()) {
+          return promise.set_error(result.move_as_error());
+        }
+        string statistics = PSTRING() << result.ok() << '\n';
+        statistics += get_database_statement_statistics();
+        promise.set_value(make_tl_object<td_api::databaseStatistics>(std::move(statistics)));
+      });
+  sqlite_maintenance->get_stats(std::move(query_promise));
+}
+
+void Td::on_request(uint64 id, const td_api::getMemoryStatistics &request) {
+  // don't check authorization state
+  send_result(id, do_static_request(request));
+}
+
+void Td::on_request(uint64 id, const td_api::getNetworkQueryStatistics &request) {
+  // don't check authorization state
+  auto &stats = G()->net_query_dispatcher().get_stats();
+  auto container_sizes = stats.get_container_size_stats();
+  string result = PSTRING() << tag("containers", container_sizes.get_count())
+                            << tag("messages_per_container_p50", container_sizes.get_percentile(50))
+                            << tag("messages_per_container_p99", container_sizes.get_percentile(99))
+                            << tag("messages_per_container_max", container_sizes.get_max()) << '\n';
+  for (auto &query_stats : stats.get_stats()) {
+    result += PSTRING() << query_stats << '\n';
+  }
+  send_result(id, make_tl_object<td_api::networkQueryStatistics>(std::move(result)));
+}
+
 template <class T>
 td_api::object_ptr<td_api::Object> Td::do_static_request(const T &) {
   return create_error_raw(400, "Function can't be executed synchronously");
@@ -6539,6 +6779,17 @@ td_api::object_ptr<td_api::Object> Td::do_static_request(const td_api::getFileEx
   return make_tl_object<td_api::text>(MimeType::to_extension(request.mime_type_));
 }
 
+td_api::object_ptr<td_api::Object> Td::do_static_request(const td_api::getDatabaseStatistics &request) {
+  return make_tl_object<td_api::databaseStatistics>(get_database_statement_statistics());
+}
+
+td_api::object_ptr<td_api::Object> Td::do_static_request(const td_api::getMemoryStatistics &request) {
+  if (!is_memprof_on()) {
+    return create_error_raw(400, "Memory profiling is disabled");
+  }
+  return make_tl_object<td_api::memoryStatistics>(get_memory_usage_report(MEMORY_STATISTICS_BACKTRACE_COUNT));
+}
+
 // test
 void Td::on_request(uint64 id, td_api::testNetwork &request) {
   create_handler<TestQuery>(id)->send();
@@ -7,10 +7,12 @@
 #pragma once
 
 #include "td/telegram/net/NetQuery.h"
+#include "td/telegram/net/TrafficRecorder.h"
 #include "td/telegram/StateManager.h"
 #include "td/telegram/TdCallback.h"
 #include "td/telegram/TdDb.h"
 #include "td/telegram/TdParameters.h"
+#include "td/telegram/UpdateCoalescer.h"
 
 #include "td/telegram/td_api.h"
 
@@ -38,6 +40,7 @@ class ChangePhoneNumberManager;
 class ConfigManager;
 class ContactsManager;
 class DeviceTokenManager;
+class DhWorker;
 class DocumentsManager;
 class FileManager;
 class InlineQueriesManager;
@@ -143,6 +146,7 @@ class Td final : public NetQueryCallback {
   ActorOwn<CallManager> call_manager_;
   ActorOwn<ConfigManager> config_manager_;
   ActorOwn<DeviceTokenManager> device_token_manager_;
+  ActorOwn<DhWorker> dh_worker_;
   ActorOwn<HashtagHints> hashtag_hints_;
   ActorOwn<NetStatsManager> net_stats_manager_;
   ActorOwn<PasswordManager> password_manager_;
@@ -193,11 +197,19 @@ class Td final : public NetQueryCallback {
  private:
   static constexpr const char *tdlib_version = "1.1.1";
   static constexpr int32 ONLINE_TIMEOUT = 240;
+  static constexpr int64 PENDING_UPDATES_TIMEOUT_ID = -1;
+  static constexpr size_t MAX_PENDING_UPDATES = 1000;
+  static constexpr size_t MEMORY_STATISTICS_BACKTRACE_COUNT = 20;
 
   void send_result(uint64 id, tl_object_ptr<td_api::Object> object);
   void send_error(uint64 id, Status error);
   void send_error_impl(uint64 id, tl_object_ptr<td_api::error> error);
   void send_error_raw(uint64 id, int32 code, CSlice error);
+  void send_update_impl(tl_object_ptr<td_api::Update> &&object);
+  void flush_pending_updates();
+  void update_traffic_recorder();
+  void update_database_slow_query_threshold();
+  void update_database_full_vacuum();
   void answer_ok_query(uint64 id, Status status);
 
   void inc_actor_refcnt();
@@ -231,6 +243,12 @@ class Td final : public NetQueryCallback {
   bool is_online_ = false;
   MultiTimeout alarm_timeout_;
 
+  int32 update_coalescing_delay_ms_ = 0;
+  UpdateCoalescer update_coalescer_;
+
+  string traffic_dump_path_;
+  unique_ptr<TrafficRecorder> traffic_recorder_;
+
   static void on_alarm_timeout_callback(void *td_ptr, int64 request_id);
   void on_alarm_timeout(int64 request_id);
 
@@ -748,6 +766,12 @@ class Td final : public NetQueryCallback {
 
   void on_request(uint64 id, const td_api::getFileExtension &request);
 
+  void on_request(uint64 id, const td_api::getDatabaseStatistics &request);
+
+  void on_request(uint64 id, const td_api::getMemoryStatistics &request);
+
+  void on_request(uint64 id, const td_api::getNetworkQueryStatistics &request);
+
   // test
   void on_request(uint64 id, td_api::testNetwork &request);
   void on_request(uint64 id, td_api::testGetDifference &request);
@@ -768,6 +792,8 @@ class Td final : public NetQueryCallback {
   static td_api::object_ptr<td_api::Object> do_static_request(td_api::parseTextEntities &request);
   static td_api::object_ptr<td_api::Object> do_static_request(const td_api::getFileMimeType &request);
   static td_api::object_ptr<td_api::Object> do_static_request(const td_api::getFileExtension &request);
+  static td_api::object_ptr<td_api::Object> do_static_request(const td_api::getDatabaseStatistics &request);
+  static td_api::object_ptr<td_api::Object> do_static_request(const td_api::getMemoryStatistics &request);
 
   Status init(DbKey key) TD_WARN_UNUSED_RESULT;
   void clear();
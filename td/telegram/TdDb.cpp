@@ -16,6 +16,9 @@
 #include "td/actor/MultiPromise.h"
 
 #include "td/db/BinlogKeyValue.h"
+#include "td/db/SqliteConnectionSafe.h"
+#include "td/db/SqliteDb.h"
+#include "td/db/SqliteMaintenance.h"
 
 #include "td/utils/logging.h"
 #include "td/utils/port/path.h"
@@ -102,6 +105,8 @@ Status init_binlog(Binlog &binlog, string path, BinlogKeyValue<Binlog> &binlog_p
 }
 
 Status init_db(SqliteDb &db) {
+  // has effect only for a new database; freed pages are reclaimed by SqliteMaintenance
+  TRY_STATUS(db.exec("PRAGMA auto_vacuum=INCREMENTAL"));
   TRY_STATUS(db.exec("PRAGMA encoding=\"UTF-8\""));
   TRY_STATUS(db.exec("PRAGMA journal_mode=WAL"));
 
@@ -146,6 +151,10 @@ SqliteKeyValueAsyncInterface *TdDb::get_sqlite_pmc() {
   return common_kv_async_.get();
 }
 
+SqliteMaintenanceInterface *TdDb::get_sqlite_maintenance() {
+  return sqlite_maintenance_.get();
+}
+
 MessagesDbSyncInterface *TdDb::get_messages_db_sync() {
   return &messages_db_sync_safe_->get();
 }
@@ -216,6 +225,10 @@ void TdDb::do_close(Promise<> on_finished, bool destroy_flag) {
     dialog_db_async_->close(mpas.get_promise());
   }
 
+  if (sqlite_maintenance_) {
+    sqlite_maintenance_->close(mpas.get_promise());
+  }
+
   // binlog_pmc is dependent on binlog_ and anyway it doesn't support close_and_destroy
   CHECK(binlog_pmc_.unique());
   binlog_pmc_.reset();
@@ -250,7 +263,12 @@ Status TdDb::init_sqlite(int32 scheduler_id, const TdParameters &parameters, DbK
 
   sqlite_path_ = sql_db_name;
   TRY_STATUS(SqliteDb::change_key(sqlite_path_, key, old_key));
-  sql_connection_ = std::make_shared<SqliteConnectionSafe>(sql_db_name, key);
+  SqliteDb::Options options;
+  options.cache_size = parameters.database_cache_size;
+  options.mmap_size = parameters.database_mmap_size;
+  options.page_size = parameters.database_page_size;
+  options.wal_autocheckpoint = parameters.database_wal_autocheckpoint;
+  sql_connection_ = std::make_shared<SqliteConnectionSafe>(sql_db_name, key, options);
   auto &db = sql_connection_->get();
 
   TRY_STATUS(init_db(db));
@@ -321,6 +339,8 @@ Status TdDb::init_sqlite(int32 scheduler_id, const TdParameters &parameters, DbK
     messages_db_async_ = create_messages_db_async(messages_db_sync_safe_, scheduler_id);
   }
 
+  sqlite_maintenance_ = create_sqlite_maintenance(sql_connection_, scheduler_id);
+
   return Status::OK();
 }
 
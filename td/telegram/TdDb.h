@@ -30,6 +30,7 @@ class SqliteConnectionSafe;
 class SqliteKeyValueSafe;
 class SqliteKeyValueAsyncInterface;
 class SqliteKeyValue;
+class SqliteMaintenanceInterface;
 class MessagesDbSyncInterface;
 class MessagesDbSyncSafeInterface;
 class MessagesDbAsyncInterface;
@@ -77,6 +78,7 @@ class TdDb {
 
   BigPmcPtr get_sqlite_sync_pmc();
   SqliteKeyValueAsyncInterface *get_sqlite_pmc();
+  SqliteMaintenanceInterface *get_sqlite_maintenance();
   CSlice binlog_path() const;
   CSlice sqlite_path() const;
   void flush_all();
@@ -102,6 +104,8 @@ class TdDb {
   std::shared_ptr<SqliteKeyValueSafe> common_kv_safe_;
   std::unique_ptr<SqliteKeyValueAsyncInterface> common_kv_async_;
 
+  std::unique_ptr<SqliteMaintenanceInterface> sqlite_maintenance_;
+
   std::shared_ptr<MessagesDbSyncSafeInterface> messages_db_sync_safe_;
   std::shared_ptr<MessagesDbAsyncInterface> messages_db_async_;
 
@@ -23,6 +23,10 @@ struct TdParameters {
   bool use_secret_chats = false;
   bool use_chat_info_db = false;
   bool use_message_db = false;
+  std::int64_t database_cache_size = 0;
+  std::int64_t database_mmap_size = 0;
+  std::int32_t database_page_size = 0;
+  std::int32_t database_wal_autocheckpoint = 0;
 };
 
 }  // namespace td
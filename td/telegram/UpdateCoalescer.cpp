@@ -0,0 +1,138 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/UpdateCoalescer.h"
+
+#include "td/utils/logging.h"
+
+namespace td {
+
+bool UpdateCoalescer::get_object_key(const td_api::Update *update, std::pair<ObjectType, int64> &key) {
+  switch (update->get_id()) {
+    case td_api::updateUser::ID: {
+      auto user = static_cast<const td_api::updateUser *>(update)->user_.get();
+      if (user == nullptr) {
+        return false;
+      }
+      key = {ObjectType::User, user->id_};
+      return true;
+    }
+    case td_api::updateUserStatus::ID:
+      key = {ObjectType::User, static_cast<const td_api::updateUserStatus *>(update)->user_id_};
+      return true;
+    case td_api::updateSupergroup::ID: {
+      auto supergroup = static_cast<const td_api::updateSupergroup *>(update)->supergroup_.get();
+      if (supergroup == nullptr) {
+        return false;
+      }
+      key = {ObjectType::Supergroup, supergroup->id_};
+      return true;
+    }
+    case td_api::updateFile::ID: {
+      auto file = static_cast<const td_api::updateFile *>(update)->file_.get();
+      if (file == nullptr) {
+        return false;
+      }
+      key = {ObjectType::File, file->id_};
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+bool UpdateCoalescer::get_dependent_key(const td_api::Update *update, std::pair<int32, int64> &key) {
+  int64 object_id;
+  switch (update->get_id()) {
+    case td_api::updateChatLastMessage::ID:
+      object_id = static_cast<const td_api::updateChatLastMessage *>(update)->chat_id_;
+      break;
+    case td_api::updateChatOrder::ID:
+      object_id = static_cast<const td_api::updateChatOrder *>(update)->chat_id_;
+      break;
+    case td_api::updateChatReadInbox::ID:
+      object_id = static_cast<const td_api::updateChatReadInbox *>(update)->chat_id_;
+      break;
+    case td_api::updateChatReadOutbox::ID:
+      object_id = static_cast<const td_api::updateChatReadOutbox *>(update)->chat_id_;
+      break;
+    case td_api::updateChatUnreadMentionCount::ID:
+      object_id = static_cast<const td_api::updateChatUnreadMentionCount *>(update)->chat_id_;
+      break;
+    case td_api::updateUserFullInfo::ID:
+      object_id = static_cast<const td_api::updateUserFullInfo *>(update)->user_id_;
+      break;
+    case td_api::updateBasicGroupFullInfo::ID:
+      object_id = static_cast<const td_api::updateBasicGroupFullInfo *>(update)->basic_group_id_;
+      break;
+    case td_api::updateSupergroupFullInfo::ID:
+      object_id = static_cast<const td_api::updateSupergroupFullInfo *>(update)->supergroup_id_;
+      break;
+    default:
+      return false;
+  }
+  key = {update->get_id(), object_id};
+  return true;
+}
+
+bool UpdateCoalescer::is_mergeable(const td_api::Update *update) {
+  std::pair<ObjectType, int64> object_key;
+  std::pair<int32, int64> dependent_key;
+  return get_object_key(update, object_key) || get_dependent_key(update, dependent_key);
+}
+
+void UpdateCoalescer::add_update(tl_object_ptr<td_api::Update> &&update) {
+  CHECK(update != nullptr);
+  added_update_count_++;
+
+  std::pair<ObjectType, int64> object_key;
+  if (get_object_key(update.get(), object_key)) {
+    auto it = object_update_pos_.find(object_key);
+    if (it != object_update_pos_.end()) {
+      auto &old_update = updates_[it->second];
+      CHECK(old_update != nullptr);
+      if (old_update->get_id() == update->get_id()) {
+        old_update = std::move(update);
+        merged_update_count_++;
+        return;
+      }
+    }
+    object_update_pos_[object_key] = updates_.size();
+    updates_.push_back(std::move(update));
+    return;
+  }
+
+  std::pair<int32, int64> dependent_key;
+  if (get_dependent_key(update.get(), dependent_key)) {
+    auto &pos = dependent_update_pos_[dependent_key];
+    if (pos != 0) {
+      CHECK(updates_[pos - 1] != nullptr);
+      updates_[pos - 1] = nullptr;
+      merged_update_count_++;
+    }
+    updates_.push_back(std::move(update));
+    pos = updates_.size();
+    return;
+  }
+
+  updates_.push_back(std::move(update));
+}
+
+vector<tl_object_ptr<td_api::Update>> UpdateCoalescer::get_updates() {
+  vector<tl_object_ptr<td_api::Update>> result;
+  result.reserve(updates_.size());
+  for (auto &update : updates_) {
+    if (update != nullptr) {
+      result.push_back(std::move(update));
+    }
+  }
+  updates_.clear();
+  object_update_pos_.clear();
+  dependent_update_pos_.clear();
+  return result;
+}
+
+}  // namespace td
@@ -0,0 +1,70 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/telegram/td_api.h"
+
+#include "td/utils/common.h"
+
+#include <map>
+#include <utility>
+
+namespace td {
+
+// Holds td_api updates for a short time and drops the ones, which are superseded by a newer update about the same
+// object. Relative order of all kept updates is preserved. An update is merged only if the client can't observe
+// the difference in the final state and no update can reference an object before it becomes known to the client:
+//  - self-contained object states (updateUser, updateUserStatus, updateSupergroup, updateFile) replace the previous
+//    pending update in place, if it was the last pending update about the same object and has the same type;
+//  - dependent states (updateChatLastMessage, updateChatReadInbox, updateUserFullInfo, etc) remove the previous
+//    pending update with the same type and object, and the new update is appended to the end of the queue.
+class UpdateCoalescer {
+ public:
+  void add_update(tl_object_ptr<td_api::Update> &&update);
+
+  // returns true, if the update can be merged with other updates
+  static bool is_mergeable(const td_api::Update *update);
+
+  bool empty() const {
+    return updates_.empty();
+  }
+
+  size_t size() const {
+    return updates_.size();
+  }
+
+  // returns all pending updates in order of their sending
+  vector<tl_object_ptr<td_api::Update>> get_updates();
+
+  int64 get_added_update_count() const {
+    return added_update_count_;
+  }
+
+  int64 get_merged_update_count() const {
+    return merged_update_count_;
+  }
+
+ private:
+  enum class ObjectType : int32 { User, Supergroup, File };
+
+  vector<tl_object_ptr<td_api::Update>> updates_;
+
+  // (object type, object ID) -> position of the last pending update about the object
+  std::map<std::pair<ObjectType, int64>, size_t> object_update_pos_;
+
+  // (update constructor ID, object ID) -> 1 + position of the pending update
+  std::map<std::pair<int32, int64>, size_t> dependent_update_pos_;
+
+  int64 added_update_count_ = 0;
+  int64 merged_update_count_ = 0;
+
+  static bool get_object_key(const td_api::Update *update, std::pair<ObjectType, int64> &key);
+
+  static bool get_dependent_key(const td_api::Update *update, std::pair<int32, int64> &key);
+};
+
+}  // namespace td
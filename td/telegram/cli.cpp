@@ -1534,6 +1534,10 @@ class CliClient final : public Actor {
       send_request(make_tl_object<td_api::getStorageStatistics>(to_integer<int32>(args)));
     } else if (op == "storage_fast") {
       send_request(make_tl_object<td_api::getStorageStatisticsFast>());
+    } else if (op == "database") {
+      execute(make_tl_object<td_api::getDatabaseStatistics>());
+    } else if (op == "memory") {
+      execute(make_tl_object<td_api::getMemoryStatistics>());
     } else if (op == "optimize_storage") {
       string chat_ids;
       string exclude_chat_ids;
@@ -1567,6 +1571,8 @@ class CliClient final : public Actor {
       send_request(make_tl_object<td_api::getNetworkStatistics>(true));
     } else if (op == "reset_network") {
       send_request(make_tl_object<td_api::resetNetworkStatistics>());
+    } else if (op == "network_queries") {
+      send_request(make_tl_object<td_api::getNetworkQueryStatistics>());
     } else if (op == "snt") {
       send_request(make_tl_object<td_api::setNetworkType>(get_network_type(args)));
     } else if (op == "ansc") {
@@ -2787,6 +2793,10 @@ class CliClient final : public Actor {
       quit();
     } else if (op == "dnq" || op == "DumpNetQueries") {
       dump_pending_network_queries();
+    } else if (op == "mur" || op == "MemoryUsageReport") {
+      LOG(PLAIN) << get_memory_usage_report(args.empty() ? 20 : to_integer<size_t>(args));
+    } else if (op == "smsr" || op == "SetMemprofSampleRate") {
+      set_memprof_sample_rate(to_integer<size_t>(args));
     } else if (op == "fatal") {
       LOG(FATAL) << "Fatal!";
     } else if (op == "unreachable") {
@@ -89,59 +89,60 @@ struct FsFileInfo {
 
 // long and blocking
 template <class CallbackT>
-Status scan_fs(CallbackT &&callback) {
-  for (int i = 0; i < file_type_size; i++) {
-    auto file_type = static_cast<FileType>(i);
-    auto files_dir = get_files_dir(file_type);
-    td::walk_path(files_dir, [&](CSlice path, bool is_dir) {
-      if (is_dir) {
-        // TODO: skip subdirs
-        return;
-      }
-      auto r_stat = stat(path);
-      if (r_stat.is_error()) {
-        LOG(WARNING) << "Stat in files gc failed: " << r_stat.error();
-        return;
-      }
-      auto stat = r_stat.move_as_ok();
-      FsFileInfo info;
-      info.path = path.str();
-      info.size = stat.size_;
-      info.file_type = file_type;
-      info.atime_nsec = stat.atime_nsec_;
-      info.mtime_nsec = stat.mtime_nsec_;
-      callback(info);
-    });
-  }
+Status scan_fs(FileType file_type, CallbackT &&callback) {
+  auto files_dir = get_files_dir(file_type);
+  td::walk_path(files_dir, [&](CSlice path, bool is_dir) {
+    if (is_dir) {
+      // TODO: skip subdirs
+      return;
+    }
+    auto r_stat = stat(path);
+    if (r_stat.is_error()) {
+      LOG(WARNING) << "Stat in files gc failed: " << r_stat.error();
+      return;
+    }
+    auto stat = r_stat.move_as_ok();
+    FsFileInfo info;
+    info.path = path.str();
+    info.size = stat.size_;
+    info.file_type = file_type;
+    info.atime_nsec = stat.atime_nsec_;
+    info.mtime_nsec = stat.mtime_nsec_;
+    callback(info);
+  });
   return Status::OK();
 }
 }  // namespace
 
+struct FileStatsWorker::Query {
+  bool need_all_files;
+  bool split_by_owner_dialog_id;
+  Promise<FileStats> promise;
+  double start_time;
+  int32 next_file_type = 0;
+  std::vector<FullFileInfo> full_infos;
+};
+
 void FileStatsWorker::get_stats(bool need_all_files, bool split_by_owner_dialog_id, Promise<FileStats> promise) {
   if (!G()->parameters().use_chat_info_db) {
     split_by_owner_dialog_id = false;
   }
-  if (!split_by_owner_dialog_id) {
-    FileStats file_stats;
-    file_stats.need_all_files = need_all_files;
-    auto start = Time::now();
-    scan_fs([&](FsFileInfo &fs_info) {
-      FullFileInfo info;
-      info.file_type = fs_info.file_type;
-      info.path = std::move(fs_info.path);
-      info.size = fs_info.size;
-      info.atime_nsec = fs_info.atime_nsec;
-      info.mtime_nsec = fs_info.mtime_nsec;
-      file_stats.add(std::move(info));
-    });
-    auto passed = Time::now() - start;
-    LOG_IF(INFO, passed > 0.5) << "Get file stats took: " << format::as_time(passed);
-    promise.set_value(std::move(file_stats));
-  } else {
-    auto start = Time::now();
-
-    std::vector<FullFileInfo> full_infos;
-    scan_fs([&](FsFileInfo &fs_info) {
+  auto query = make_unique<Query>();
+  query->need_all_files = need_all_files;
+  query->split_by_owner_dialog_id = split_by_owner_dialog_id;
+  query->promise = std::move(promise);
+  query->start_time = Time::now();
+  run_query(std::move(query));
+}
+
+void FileStatsWorker::run_query(unique_ptr<Query> query) {
+  // directories are scanned one by one to not block other actors on the scheduler for too long
+  while (query->next_file_type < file_type_size) {
+    if (need_yield()) {
+      return send_closure_later(actor_id(this), &FileStatsWorker::run_query, std::move(query));
+    }
+    auto file_type = static_cast<FileType>(query->next_file_type++);
+    scan_fs(file_type, [&](FsFileInfo &fs_info) {
       FullFileInfo info;
       info.file_type = fs_info.file_type;
       info.path = std::move(fs_info.path);
@@ -151,9 +152,12 @@ void FileStatsWorker::get_stats(bool need_all_files, bool split_by_owner_dialog_
 
       // LOG(INFO) << "Found file of size " << info.size << " at " << info.path;
 
-      full_infos.push_back(std::move(info));
+      query->full_infos.push_back(std::move(info));
     });
+  }
 
+  auto &full_infos = query->full_infos;
+  if (query->split_by_owner_dialog_id) {
     std::unordered_map<size_t, size_t> hash_to_pos;
     size_t pos = 0;
     for (auto &full_info : full_infos) {
@@ -168,17 +172,17 @@ void FileStatsWorker::get_stats(bool need_all_files, bool split_by_owner_dialog_
       // LOG(INFO) << "Match! " << db_info.path << " from " << db_info.owner_dialog_id;
       full_infos[it->second].owner_dialog_id = db_info.owner_dialog_id;
     });
+  }
 
-    FileStats file_stats;
-    file_stats.need_all_files = need_all_files;
-    file_stats.split_by_owner_dialog_id = split_by_owner_dialog_id;
-    for (auto &full_info : full_infos) {
-      file_stats.add(std::move(full_info));
-    }
-    auto passed = Time::now() - start;
-    LOG_IF(INFO, passed > 0.5) << "Get file stats took: " << format::as_time(passed);
-    promise.set_value(std::move(file_stats));
+  FileStats file_stats;
+  file_stats.need_all_files = query->need_all_files;
+  file_stats.split_by_owner_dialog_id = query->split_by_owner_dialog_id;
+  for (auto &full_info : full_infos) {
+    file_stats.add(std::move(full_info));
   }
+  auto passed = Time::now() - query->start_time;
+  LOG_IF(INFO, passed > 0.5) << "Get file stats took: " << format::as_time(passed);
+  query->promise.set_value(std::move(file_stats));
 }
 
 }  // namespace td
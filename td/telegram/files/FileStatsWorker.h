@@ -11,6 +11,8 @@
 
 #include "td/telegram/files/FileStats.h"
 
+#include "td/utils/common.h"
+
 namespace td {
 
 class FileStatsWorker : public Actor {
@@ -20,7 +22,11 @@ class FileStatsWorker : public Actor {
   void get_stats(bool need_all_files, bool split_by_owner_dialog_id, Promise<FileStats> promise);
 
  private:
+  struct Query;
+
   ActorShared<> parent_;
+
+  void run_query(unique_ptr<Query> query);
 };
 
 }  // namespace td
@@ -8,11 +8,15 @@
 
 #include "td/telegram/Global.h"
 
+#include "td/actor/SchedulerLocalStorage.h"
+
 #include "td/utils/format.h"
 #include "td/utils/logging.h"
 #include "td/utils/port/RwMutex.h"
 #include "td/utils/tl_helpers.h"
 
+#include <atomic>
+
 namespace td {
 
 class AuthDataSharedImpl : public AuthDataShared {
@@ -31,17 +35,16 @@ class AuthDataSharedImpl : public AuthDataShared {
   }
 
   mtproto::AuthKey get_auth_key() override {
-    string dc_key = G()->td_db()->get_binlog_pmc()->get(auth_key_key());
-
-    mtproto::AuthKey res;
-    if (!dc_key.empty()) {
-      unserialize(res, dc_key).ensure();
+    auto &cache = cache_.get();
+    auto generation = auth_key_generation_.load(std::memory_order_acquire);
+    if (cache.auth_key_generation != generation) {
+      cache.auth_key = load_auth_key();
+      cache.auth_key_generation = generation;
     }
-    return res;
+    return cache.auth_key;
   }
   using AuthDataShared::get_auth_state;
   std::pair<AuthState, bool> get_auth_state() override {
-    // TODO (perf):
     auto auth_key = get_auth_key();
     AuthState state = get_auth_state(auth_key);
     return std::make_pair(state, auth_key.was_auth_flag());
@@ -49,6 +52,7 @@ class AuthDataSharedImpl : public AuthDataShared {
 
   void set_auth_key(const mtproto::AuthKey &auth_key) override {
     G()->td_db()->get_binlog_pmc()->set(auth_key_key(), serialize(auth_key));
+    auth_key_generation_.fetch_add(1, std::memory_order_acq_rel);
     log_auth_key(auth_key);
 
     notify();
@@ -72,19 +76,35 @@ class AuthDataSharedImpl : public AuthDataShared {
 
   void set_future_salts(const std::vector<mtproto::ServerSalt> &future_salts) override {
     G()->td_db()->get_binlog_pmc()->set(future_salts_key(), serialize(future_salts));
+    future_salts_generation_.fetch_add(1, std::memory_order_acq_rel);
   }
 
   std::vector<mtproto::ServerSalt> get_future_salts() override {
-    string future_salts = G()->td_db()->get_binlog_pmc()->get(future_salts_key());
-    std::vector<mtproto::ServerSalt> res;
-    if (!future_salts.empty()) {
-      unserialize(res, future_salts).ensure();
+    auto &cache = cache_.get();
+    auto generation = future_salts_generation_.load(std::memory_order_acquire);
+    if (cache.future_salts_generation != generation) {
+      cache.future_salts = load_future_salts();
+      cache.future_salts_generation = generation;
     }
-    return res;
+    return cache.future_salts;
   }
 
  private:
   DcId dc_id_;
+
+  // Sessions of the same DC live on different schedulers, so every scheduler keeps its own copy of the data.
+  // A copy is reloaded from the binlog, only if the corresponding generation has changed since it was loaded.
+  // The generation is increased after the binlog is updated, so a stale copy can't be cached with a new generation.
+  struct Cache {
+    uint64 auth_key_generation = 0;
+    mtproto::AuthKey auth_key;
+    uint64 future_salts_generation = 0;
+    std::vector<mtproto::ServerSalt> future_salts;
+  };
+  std::atomic<uint64> auth_key_generation_{1};
+  std::atomic<uint64> future_salts_generation_{1};
+  SchedulerLocalStorage<Cache> cache_;
+
   std::vector<unique_ptr<Listener>> auth_key_listeners_;
   std::shared_ptr<PublicRsaKeyShared> public_rsa_key_;
   RwMutex rw_mutex_;
@@ -96,6 +116,25 @@ class AuthDataSharedImpl : public AuthDataShared {
     return PSTRING() << "salt" << dc_id_.get_raw_id();
   }
 
+  mtproto::AuthKey load_auth_key() {
+    string dc_key = G()->td_db()->get_binlog_pmc()->get(auth_key_key());
+
+    mtproto::AuthKey res;
+    if (!dc_key.empty()) {
+      unserialize(res, dc_key).ensure();
+    }
+    return res;
+  }
+
+  std::vector<mtproto::ServerSalt> load_future_salts() {
+    string future_salts = G()->td_db()->get_binlog_pmc()->get(future_salts_key());
+    std::vector<mtproto::ServerSalt> res;
+    if (!future_salts.empty()) {
+      unserialize(res, future_salts).ensure();
+    }
+    return res;
+  }
+
   void notify() {
     auto lock = rw_mutex_.lock_read();
 
@@ -7,6 +7,7 @@
 #include "td/telegram/net/ConnectionCreator.h"
 
 #include "td/telegram/ConfigManager.h"
+#include "td/telegram/ConfigShared.h"
 #include "td/telegram/Global.h"
 #include "td/telegram/logevent/LogEvent.h"
 #include "td/telegram/StateManager.h"
@@ -288,6 +289,32 @@ void ConnectionCreator::request_raw_connection_by_ip(IPAddress ip_address,
   promise.set_value(std::move(raw_connection));
 }
 
+SocketOptions ConnectionCreator::get_socket_options(const ClientInfo &client) {
+  Slice connection_class = "main";
+  if (client.is_media) {
+    connection_class = client.allow_media_only ? Slice("download") : Slice("upload");
+  }
+  auto &config = G()->shared_config();
+  auto get_option = [&](Slice name) {
+    return config.get_option_integer(PSLICE() << name << '_' << connection_class);
+  };
+
+  SocketOptions options;
+  options.send_buffer_size = get_option("socket_send_buffer_size");
+  options.receive_buffer_size = get_option("socket_receive_buffer_size");
+  auto keepalive_timeout = get_option("socket_keepalive_timeout");
+  if (keepalive_timeout > 0) {
+    // a dead connection is detected after keepalive_timeout seconds of silence
+    options.keepalive_count = 3;
+    options.keepalive_interval = std::max(keepalive_timeout / 6, 1);
+    options.keepalive_idle = std::max(keepalive_timeout - options.keepalive_count * options.keepalive_interval, 1);
+  }
+  options.quick_ack = config.get_option_boolean("use_tcp_quick_ack");
+  // the first connection fetches TCP Fast Open cookie, so the option is useful only for reconnects
+  options.fast_open = client.was_connected && config.get_option_boolean("use_tcp_fast_open");
+  return options;
+}
+
 void ConnectionCreator::client_loop(ClientInfo &client) {
   CHECK(client.hash != 0);
   if (!network_flag_) {
@@ -381,11 +408,11 @@ void ConnectionCreator::client_loop(ClientInfo &client) {
         debug_str = PSTRING() << "Sock5 " << socks5_ip << " --> " << info.option->get_ip_address() << " " << dc_id
                               << (info.use_http ? " HTTP" : "");
         LOG(INFO) << "Create: " << debug_str;
-        return SocketFd::open(socks5_ip);
+        return SocketFd::open(socks5_ip, get_socket_options(client));
       } else {
         debug_str = PSTRING() << info.option->get_ip_address() << " " << dc_id << (info.use_http ? " HTTP" : "");
         LOG(INFO) << "Create: " << debug_str;
-        return SocketFd::open(info.option->get_ip_address());
+        return SocketFd::open(info.option->get_ip_address(), get_socket_options(client));
       }
     }();
     if (r_socket_fd.is_error()) {
@@ -521,6 +548,7 @@ void ConnectionCreator::client_add_connection(size_t hash,
   }
   if (r_raw_connection.is_ok()) {
     client.backoff.clear();
+    client.was_connected = true;
     client.ready_connections.push_back(std::make_pair(r_raw_connection.move_as_ok(), Time::now_cached()));
   }
   client_loop(client);
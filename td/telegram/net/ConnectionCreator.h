@@ -193,6 +193,7 @@ class ConnectionCreator : public Actor {
     DcId dc_id;
     bool allow_media_only;
     bool is_media;
+    bool was_connected{false};
   };
   std::map<size_t, ClientInfo> clients_;
 
@@ -218,6 +219,7 @@ class ConnectionCreator : public Actor {
 
   void save_dc_options();
   Result<SocketFd> do_request_connection(DcId dc_id, bool allow_media_only);
+  static SocketOptions get_socket_options(const ClientInfo &client);
   Result<std::pair<std::unique_ptr<mtproto::RawConnection>, bool>> do_request_raw_connection(DcId dc_id,
                                                                                              bool allow_media_only,
                                                                                              bool is_media,
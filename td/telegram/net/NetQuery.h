@@ -330,6 +330,18 @@ class NetQuery : public ListNode {
   int32 file_type_ = -1;
 
   double start_timestamp_;
+
+  // statistics of the last attempt to send the query, aggregated by NetQueryStats
+  double dispatch_timestamp_ = 0;
+  double send_timestamp_ = 0;
+  double ack_timestamp_ = 0;
+  double result_timestamp_ = 0;
+  int32 send_count_ = 0;
+  int32 delay_count_ = 0;
+  double delay_time_ = 0;
+  int32 flood_wait_count_ = 0;
+  double flood_wait_time_ = 0;
+
   int32 my_id_ = 0;
   NetQueryCounter nq_counter_;
 
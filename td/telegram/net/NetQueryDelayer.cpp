@@ -48,9 +48,13 @@ void NetQueryDelayer::delay(NetQueryPtr query) {
     }
   } else {
     query->next_timeout = 1;
+    query->flood_wait_count_++;
+    query->flood_wait_time_ += timeout;
   }
   query->total_timeout += timeout;
   query->last_timeout = timeout;
+  query->delay_count_++;
+  query->delay_time_ += timeout;
 
   auto error = query->error().move_as_error();
   query->resend();
@@ -24,6 +24,7 @@
 #include "td/utils/misc.h"
 #include "td/utils/port/thread.h"
 #include "td/utils/Slice.h"
+#include "td/utils/Time.h"
 
 #include <algorithm>
 
@@ -69,6 +70,9 @@ void NetQueryDispatcher::dispatch(NetQueryPtr net_query) {
   }
 
   if (net_query->is_ready()) {
+    if (net_query->id() != 0) {
+      stats_.on_query_finished(*net_query, dest_dc_id);
+    }
     auto callback = net_query->move_callback();
     if (callback.empty()) {
       net_query->debug("sent to td (no callback)");
@@ -86,6 +90,7 @@ void NetQueryDispatcher::dispatch(NetQueryPtr net_query) {
 
   size_t dc_pos = static_cast<size_t>(dest_dc_id.get_raw_id() - 1);
   CHECK(dc_pos < dcs_.size());
+  net_query->dispatch_timestamp_ = Time::now();
   switch (net_query->type()) {
     case NetQuery::Type::Common:
       net_query->debug(PSTRING() << "sent to main session multi proxy " << dest_dc_id);
@@ -107,7 +112,6 @@ void NetQueryDispatcher::dispatch(NetQueryPtr net_query) {
 }
 
 Status NetQueryDispatcher::wait_dc_init(DcId dc_id, bool force) {
-  // TODO: optimize
   if (!dc_id.is_exact()) {
     return Status::Error("Not exact DC");
   }
@@ -115,6 +119,10 @@ Status NetQueryDispatcher::wait_dc_init(DcId dc_id, bool force) {
   if (pos >= dcs_.size()) {
     return Status::Error("Too big DC id");
   }
+  auto &is_inited_cache = is_dc_inited_cache_.get()[pos];
+  if (is_inited_cache) {
+    return Status::OK();
+  }
   auto &dc = dcs_[pos];
 
   bool should_init = false;
@@ -176,6 +184,7 @@ Status NetQueryDispatcher::wait_dc_init(DcId dc_id, bool force) {
 #endif
     }
   }
+  is_inited_cache = true;
   return Status::OK();
 }
 
@@ -7,8 +7,10 @@
 #pragma once
 #include "td/telegram/net/AuthDataShared.h"
 #include "td/telegram/net/NetQuery.h"
+#include "td/telegram/net/NetQueryStats.h"
 
 #include "td/actor/actor.h"
+#include "td/actor/SchedulerLocalStorage.h"
 
 #include "td/utils/common.h"
 #include "td/utils/Status.h"
@@ -51,13 +53,17 @@ class NetQueryDispatcher {
     return DcId::internal(main_dc_id_.load());
   }
 
+  NetQueryStats &get_stats() {
+    return stats_;
+  }
+
  private:
   std::atomic<bool> stop_flag_{false};
   ActorOwn<NetQueryDelayer> delayer_;
   ActorOwn<DcAuthManager> dc_auth_manager_;
   struct Dc {
     std::atomic<bool> is_valid_{false};
-    std::atomic<bool> is_inited_{false};  // TODO: cache in scheduler local storage :D
+    std::atomic<bool> is_inited_{false};
 
     ActorOwn<SessionMultiProxy> main_session_;
     ActorOwn<SessionMultiProxy> download_session_;
@@ -75,6 +81,11 @@ class NetQueryDispatcher {
   ActorOwn<PublicRsaKeyWatchdog> public_rsa_key_watchdog_;
   std::mutex main_dc_id_mutex_;
 
+  // DCs, which are known to be inited by the current scheduler, so that dispatch doesn't touch shared atomics
+  SchedulerLocalStorage<std::array<bool, MAX_DC_COUNT>> is_dc_inited_cache_;
+
+  NetQueryStats stats_;
+
   Status wait_dc_init(DcId dc_id, bool force);
   bool is_dc_inited(int32 raw_dc_id);
 
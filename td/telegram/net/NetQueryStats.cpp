@@ -0,0 +1,149 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/net/NetQueryStats.h"
+
+#include "td/telegram/net/NetQuery.h"
+
+#include "td/utils/format.h"
+#include "td/utils/Time.h"
+
+#include <algorithm>
+
+namespace td {
+
+namespace {
+void add_latency(LogHistogram &histogram, double from, double to) {
+  if (from <= 0 || to < from) {
+    return;
+  }
+  histogram.add(static_cast<uint64>((to - from) * 1e6));
+}
+
+struct LatencyFormat {
+  const LogHistogram &histogram;
+};
+
+StringBuilder &operator<<(StringBuilder &sb, const LatencyFormat &latency) {
+  auto &histogram = latency.histogram;
+  auto as_time = [](uint64 microseconds) { return format::as_time(static_cast<double>(microseconds) * 1e-6); };
+  return sb << "p50=" << as_time(histogram.get_percentile(50)) << " p90=" << as_time(histogram.get_percentile(90))
+            << " p99=" << as_time(histogram.get_percentile(99)) << " max=" << as_time(histogram.get_max());
+}
+}  // namespace
+
+void NetQueryStats::on_query_finished(NetQuery &query, DcId dc_id) {
+  auto now = Time::now();
+
+  auto &shard = shards_.get();
+  std::lock_guard<std::mutex> guard(shard.mutex);
+  auto &stats = shard.stats_by_query[std::make_pair(query.tl_constructor(), dc_id.get_value())];
+  stats.tl_constructor = query.tl_constructor();
+  stats.dc_id = dc_id.get_value();
+  stats.query_count++;
+  if (query.is_error()) {
+    stats.error_count++;
+  }
+  if (query.send_count_ > 1) {
+    stats.resend_count += query.send_count_ - 1;
+  }
+  stats.delay_count += query.delay_count_;
+  stats.delay_time += query.delay_time_;
+  stats.flood_wait_count += query.flood_wait_count_;
+  stats.flood_wait_time += query.flood_wait_time_;
+
+  add_latency(stats.total_latency, query.start_timestamp_, now);
+  add_latency(stats.queue_latency, query.dispatch_timestamp_, query.send_timestamp_);
+  add_latency(stats.ack_latency, query.send_timestamp_, query.ack_timestamp_);
+  add_latency(stats.result_latency, query.send_timestamp_, query.result_timestamp_);
+
+  // the query can be resent by its callback, so it must not be accounted twice
+  query.dispatch_timestamp_ = 0;
+  query.send_timestamp_ = 0;
+  query.ack_timestamp_ = 0;
+  query.result_timestamp_ = 0;
+  query.send_count_ = 0;
+  query.delay_count_ = 0;
+  query.delay_time_ = 0;
+  query.flood_wait_count_ = 0;
+  query.flood_wait_time_ = 0;
+}
+
+void NetQueryStats::on_container_sent(size_t message_count) {
+  auto &shard = shards_.get();
+  std::lock_guard<std::mutex> guard(shard.mutex);
+  shard.container_sizes.add(message_count);
+}
+
+vector<NetQueryStats::Stats> NetQueryStats::get_stats() {
+  std::map<std::pair<int32, int32>, Stats> stats_by_query;
+  shards_.for_each([&](Shard &shard) {
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    for (auto &it : shard.stats_by_query) {
+      auto &from = it.second;
+      auto &stats = stats_by_query[it.first];
+      stats.tl_constructor = from.tl_constructor;
+      stats.dc_id = from.dc_id;
+      stats.query_count += from.query_count;
+      stats.error_count += from.error_count;
+      stats.resend_count += from.resend_count;
+      stats.delay_count += from.delay_count;
+      stats.delay_time += from.delay_time;
+      stats.flood_wait_count += from.flood_wait_count;
+      stats.flood_wait_time += from.flood_wait_time;
+      stats.total_latency.merge(from.total_latency);
+      stats.queue_latency.merge(from.queue_latency);
+      stats.ack_latency.merge(from.ack_latency);
+      stats.result_latency.merge(from.result_latency);
+    }
+  });
+
+  vector<Stats> result;
+  for (auto &it : stats_by_query) {
+    result.push_back(std::move(it.second));
+  }
+  std::sort(result.begin(), result.end(), [](const Stats &lhs, const Stats &rhs) {
+    return lhs.total_latency.get_sum() > rhs.total_latency.get_sum();
+  });
+  return result;
+}
+
+LogHistogram NetQueryStats::get_container_size_stats() {
+  LogHistogram result;
+  shards_.for_each([&](Shard &shard) {
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    result.merge(shard.container_sizes);
+  });
+  return result;
+}
+
+void NetQueryStats::clear_stats() {
+  shards_.for_each([](Shard &shard) {
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    shard.stats_by_query.clear();
+    shard.container_sizes.clear();
+  });
+}
+
+StringBuilder &operator<<(StringBuilder &sb, const NetQueryStats::Stats &stats) {
+  sb << tag("tl", format::as_hex(stats.tl_constructor)) << tag("dc", stats.dc_id) << tag("queries", stats.query_count)
+     << tag("errors", stats.error_count) << tag("resends", stats.resend_count) << tag("delays", stats.delay_count)
+     << tag("delay_time", format::as_time(stats.delay_time)) << tag("flood_waits", stats.flood_wait_count)
+     << tag("flood_wait_time", format::as_time(stats.flood_wait_time))
+     << tag("total", LatencyFormat{stats.total_latency});
+  if (stats.queue_latency.get_count() != 0) {
+    sb << tag("queue", LatencyFormat{stats.queue_latency});
+  }
+  if (stats.ack_latency.get_count() != 0) {
+    sb << tag("ack", LatencyFormat{stats.ack_latency});
+  }
+  if (stats.result_latency.get_count() != 0) {
+    sb << tag("result", LatencyFormat{stats.result_latency});
+  }
+  return sb;
+}
+
+}  // namespace td
@@ -0,0 +1,71 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/telegram/net/DcId.h"
+
+#include "td/actor/SchedulerLocalStorage.h"
+
+#include "td/utils/common.h"
+#include "td/utils/LogHistogram.h"
+#include "td/utils/StringBuilder.h"
+
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace td {
+
+class NetQuery;
+
+// statistics of network queries of one client, aggregated by query constructor and datacenter;
+// every scheduler updates its own part of the statistics, which are merged only when requested
+class NetQueryStats {
+ public:
+  struct Stats {
+    int32 tl_constructor = 0;
+    int32 dc_id = 0;
+    int64 query_count = 0;
+    int64 error_count = 0;
+    int64 resend_count = 0;  // number of repeated sends to a connection
+    int64 delay_count = 0;   // number of delays by NetQueryDelayer, including flood waits
+    double delay_time = 0;
+    int64 flood_wait_count = 0;
+    double flood_wait_time = 0;
+
+    // latencies in microseconds; all except total latency are measured for the last attempt
+    LogHistogram total_latency;   // from creation of the query to receiving of the final result
+    LogHistogram queue_latency;   // from dispatching to a session to sending to a connection
+    LogHistogram ack_latency;     // from sending to a connection to acknowledgement by the server
+    LogHistogram result_latency;  // from sending to a connection to receiving of the result
+  };
+
+  // must be called once for every query result before it is returned to the callback; resets counters of the query
+  void on_query_finished(NetQuery &query, DcId dc_id);
+
+  void on_container_sent(size_t message_count);
+
+  // returns statistics for all kinds of queries, sorted by total latency
+  vector<Stats> get_stats();
+
+  // returns histogram of the number of messages in sent containers
+  LogHistogram get_container_size_stats();
+
+  void clear_stats();
+
+ private:
+  struct Shard {
+    std::mutex mutex;  // is contended only while the statistics are merged
+    std::map<std::pair<int32, int32>, Stats> stats_by_query;
+    LogHistogram container_sizes;
+  };
+  SchedulerLocalStorage<Shard> shards_;
+};
+
+StringBuilder &operator<<(StringBuilder &sb, const NetQueryStats::Stats &stats);
+
+}  // namespace td
@@ -6,6 +6,8 @@
 //
 #include "td/telegram/net/PublicRsaKeyShared.h"
 
+#include "td/actor/actor.h"
+
 #include "td/utils/logging.h"
 #include "td/utils/Slice.h"
 #include "td/utils/Status.h"
@@ -14,7 +16,9 @@
 
 namespace td {
 
-PublicRsaKeyShared::PublicRsaKeyShared(DcId dc_id) : dc_id_(dc_id) {
+PublicRsaKeyShared::PublicRsaKeyShared(DcId dc_id)
+    : dc_id_(dc_id)
+    , options_(static_cast<size_t>(Scheduler::instance()->sched_count()), make_unique<std::vector<RsaOption>>()) {
   if (!dc_id_.is_empty()) {
     return;
   }
@@ -86,20 +90,31 @@ PublicRsaKeyShared::PublicRsaKeyShared(DcId dc_id) : dc_id_(dc_id) {
       "-----END RSA PUBLIC KEY-----\n");
 }
 
+size_t PublicRsaKeyShared::get_thread_slot() {
+  return static_cast<size_t>(Scheduler::instance()->sched_id());
+}
+
 void PublicRsaKeyShared::add_rsa(RSA rsa) {
   auto lock = rw_mutex_.lock_write();
   auto fingerprint = rsa.get_fingerprint();
-  auto *has_rsa = get_rsa_locked(fingerprint);
-  if (has_rsa) {
-    return;
+  std::vector<RsaOption> options;
+  {
+    auto old_options = options_.get(get_thread_slot());
+    if (find_rsa(*old_options, fingerprint) != nullptr) {
+      return;
+    }
+    for (auto &option : *old_options) {
+      options.push_back(RsaOption{option.fingerprint, option.rsa.clone()});
+    }
   }
-  options_.push_back(RsaOption{fingerprint, std::move(rsa)});
+  options.push_back(RsaOption{fingerprint, std::move(rsa)});
+  set_options(std::move(options));
 }
 
 Result<std::pair<RSA, int64>> PublicRsaKeyShared::get_rsa(const vector<int64> &fingerprints) {
-  auto lock = rw_mutex_.lock_read();
+  auto options = options_.get(get_thread_slot());
   for (auto fingerprint : fingerprints) {
-    auto *rsa = get_rsa_locked(fingerprint);
+    auto *rsa = find_rsa(*options, fingerprint);
     if (rsa) {
       return std::make_pair(rsa->clone(), fingerprint);
     }
@@ -112,12 +127,11 @@ void PublicRsaKeyShared::drop_keys() {
     return;
   }
   auto lock = rw_mutex_.lock_write();
-  options_.clear();
+  set_options(std::vector<RsaOption>());
 }
 
 bool PublicRsaKeyShared::has_keys() {
-  auto lock = rw_mutex_.lock_read();
-  return !options_.empty();
+  return !options_.get(get_thread_slot())->empty();
 }
 
 void PublicRsaKeyShared::add_listener(std::unique_ptr<Listener> listener) {
@@ -127,15 +141,19 @@ void PublicRsaKeyShared::add_listener(std::unique_ptr<Listener> listener) {
   }
 }
 
-RSA *PublicRsaKeyShared::get_rsa_locked(int64 fingerprint) {
-  auto it = std::find_if(options_.begin(), options_.end(),
+const RSA *PublicRsaKeyShared::find_rsa(const std::vector<RsaOption> &options, int64 fingerprint) {
+  auto it = std::find_if(options.begin(), options.end(),
                          [&](const auto &value) { return value.fingerprint == fingerprint; });
-  if (it == options_.end()) {
+  if (it == options.end()) {
     return nullptr;
   }
   return &it->rsa;
 }
 
+void PublicRsaKeyShared::set_options(std::vector<RsaOption> options) {
+  options_.set(get_thread_slot(), make_unique<std::vector<RsaOption>>(std::move(options)));
+}
+
 void PublicRsaKeyShared::notify() {
   auto lock = rw_mutex_.lock_read();
   auto it = remove_if(listeners_.begin(), listeners_.end(), [&](auto &listener) { return !listener->notify(); });
@@ -12,6 +12,7 @@
 
 #include "td/utils/common.h"
 #include "td/utils/port/RwMutex.h"
+#include "td/utils/SharedSnapshot.h"
 #include "td/utils/Status.h"
 
 #include <utility>
@@ -50,11 +51,17 @@ class PublicRsaKeyShared : public PublicRsaKeyInterface {
     int64 fingerprint;
     RSA rsa;
   };
-  std::vector<RsaOption> options_;
+  // keys are read by handshakes on all schedulers, so readers use a lock-free snapshot and
+  // rw_mutex_ only serializes writers and protects listeners_
+  SharedSnapshot<std::vector<RsaOption>> options_;
   std::vector<std::unique_ptr<Listener>> listeners_;
   RwMutex rw_mutex_;
 
-  RSA *get_rsa_locked(int64 fingerprint);
+  static size_t get_thread_slot();
+
+  static const RSA *find_rsa(const std::vector<RsaOption> &options, int64 fingerprint);
+
+  void set_options(std::vector<RsaOption> options);
 
   void notify();
 };
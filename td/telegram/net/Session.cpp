@@ -484,6 +484,7 @@ void Session::on_container_sent(uint64 container_id, vector<uint64> msg_ids) {
     it->second.container_id = container_id;
     return false;
   });
+  G()->net_query_dispatcher().get_stats().on_container_sent(msg_ids.size());
   msg_ids.erase(erase_from, msg_ids.end());
   if (msg_ids.empty()) {
     return;
@@ -516,6 +517,9 @@ void Session::on_message_ack_impl_inner(uint64 id, int32 type, bool in_container
   }
   VLOG(net_query) << "Ack " << tag("msg_id", id) << it->second.query;
   it->second.ack = true;
+  if (it->second.query->ack_timestamp_ == 0) {
+    it->second.query->ack_timestamp_ = Time::now();
+  }
   it->second.query->debug_ack |= type;
   it->second.query->quick_ack_promise_.set_value(Unit());
   if (!in_container) {
@@ -614,6 +618,7 @@ Status Session::on_message_result_ok(uint64 id, BufferSlice packet, size_t origi
 
   cleanup_container(id, query_ptr);
   mark_as_known(id, query_ptr);
+  query_ptr->query->result_timestamp_ = Time::now();
   query_ptr->query->on_net_read(original_size);
   query_ptr->query->set_ok(std::move(packet));
   query_ptr->query->set_message_id(0);
@@ -659,6 +664,7 @@ void Session::on_message_result_error(uint64 id, int error_code, BufferSlice mes
 
   cleanup_container(id, query_ptr);
   mark_as_known(id, query_ptr);
+  query_ptr->query->result_timestamp_ = Time::now();
   query_ptr->query->set_error(Status::Error(error_code, message.as_slice()),
                               current_info_->connection->get_name().str());
   query_ptr->query->set_message_id(0);
@@ -813,6 +819,10 @@ void Session::connection_send_query(ConnectionInfo *info, NetQueryPtr &&net_quer
   VLOG(net_query) << "send query to connection " << net_query << " [msg_id:" << format::as_hex(message_id) << "]"
                   << tag("invoke_after", format::as_hex(invoke_after_id));
   net_query->set_message_id(message_id);
+  net_query->send_timestamp_ = Time::now();
+  net_query->ack_timestamp_ = 0;
+  net_query->result_timestamp_ = 0;
+  net_query->send_count_++;
   net_query->cancel_slot_.clear_event();
   CHECK(sent_queries_.find(message_id) == sent_queries_.end()) << message_id;
   net_query->debug_unknown = false;
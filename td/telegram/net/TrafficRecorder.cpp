@@ -0,0 +1,126 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/net/TrafficRecorder.h"
+
+#include "td/utils/filesystem.h"
+#include "td/utils/logging.h"
+#include "td/utils/misc.h"
+#include "td/utils/port/Clocks.h"
+#include "td/utils/Time.h"
+#include "td/utils/tl_parsers.h"
+#include "td/utils/tl_storers.h"
+
+#include <cstring>
+
+namespace td {
+
+static constexpr int32 TRAFFIC_RECORDS_MAGIC = 0x46525454;
+
+static size_t get_padded_size(size_t size) {
+  return (size + 3) & ~static_cast<size_t>(3);
+}
+
+Result<unique_ptr<TrafficRecorder>> TrafficRecorder::open(CSlice path) {
+  TRY_RESULT(fd, FileFd::open(path, FileFd::Write | FileFd::Create | FileFd::Append));
+  auto recorder = unique_ptr<TrafficRecorder>(new TrafficRecorder(std::move(fd), path.str()));
+  if (recorder->fd_.get_size() == 0) {
+    BufferSlice magic(sizeof(int32));
+    TlStorerUnsafe storer(magic.as_slice().begin());
+    storer.store_int(TRAFFIC_RECORDS_MAGIC);
+    recorder->buffer_.append(magic.as_slice().begin(), magic.size());
+  }
+  return std::move(recorder);
+}
+
+TrafficRecorder::TrafficRecorder(FileFd fd, string path) : fd_(std::move(fd)), path_(std::move(path)) {
+}
+
+TrafficRecorder::~TrafficRecorder() {
+  flush();
+  fd_.close();
+}
+
+void TrafficRecorder::add_update(Slice data) {
+  add_record(TrafficRecord::Type::Update, 0, data);
+}
+
+void TrafficRecorder::add_result(int32 query_tl_constructor, Slice data) {
+  add_record(TrafficRecord::Type::Result, query_tl_constructor, data);
+}
+
+void TrafficRecorder::add_record(TrafficRecord::Type type, int32 query_tl_constructor, Slice data) {
+  auto padded_size = get_padded_size(data.size());
+  BufferSlice record(3 * sizeof(int32) + sizeof(double) + padded_size);
+  std::memset(record.as_slice().begin(), 0, record.size());
+  TlStorerUnsafe storer(record.as_slice().begin());
+  storer.store_int(static_cast<int32>(type));
+  storer.store_int(query_tl_constructor);
+  storer.store_binary(Clocks::system());
+  storer.store_int(narrow_cast<int32>(data.size()));
+  storer.store_slice(data);
+  buffer_.append(record.as_slice().begin(), record.size());
+
+  if (buffer_.size() >= MAX_BUFFER_SIZE) {
+    flush();
+  }
+}
+
+void TrafficRecorder::flush() {
+  if (buffer_.empty()) {
+    return;
+  }
+  auto now = Time::now();
+  if (now >= next_warning_time_) {
+    LOG(WARNING) << "Traffic dump is enabled: received updates and query results are written to \"" << path_ << '"';
+    next_warning_time_ = now + WARNING_PERIOD;
+  }
+
+  Slice data = buffer_;
+  while (!data.empty()) {
+    auto r_size = fd_.write(data);
+    if (r_size.is_error()) {
+      LOG(ERROR) << "Failed to write traffic records: " << r_size.error();
+      break;
+    }
+    data.remove_prefix(r_size.ok());
+  }
+  buffer_.clear();
+}
+
+Result<vector<TrafficRecord>> read_traffic_records(CSlice path) {
+  TRY_RESULT(file, read_file(path));
+  TlBufferParser parser(&file);
+  if (parser.fetch_int() != TRAFFIC_RECORDS_MAGIC) {
+    return Status::Error("Wrong file format");
+  }
+
+  vector<TrafficRecord> records;
+  while (parser.get_left_len() != 0 && !parser.get_error()) {
+    TrafficRecord record;
+    auto type = parser.fetch_int();
+    if (type != static_cast<int32>(TrafficRecord::Type::Update) &&
+        type != static_cast<int32>(TrafficRecord::Type::Result)) {
+      return Status::Error(PSLICE() << "Wrong record type " << type);
+    }
+    record.type = static_cast<TrafficRecord::Type>(type);
+    record.query_tl_constructor = parser.fetch_int();
+    record.date = parser.fetch_double();
+    auto size = parser.fetch_int();
+    if (size < 0) {
+      return Status::Error("Wrong record size");
+    }
+    record.data = parser.fetch_string_raw<BufferSlice>(get_padded_size(static_cast<size_t>(size)));
+    record.data.truncate(static_cast<size_t>(size));
+    records.push_back(std::move(record));
+  }
+  if (parser.get_error()) {
+    return Status::Error(PSLICE() << "Failed to parse traffic records: " << parser.get_error());
+  }
+  return std::move(records);
+}
+
+}  // namespace td
@@ -0,0 +1,59 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/buffer.h"
+#include "td/utils/common.h"
+#include "td/utils/port/FileFd.h"
+#include "td/utils/Slice.h"
+#include "td/utils/Status.h"
+
+namespace td {
+
+struct TrafficRecord {
+  enum class Type : int32 { Update, Result };
+  Type type = Type::Update;
+  int32 query_tl_constructor = 0;  // constructor of the query for results
+  double date = 0;                 // system time of receiving
+  BufferSlice data;                // serialized telegram_api object
+};
+
+// Appends received telegram_api updates and query results to a file, which can be parsed offline;
+// a warning is logged periodically while the recorder exists, because the file contains private data
+class TrafficRecorder {
+ public:
+  static Result<unique_ptr<TrafficRecorder>> open(CSlice path) TD_WARN_UNUSED_RESULT;
+
+  TrafficRecorder(const TrafficRecorder &other) = delete;
+  TrafficRecorder &operator=(const TrafficRecorder &other) = delete;
+  TrafficRecorder(TrafficRecorder &&other) = delete;
+  TrafficRecorder &operator=(TrafficRecorder &&other) = delete;
+  ~TrafficRecorder();
+
+  void add_update(Slice data);
+
+  void add_result(int32 query_tl_constructor, Slice data);
+
+  void flush();
+
+ private:
+  static constexpr size_t MAX_BUFFER_SIZE = 1 << 16;
+  static constexpr double WARNING_PERIOD = 60.0;
+
+  TrafficRecorder(FileFd fd, string path);
+
+  FileFd fd_;
+  string path_;
+  string buffer_;
+  double next_warning_time_ = 0;
+
+  void add_record(TrafficRecord::Type type, int32 query_tl_constructor, Slice data);
+};
+
+Result<vector<TrafficRecord>> read_traffic_records(CSlice path) TD_WARN_UNUSED_RESULT;
+
+}  // namespace td
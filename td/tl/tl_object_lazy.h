@@ -0,0 +1,79 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/buffer.h"
+#include "td/utils/Slice.h"
+#include "td/utils/tl_parsers.h"
+
+#include <utility>
+
+namespace td {
+
+// Keeps a serialized TL-object, which is parsed on the first access.
+// Func is a TlFetch* class, which is used to parse the object, for example TlFetchObject<telegram_api::Message>.
+template <class Func>
+class TlLazyObject {
+ public:
+  using ValueType = decltype(Func::parse(std::declval<TlBufferParser &>()));
+
+  TlLazyObject() = default;
+
+  explicit TlLazyObject(BufferSlice data) : data_(std::move(data)) {
+  }
+
+  // skips the object in the parser, remembering its serialization
+  static TlLazyObject fetch(TlBufferParser &p) {
+    auto begin_offset = p.get_offset();
+    Func::skip(p);
+    if (p.get_error() != nullptr) {
+      return TlLazyObject();
+    }
+    return TlLazyObject(p.get_parsed_since(begin_offset));
+  }
+
+  Slice as_slice() const {
+    return data_.as_slice();
+  }
+
+  bool is_parsed() const {
+    return is_parsed_;
+  }
+
+  // returns default value if the object can't be parsed
+  ValueType &get() {
+    if (!is_parsed_) {
+      is_parsed_ = true;
+      TlBufferParser parser(&data_);
+      value_ = Func::parse(parser);
+      parser.fetch_end();
+      if (parser.get_error() != nullptr) {
+        value_ = ValueType();
+      }
+    }
+    return value_;
+  }
+
+ private:
+  BufferSlice data_;
+  ValueType value_{};
+  bool is_parsed_ = false;
+};
+
+template <class Func>
+class TlFetchLazy {
+ public:
+  static TlLazyObject<Func> parse(TlBufferParser &p) {
+    return TlLazyObject<Func>::fetch(p);
+  }
+
+  static void skip(TlBufferParser &p) {
+    Func::skip(p);
+  }
+};
+
+}  // namespace td
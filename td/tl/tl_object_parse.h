@@ -28,6 +28,15 @@ class TlFetchBoxed {
     }
     return Func::parse(p);
   }
+
+  template <class ParserT>
+  static void skip(ParserT &p) {
+    if (p.fetch_int() != constructor_id) {
+      p.set_error("Wrong constructor found");
+      return;
+    }
+    Func::skip(p);
+  }
 };
 
 class TlFetchTrue {
@@ -36,6 +45,10 @@ class TlFetchTrue {
   static bool parse(ParserT &p) {
     return true;
   }
+
+  template <class ParserT>
+  static void skip(ParserT &p) {
+  }
 };
 
 class TlFetchBool {
@@ -54,6 +67,11 @@ class TlFetchBool {
     }
     return false;
   }
+
+  template <class ParserT>
+  static void skip(ParserT &p) {
+    parse(p);
+  }
 };
 
 class TlFetchInt {
@@ -62,6 +80,11 @@ class TlFetchInt {
   static std::int32_t parse(ParserT &p) {
     return p.fetch_int();
   }
+
+  template <class ParserT>
+  static void skip(ParserT &p) {
+    p.fetch_int();
+  }
 };
 
 class TlFetchLong {
@@ -70,6 +93,11 @@ class TlFetchLong {
   static std::int64_t parse(ParserT &p) {
     return p.fetch_long();
   }
+
+  template <class ParserT>
+  static void skip(ParserT &p) {
+    p.fetch_long();
+  }
 };
 
 class TlFetchDouble {
@@ -78,6 +106,11 @@ class TlFetchDouble {
   static double parse(ParserT &p) {
     return p.fetch_double();
   }
+
+  template <class ParserT>
+  static void skip(ParserT &p) {
+    p.fetch_double();
+  }
 };
 
 class TlFetchInt128 {
@@ -86,6 +119,11 @@ class TlFetchInt128 {
   static UInt128 parse(ParserT &p) {
     return p.template fetch_binary<UInt128>();
   }
+
+  template <class ParserT>
+  static void skip(ParserT &p) {
+    p.template fetch_binary<UInt128>();
+  }
 };
 
 class TlFetchInt256 {
@@ -94,6 +132,11 @@ class TlFetchInt256 {
   static UInt256 parse(ParserT &p) {
     return p.template fetch_binary<UInt256>();
   }
+
+  template <class ParserT>
+  static void skip(ParserT &p) {
+    p.template fetch_binary<UInt256>();
+  }
 };
 
 template <class T>
@@ -103,6 +146,11 @@ class TlFetchString {
   static T parse(ParserT &p) {
     return p.template fetch_string<T>();
   }
+
+  template <class ParserT>
+  static void skip(ParserT &p) {
+    p.skip_string();
+  }
 };
 
 template <class T>
@@ -112,6 +160,11 @@ class TlFetchBytes {
   static T parse(ParserT &p) {
     return p.template fetch_string<T>();
   }
+
+  template <class ParserT>
+  static void skip(ParserT &p) {
+    p.skip_string();
+  }
 };
 
 template <class Func>
@@ -131,6 +184,18 @@ class TlFetchVector {
     }
     return v;
   }
+
+  template <class ParserT>
+  static void skip(ParserT &p) {
+    const std::uint32_t multiplicity = p.fetch_int();
+    if (p.get_left_len() < multiplicity) {
+      p.set_error("Wrong vector length");
+    } else {
+      for (std::uint32_t i = 0; i < multiplicity; i++) {
+        Func::skip(p);
+      }
+    }
+  }
 };
 
 template <class T>
@@ -140,6 +205,11 @@ class TlFetchObject {
   static tl_object_ptr<T> parse(ParserT &p) {
     return T::fetch(p);
   }
+
+  template <class ParserT>
+  static void skip(ParserT &p) {
+    T::skip(p);
+  }
 };
 
 }  // namespace td
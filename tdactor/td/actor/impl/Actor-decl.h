@@ -64,6 +64,8 @@ class Actor : public ObserverBase {
 
   // proxy to scheduler
   void yield();
+  // returns true, if the actor has exhausted its time slice and must continue the work in a later event
+  bool need_yield() const;
   void stop();
   void do_stop();
   bool has_timeout() const;
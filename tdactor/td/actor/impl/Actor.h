@@ -43,6 +43,9 @@ inline void Actor::notify() {
 inline void Actor::yield() {
   Scheduler::instance()->yield_actor(this);
 }
+inline bool Actor::need_yield() const {
+  return Scheduler::instance()->need_yield();
+}
 inline void Actor::stop() {
   Scheduler::instance()->stop_actor(this);
 }
@@ -11,6 +11,7 @@
 #include "td/actor/impl/ActorInfo.h"
 #include "td/actor/impl/Scheduler.h"
 
+#include "td/utils/buffer.h"
 #include "td/utils/MpscPollableQueue.h"
 #include "td/utils/port/thread_local.h"
 
@@ -36,10 +37,31 @@ void ConcurrentScheduler::init(int32 threads_n) {
     sched = make_unique<Scheduler>();
     sched->init(i, outbound, static_cast<Scheduler::Callback *>(this));
   }
+  thread_options_.clear();
+  thread_options_.resize(threads_n);
 
   state_ = State::Start;
 }
 
+void ConcurrentScheduler::set_thread_options(int32 sched_id, ThreadOptions options) {
+  CHECK(state_ == State::Start);
+  if (0 <= sched_id && sched_id < static_cast<int32>(thread_options_.size())) {
+    thread_options_[sched_id] = std::move(options);
+  }
+}
+
+void ConcurrentScheduler::apply_thread_options(int32 sched_id, const ThreadOptions &options) {
+  if (options.cpus.empty() && options.nice == 0 && options.realtime_priority == 0) {
+    return;
+  }
+  auto status = set_current_thread_options(options);
+  if (status.is_error()) {
+    LOG(ERROR) << "Failed to set options of scheduler " << sched_id << " thread: " << status;
+  }
+  // memory of the thread-local buffer chunk allocated from now on will be placed by the OS on the local NUMA node
+  BufferAllocator::clear_thread_local();
+}
+
 void ConcurrentScheduler::test_one_thread_run() {
   do {
     for (auto &sched : schedulers_) {
@@ -57,6 +79,7 @@ void ConcurrentScheduler::start() {
     auto &sched = schedulers_[i];
     threads_.push_back(td::thread([&, tid = i]() {
       set_thread_id(static_cast<int32>(tid));
+      apply_thread_options(static_cast<int32>(tid), thread_options_[tid]);
       while (!is_finished()) {
         sched->run(10);
       }
@@ -70,6 +93,10 @@ bool ConcurrentScheduler::run_main(double timeout) {
   CHECK(state_ == State::Run);
   // run main scheduler in same thread
   auto &main_sched = schedulers_[0];
+  if (!is_main_thread_options_applied_) {
+    is_main_thread_options_applied_ = true;
+    apply_thread_options(0, thread_options_[0]);
+  }
   if (!is_finished()) {
     main_sched->run(timeout);
   }
@@ -88,6 +115,7 @@ void ConcurrentScheduler::finish() {
   threads_.clear();
 #endif
   schedulers_.clear();
+  is_main_thread_options_applied_ = false;
   for (auto &f : at_finish_) {
     f();
   }
@@ -11,6 +11,7 @@
 #include "td/utils/common.h"
 #include "td/utils/logging.h"
 #include "td/utils/port/thread.h"
+#include "td/utils/port/thread_options.h"
 #include "td/utils/Slice.h"
 
 #include <atomic>
@@ -24,6 +25,9 @@ class ConcurrentScheduler : private Scheduler::Callback {
  public:
   void init(int32 threads_n);
 
+  // must be called after init and before start; options of the scheduler 0 are applied to the thread calling run_main
+  void set_thread_options(int32 sched_id, ThreadOptions options);
+
   void finish_async() {
     schedulers_[0]->finish();
   }
@@ -70,6 +74,8 @@ class ConcurrentScheduler : private Scheduler::Callback {
   enum class State { Start, Run };
   State state_;
   std::vector<unique_ptr<Scheduler>> schedulers_;
+  std::vector<ThreadOptions> thread_options_;
+  bool is_main_thread_options_applied_ = false;
   std::atomic<bool> is_finished_;
   std::mutex at_finish_mutex_;
   std::vector<std::function<void()>> at_finish_;
@@ -77,6 +83,8 @@ class ConcurrentScheduler : private Scheduler::Callback {
   std::vector<thread> threads_;
 #endif
 
+  static void apply_thread_options(int32 sched_id, const ThreadOptions &options);
+
   void on_finish() override {
     is_finished_.store(true, std::memory_order_relaxed);
     for (auto &it : schedulers_) {
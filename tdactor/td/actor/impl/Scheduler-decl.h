@@ -132,6 +132,18 @@ class Scheduler {
   void run(double timeout);
   void run_no_guard(double timeout);
 
+  // Each run of an actor is expected to fit in the time slice. Actors doing long computations should check
+  // need_yield() and continue their work in a later event, so other actors and network I/O aren't delayed.
+  struct LongEventStats {
+    uint64 count = 0;
+    double total_duration = 0;
+    double max_duration = 0;
+  };
+  void set_time_slice(double time_slice);
+  double get_time_slice() const;
+  bool need_yield();
+  const LongEventStats &get_long_event_stats() const;
+
   void wakeup();
 
   static Scheduler *instance();
@@ -185,6 +197,8 @@ class Scheduler {
 
   void inc_wait_generation();
 
+  void on_long_event(ActorInfo *actor_info, double duration);
+
   double run_timeout();
   void run_mailbox();
   double run_events();
@@ -217,6 +231,12 @@ class Scheduler {
   bool has_guard_ = false;
   bool close_flag_ = false;
 
+  static constexpr double DEFAULT_TIME_SLICE = 0.05;
+  double time_slice_ = DEFAULT_TIME_SLICE;
+  double event_started_at_ = 0;
+  bool need_poll_ = false;
+  LongEventStats long_event_stats_;
+
   uint32 wait_generation_ = 0;
   int32 sched_id_;
   int32 sched_n_;
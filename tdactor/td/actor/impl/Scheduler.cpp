@@ -26,6 +26,8 @@
 
 namespace td {
 
+constexpr double Scheduler::DEFAULT_TIME_SLICE;
+
 TD_THREAD_LOCAL Scheduler *Scheduler::scheduler_;   // static zero-initialized
 TD_THREAD_LOCAL ActorContext *Scheduler::context_;  // static zero-initialized
 
@@ -119,10 +121,18 @@ EventGuard::EventGuard(Scheduler *scheduler, ActorInfo *actor_info) : scheduler_
   save_log_tag2_ = actor_info->get_name().c_str();
 #endif
   swap_context(actor_info);
+
+  save_event_started_at_ = scheduler_->event_started_at_;
+  scheduler_->event_started_at_ = Time::now();
 }
 
 EventGuard::~EventGuard() {
   auto info = event_context_.actor_info;
+  auto duration = Time::now() - scheduler_->event_started_at_;
+  scheduler_->event_started_at_ = save_event_started_at_;
+  if (duration > scheduler_->time_slice_) {
+    scheduler_->on_long_event(info, duration);
+  }
   auto node = info->get_list_node();
   node->remove();
   if (info->mailbox_.empty()) {
@@ -284,6 +294,16 @@ void Scheduler::do_event(ActorInfo *actor_info, Event &&event) {
   // can't clear event here. It may be already destroyed during destory_actor
 }
 
+void Scheduler::on_long_event(ActorInfo *actor_info, double duration) {
+  long_event_stats_.count++;
+  long_event_stats_.total_duration += duration;
+  if (duration > long_event_stats_.max_duration) {
+    long_event_stats_.max_duration = duration;
+  }
+  LOG(INFO) << "Event of " << *actor_info << " took " << format::as_time(duration) << ", exceeding time slice of "
+            << format::as_time(time_slice_);
+}
+
 void Scheduler::register_migrated_actor(ActorInfo *actor_info) {
   VLOG(actor) << "Register migrated actor: " << tag("name", *actor_info) << tag("ptr", actor_info)
               << tag("actor_count", actor_count_);
@@ -489,6 +509,10 @@ void Scheduler::run_no_guard(double timeout) {
   if (yield_flag_) {
     return;
   }
+  if (!ready_actors_list_.empty()) {
+    // some actors have exhausted their time slices; handle I/O events without waiting and continue to run them
+    timeout = 0;
+  }
   run_poll(timeout);
   run_events();
 }
@@ -16,6 +16,7 @@
 #include "td/utils/ObjectPool.h"
 #include "td/utils/port/Fd.h"
 #include "td/utils/Slice.h"
+#include "td/utils/Time.h"
 
 #include <atomic>
 #include <memory>
@@ -50,6 +51,7 @@ class EventGuard {
   Scheduler *scheduler_;
   ActorContext *save_context_;
   const char *save_log_tag2_;
+  double save_event_started_at_;
 
   void swap_context(ActorInfo *info);
 };
@@ -336,14 +338,36 @@ inline void Scheduler::wakeup() {
 #endif
 }
 
+inline void Scheduler::set_time_slice(double time_slice) {
+  time_slice_ = time_slice;
+}
+
+inline double Scheduler::get_time_slice() const {
+  return time_slice_;
+}
+
+inline bool Scheduler::need_yield() {
+  if (Time::now() < event_started_at_ + time_slice_) {
+    return false;
+  }
+  // poll file descriptors before running the yielded actor again
+  need_poll_ = true;
+  return true;
+}
+
+inline const Scheduler::LongEventStats &Scheduler::get_long_event_stats() const {
+  return long_event_stats_;
+}
+
 inline double Scheduler::run_events() {
   double res;
   VLOG(actor) << "run events " << sched_id_ << " " << tag("pending", pending_events_.size())
               << tag("actors", actor_count_);
+  need_poll_ = false;
   do {
     run_mailbox();
     res = run_timeout();
-  } while (!ready_actors_list_.empty());
+  } while (!ready_actors_list_.empty() && !need_poll_);
   return res;
 }
 
@@ -7,5 +7,9 @@
 #include "td/actor/impl2/Scheduler.h"
 
 namespace td {
-namespace actor2 {}
+namespace actor2 {
+#if !TD_THREAD_UNSUPPORTED
+constexpr size_t Scheduler::CPU_QUEUE_CAPACITY;
+#endif
+}  // namespace actor2
 }  // namespace td
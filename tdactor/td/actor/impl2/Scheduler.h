@@ -9,13 +9,13 @@
 #include "td/actor/impl2/ActorLocker.h"
 #include "td/actor/impl2/SchedulerId.h"
 
+#include "td/utils/BoundedMpmcQueue.h"
 #include "td/utils/Closure.h"
 #include "td/utils/common.h"
 #include "td/utils/format.h"
 #include "td/utils/Heap.h"
 #include "td/utils/List.h"
 #include "td/utils/logging.h"
-#include "td/utils/MpmcQueue.h"
 #include "td/utils/MpmcWaiter.h"
 #include "td/utils/MpscLinkQueue.h"
 #include "td/utils/MpscPollableQueue.h"
@@ -731,7 +731,7 @@ struct WorkerInfo {
 struct SchedulerInfo {
   SchedulerId id;
   // will be read by all workers is any thread
-  std::unique_ptr<MpmcQueue<SchedulerMessage>> cpu_queue;
+  std::unique_ptr<BoundedMpmcQueue<SchedulerMessage>> cpu_queue;
   std::unique_ptr<MpmcWaiter> cpu_queue_waiter;
   // only scheduler itself may read from io_queue_
   std::unique_ptr<MpscPollableQueue<SchedulerMessage>> io_queue;
@@ -788,7 +788,7 @@ class Scheduler {
     info_->id = id;
     if (cpu_threads_count != 0) {
       info_->cpu_threads_count = cpu_threads_count;
-      info_->cpu_queue = std::make_unique<MpmcQueue<SchedulerMessage>>(1024, max_thread_count());
+      info_->cpu_queue = std::make_unique<BoundedMpmcQueue<SchedulerMessage>>(CPU_QUEUE_CAPACITY);
       info_->cpu_queue_waiter = std::make_unique<MpmcWaiter>();
     }
     info_->io_queue = std::make_unique<MpscPollableQueue<SchedulerMessage>>();
@@ -857,6 +857,8 @@ class Scheduler {
   }
 
  private:
+  static constexpr size_t CPU_QUEUE_CAPACITY = 1 << 16;
+
   std::shared_ptr<SchedulerGroupInfo> scheduler_group_info_;
   SchedulerInfo *info_;
   std::vector<td::thread> cpu_threads_;
@@ -881,12 +883,14 @@ class Scheduler {
         scheduler_id = scheduler()->id;
       }
       auto &info = scheduler_group()->schedulers.at(scheduler_id.value());
-      if (need_poll) {
-        info.io_queue->writer_put(std::move(actor_info_ptr));
-      } else {
-        info.cpu_queue->push(std::move(actor_info_ptr), get_thread_id());
-        info.cpu_queue_waiter->notify();
+      if (!need_poll) {
+        if (info.cpu_queue->try_push(actor_info_ptr, get_thread_id())) {
+          info.cpu_queue_waiter->notify();
+          return;
+        }
+        // the queue is full; the io worker will run the actor, because cpu workers may be waiting for us
       }
+      info.io_queue->writer_put(std::move(actor_info_ptr));
     }
 
     ActorInfoCreator &get_actor_info_creator() override {
@@ -981,7 +985,7 @@ class Scheduler {
 
   class CpuWorker {
    public:
-    CpuWorker(MpmcQueue<SchedulerMessage> &queue, MpmcWaiter &waiter) : queue_(queue), waiter_(waiter) {
+    CpuWorker(BoundedMpmcQueue<SchedulerMessage> &queue, MpmcWaiter &waiter) : queue_(queue), waiter_(waiter) {
     }
     void run() {
       auto thread_id = get_thread_id();
@@ -1003,7 +1007,7 @@ class Scheduler {
     }
 
    private:
-    MpmcQueue<SchedulerMessage> &queue_;
+    BoundedMpmcQueue<SchedulerMessage> &queue_;
     MpmcWaiter &waiter_;
   };
 
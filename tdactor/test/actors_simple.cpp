@@ -18,6 +18,7 @@
 #include "td/utils/Slice.h"
 #include "td/utils/Status.h"
 #include "td/utils/StringBuilder.h"
+#include "td/utils/Time.h"
 
 #include <tuple>
 
@@ -620,3 +621,63 @@ TEST(Actors, always_wait_for_mailbox) {
   }
   scheduler.finish();
 }
+
+class TimeSliceWorker : public Actor {
+ public:
+  explicit TimeSliceWorker(const bool *is_timer_fired) : is_timer_fired_(is_timer_fired) {
+  }
+
+  void run(int step) {
+    for (; step < STEP_COUNT; step++) {
+      if (need_yield()) {
+        run_count_++;
+        return send_closure_later(actor_id(this), &TimeSliceWorker::run, step);
+      }
+      auto end_time = Time::now() + 0.0005;
+      while (Time::now() < end_time) {
+      }
+    }
+    ASSERT_TRUE(run_count_ > 1);
+    ASSERT_TRUE(*is_timer_fired_);
+
+    auto long_event_count = Scheduler::instance()->get_long_event_stats().count;
+    auto end_time = Time::now() + 0.005;
+    while (Time::now() < end_time) {
+    }
+    send_closure_later(actor_id(this), &TimeSliceWorker::check_long_event_count, long_event_count);
+  }
+
+  void check_long_event_count(uint64 old_long_event_count) {
+    ASSERT_TRUE(Scheduler::instance()->get_long_event_stats().count > old_long_event_count);
+    Scheduler::instance()->finish();
+    stop();
+  }
+
+ private:
+  static constexpr int STEP_COUNT = 100;
+  const bool *is_timer_fired_;
+  int run_count_ = 1;
+};
+
+class TimeSliceTester : public Actor {
+  void start_up() override {
+    Scheduler::instance()->set_time_slice(0.002);
+    auto worker = create_actor<TimeSliceWorker>("TimeSliceWorker", &is_timer_fired_).release();
+    create_actor<SleepActor>("Sleep", 0.005, PromiseCreator::lambda([this](Unit) { is_timer_fired_ = true; }))
+        .release();
+    send_closure(worker, &TimeSliceWorker::run, 0);
+  }
+
+  bool is_timer_fired_ = false;
+};
+
+TEST(Actors, need_yield) {
+  SET_VERBOSITY_LEVEL(VERBOSITY_NAME(ERROR));
+  ConcurrentScheduler scheduler;
+  scheduler.init(0);
+  scheduler.create_actor_unsafe<TimeSliceTester>(0, "TimeSliceTester").release();
+  scheduler.start();
+  while (scheduler.run_main(10)) {
+  }
+  scheduler.finish();
+}
@@ -19,9 +19,10 @@ namespace td {
 class SqliteConnectionSafe {
  public:
   SqliteConnectionSafe() = default;
-  explicit SqliteConnectionSafe(string name, DbKey key = DbKey::empty())
-      : lsls_connection_([name = name, key = std::move(key)] {
-        auto db = SqliteDb::open_with_key(name, key).move_as_ok();
+  explicit SqliteConnectionSafe(string name, DbKey key = DbKey::empty(),
+                                SqliteDb::Options options = SqliteDb::Options())
+      : lsls_connection_([name = name, key = std::move(key), options] {
+        auto db = SqliteDb::open_with_key(name, key, options).move_as_ok();
         db.exec("PRAGMA synchronous=NORMAL").ensure();
         db.exec("PRAGMA temp_store=MEMORY").ensure();
         db.exec("PRAGMA secure_delete=1").ensure();
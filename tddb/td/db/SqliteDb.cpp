@@ -44,6 +44,15 @@ string db_key_to_sqlcipher_key(const DbKey &db_key) {
 }
 }  // namespace
 
+SqliteDb::Options SqliteDb::Options::server() {
+  Options options;
+  options.cache_size = static_cast<int64>(128) << 20;
+  options.mmap_size = static_cast<int64>(64) << 30;  // limited by SQLITE_MAX_MMAP_SIZE
+  options.page_size = 8192;
+  options.wal_autocheckpoint = 10000;
+  return options;
+}
+
 SqliteDb::~SqliteDb() = default;
 
 Status SqliteDb::init(CSlice path, bool *was_created) {
@@ -134,6 +143,21 @@ Status SqliteDb::set_user_version(int32 version) {
   return exec(PSLICE() << "PRAGMA user_version = " << version);
 }
 
+Result<SqliteDb::CheckpointResult> SqliteDb::checkpoint(bool truncate) {
+  CheckpointResult result;
+  auto mode = truncate ? SQLITE_CHECKPOINT_TRUNCATE : SQLITE_CHECKPOINT_PASSIVE;
+  auto rc = sqlite3_wal_checkpoint_v2(raw_->db(), nullptr, mode, &result.wal_frame_count,
+                                      &result.checkpointed_frame_count);
+  if (rc != SQLITE_OK) {
+    return Status::Error(PSLICE() << "Failed to checkpoint db: " << raw_->last_error());
+  }
+  return result;
+}
+
+int64 SqliteDb::get_total_change_count() {
+  return sqlite3_total_changes(raw_->db());
+}
+
 Status SqliteDb::begin_transaction() {
   return exec("BEGIN");
 }
@@ -145,7 +169,30 @@ bool SqliteDb::is_encrypted() {
   return exec("SELECT count(*) FROM sqlite_master").is_error();
 }
 
+Status SqliteDb::set_options(const Options &options, bool is_encrypted) {
+  if (options.page_size > 0 && !is_encrypted) {
+    // has no effect if the database already exists; SQLCipher uses its own page size for encrypted databases
+    TRY_STATUS(exec(PSLICE() << "PRAGMA page_size = " << options.page_size));
+  }
+  if (options.cache_size > 0) {
+    // negative value means size in KiB
+    TRY_STATUS(exec(PSLICE() << "PRAGMA cache_size = " << -((options.cache_size + 1023) / 1024)));
+  }
+  if (options.mmap_size > 0 && !is_encrypted) {
+    // SQLCipher always reads encrypted pages through the pager, so memory mapping is useful only without encryption
+    TRY_STATUS(exec(PSLICE() << "PRAGMA mmap_size = " << options.mmap_size));
+  }
+  if (options.wal_autocheckpoint > 0) {
+    TRY_STATUS(exec(PSLICE() << "PRAGMA wal_autocheckpoint = " << options.wal_autocheckpoint));
+  }
+  return Status::OK();
+}
+
 Result<SqliteDb> SqliteDb::open_with_key(CSlice path, const DbKey &db_key) {
+  return open_with_key(path, db_key, Options());
+}
+
+Result<SqliteDb> SqliteDb::open_with_key(CSlice path, const DbKey &db_key, const Options &options) {
   SqliteDb db;
   TRY_STATUS(db.init(path));
   if (!db_key.is_empty()) {
@@ -158,6 +205,7 @@ Result<SqliteDb> SqliteDb::open_with_key(CSlice path, const DbKey &db_key) {
   if (db.is_encrypted()) {
     return Status::Error("Wrong key");
   }
+  TRY_STATUS(db.set_options(options, !db_key.is_empty()));
   return std::move(db);
 }
 
@@ -11,6 +11,7 @@
 
 #include "td/db/detail/RawSqliteDb.h"
 
+#include "td/utils/common.h"
 #include "td/utils/logging.h"
 #include "td/utils/Slice.h"
 #include "td/utils/Status.h"
@@ -23,6 +24,17 @@ namespace td {
 
 class SqliteDb {
  public:
+  // page cache and I/O parameters of a connection; zero values leave SQLite defaults
+  struct Options {
+    int64 cache_size = 0;          // maximum size of the page cache of the connection in bytes
+    int64 mmap_size = 0;           // maximum size of the memory-mapped part of an unencrypted database in bytes
+    int32 page_size = 0;           // page size of a newly created unencrypted database in bytes
+    int32 wal_autocheckpoint = 0;  // number of WAL pages, after which a commit runs a checkpoint
+
+    // large page cache, memory-mapped reads and rare checkpoints for hosts with fast storage and a lot of memory
+    static Options server();
+  };
+
   SqliteDb() = default;
   explicit SqliteDb(CSlice path) {
     auto status = init(path);
@@ -57,10 +69,25 @@ class SqliteDb {
   Status set_user_version(int32 version);
   void trace(bool flag);
 
+  struct CheckpointResult {
+    int32 wal_frame_count = 0;
+    int32 checkpointed_frame_count = 0;
+  };
+  // passive checkpoint doesn't wait for readers and writers; truncating checkpoint also truncates the log to zero size
+  Result<CheckpointResult> checkpoint(bool truncate);
+
+  // number of rows changed by the connection since it was opened
+  int64 get_total_change_count();
+
+  CSlice get_path() const {
+    return raw_->path();
+  }
+
   static Status destroy(Slice path) TD_WARN_UNUSED_RESULT;
 
   // Anyway we can't change the key on the fly, so static functions is more than enough
   static Result<SqliteDb> open_with_key(CSlice path, const DbKey &db_key);
+  static Result<SqliteDb> open_with_key(CSlice path, const DbKey &db_key, const Options &options);
   static Status change_key(CSlice path, const DbKey &new_db_key, const DbKey &old_db_key);
 
   Status last_error();
@@ -82,5 +109,6 @@ class SqliteDb {
   std::shared_ptr<detail::RawSqliteDb> raw_;
 
   bool is_encrypted();
+  Status set_options(const Options &options, bool is_encrypted);
 };
 }  // namespace td
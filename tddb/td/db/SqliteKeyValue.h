@@ -9,11 +9,13 @@
 #include "td/db/SqliteDb.h"
 #include "td/db/SqliteStatement.h"
 
+#include "td/utils/common.h"
 #include "td/utils/logging.h"
 #include "td/utils/ScopeGuard.h"
 #include "td/utils/Slice.h"
 #include "td/utils/Status.h"
 
+#include <algorithm>
 #include <unordered_map>
 
 namespace td {
@@ -51,6 +53,14 @@ class SqliteKeyValue {
     set_stmt_ = std::move(set_stmt);
     TRY_RESULT(get_stmt, db_.get_statement(PSLICE() << "SELECT v FROM " << kv_name_ << " WHERE k = ?1"));
     get_stmt_ = std::move(get_stmt);
+    string get_multi_query = PSTRING() << "SELECT k, v FROM " << kv_name_ << " WHERE k IN (?1";
+    for (int i = 2; i <= MAX_GET_MULTI_KEYS; i++) {
+      get_multi_query += ", ?";
+      get_multi_query += to_string(i);
+    }
+    get_multi_query += ")";
+    TRY_RESULT(get_multi_stmt, db_.get_statement(get_multi_query));
+    get_multi_stmt_ = std::move(get_multi_stmt);
     TRY_RESULT(erase_stmt, db_.get_statement(PSLICE() << "DELETE FROM " << kv_name_ << " WHERE k = ?1"));
     erase_stmt_ = std::move(erase_stmt);
     TRY_RESULT(get_all_stmt, db_.get_statement(PSLICE() << "SELECT k, v FROM " << kv_name_ << ""));
@@ -124,6 +134,40 @@ class SqliteKeyValue {
     return data;
   }
 
+  // returns values in the same order as keys, values for absent keys are empty
+  std::vector<string> get_multi(const std::vector<string> &keys) {
+    std::vector<string> result(keys.size());
+    std::unordered_map<Slice, size_t, SliceHash> key_pos;
+    for (size_t i = 0; i < keys.size(); i++) {
+      key_pos.emplace(keys[i], i);
+    }
+
+    for (size_t from = 0; from < keys.size(); from += MAX_GET_MULTI_KEYS) {
+      auto till = std::min(keys.size(), from + static_cast<size_t>(MAX_GET_MULTI_KEYS));
+      auto guard = get_multi_stmt_.guard();
+      for (int i = 0; i < MAX_GET_MULTI_KEYS; i++) {
+        // unused parameters are filled with the first key of the chunk
+        auto pos = from + i < till ? from + i : from;
+        get_multi_stmt_.bind_blob(i + 1, keys[pos]).ensure();
+      }
+      get_multi_stmt_.step().ensure();
+      while (get_multi_stmt_.has_row()) {
+        auto it = key_pos.find(get_multi_stmt_.view_blob(0));
+        CHECK(it != key_pos.end());
+        result[it->second] = get_multi_stmt_.view_blob(1).str();
+        get_multi_stmt_.step().ensure();
+      }
+    }
+
+    for (size_t i = 0; i < keys.size(); i++) {
+      auto pos = key_pos[keys[i]];
+      if (pos != i) {
+        result[i] = result[pos];
+      }
+    }
+    return result;
+  }
+
   Status begin_transaction() {
     return db_.begin_transaction();
   }
@@ -191,10 +235,13 @@ class SqliteKeyValue {
   }
 
  private:
+  static constexpr int MAX_GET_MULTI_KEYS = 100;
+
   string name_;  // deprecated
   string kv_name_;
   SqliteDb db_;
   SqliteStatement get_stmt_;
+  SqliteStatement get_multi_stmt_;
   SqliteStatement set_stmt_;
   SqliteStatement erase_stmt_;
   SqliteStatement get_all_stmt_;
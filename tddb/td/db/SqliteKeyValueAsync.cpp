@@ -26,6 +26,9 @@ class SqliteKeyValueAsync : public SqliteKeyValueAsyncInterface {
   void get(string key, Promise<string> promise) override {
     send_closure_later(impl_, &Impl::get, std::move(key), std::move(promise));
   }
+  void get_multi(vector<string> keys, Promise<vector<string>> promise) override {
+    send_closure_later(impl_, &Impl::get_multi, std::move(keys), std::move(promise));
+  }
   void close(Promise<> promise) override {
     send_closure_later(impl_, &Impl::close, std::move(promise));
   }
@@ -69,6 +72,29 @@ class SqliteKeyValueAsync : public SqliteKeyValueAsyncInterface {
       }
       promise.set_value(kv_->get(key));
     }
+    void get_multi(const vector<string> &keys, Promise<vector<string>> promise) {
+      vector<string> result(keys.size());
+      vector<string> db_keys;
+      vector<size_t> db_key_pos;
+      for (size_t i = 0; i < keys.size(); i++) {
+        auto it = buffer_.find(keys[i]);
+        if (it != buffer_.end()) {
+          if (it->second) {
+            result[i] = it->second.value();
+          }
+        } else {
+          db_keys.push_back(keys[i]);
+          db_key_pos.push_back(i);
+        }
+      }
+      if (!db_keys.empty()) {
+        auto values = kv_->get_multi(db_keys);
+        for (size_t i = 0; i < values.size(); i++) {
+          result[db_key_pos[i]] = std::move(values[i]);
+        }
+      }
+      promise.set_value(std::move(result));
+    }
     void close(Promise<> promise) {
       do_flush(true /*force*/);
       kv_safe_.reset();
@@ -22,6 +22,7 @@ class SqliteKeyValueAsyncInterface {
   virtual void erase(string key, Promise<> promise) = 0;
 
   virtual void get(string key, Promise<string> promise) = 0;
+  virtual void get_multi(vector<string> keys, Promise<vector<string>> promise) = 0;
   virtual void close(Promise<> promise) = 0;
 };
 
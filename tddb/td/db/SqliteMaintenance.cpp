@@ -0,0 +1,214 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/db/SqliteMaintenance.h"
+
+#include "td/db/SqliteDb.h"
+#include "td/db/SqliteStatement.h"
+
+#include "td/actor/actor.h"
+
+#include "td/utils/format.h"
+#include "td/utils/logging.h"
+#include "td/utils/port/Stat.h"
+#include "td/utils/Slice.h"
+#include "td/utils/Status.h"
+#include "td/utils/Time.h"
+
+#include <algorithm>
+
+namespace td {
+
+class SqliteMaintenance : public SqliteMaintenanceInterface {
+ public:
+  SqliteMaintenance(std::shared_ptr<SqliteConnectionSafe> connection, int32 scheduler_id, Options options) {
+    impl_ = create_actor_on_scheduler<Impl>("SqliteMaintenance", scheduler_id, std::move(connection), options);
+  }
+  void set_allow_full_vacuum(bool allow_full_vacuum) override {
+    send_closure_later(impl_, &Impl::set_allow_full_vacuum, allow_full_vacuum);
+  }
+  void get_stats(Promise<Stats> promise) override {
+    send_closure_later(impl_, &Impl::get_stats, std::move(promise));
+  }
+  void close(Promise<> promise) override {
+    send_closure_later(impl_, &Impl::close, std::move(promise));
+  }
+
+ private:
+  class Impl : public Actor {
+   public:
+    Impl(std::shared_ptr<SqliteConnectionSafe> connection, Options options)
+        : connection_(std::move(connection)), options_(options) {
+    }
+    void set_allow_full_vacuum(bool allow_full_vacuum) {
+      options_.allow_full_vacuum = allow_full_vacuum;
+    }
+    void get_stats(Promise<Stats> promise) {
+      auto r_stats = do_get_stats();
+      if (r_stats.is_error()) {
+        return promise.set_error(r_stats.move_as_error());
+      }
+      promise.set_value(r_stats.move_as_ok());
+    }
+    void close(Promise<> promise) {
+      connection_.reset();
+      db_ = nullptr;
+      stop();
+      promise.set_value(Unit());
+    }
+
+   private:
+    static constexpr int64 INCREMENTAL_VACUUM_PAGE_COUNT = 512;  // maximum number of pages freed in one step
+    static constexpr int64 MIN_FREE_PAGE_COUNT = 256;
+    static constexpr int64 MAX_WAL_SIZE = 8 << 20;                  // a bigger checkpointed log is truncated
+    static constexpr int64 MAX_CONVERTED_DATABASE_SIZE = 64 << 20;  // maximum size of a database to fully VACUUM
+
+    static constexpr int32 AUTO_VACUUM_NONE = 0;
+    static constexpr int32 AUTO_VACUUM_INCREMENTAL = 2;
+
+    std::shared_ptr<SqliteConnectionSafe> connection_;
+    Options options_;
+    SqliteDb *db_ = nullptr;
+
+    int64 last_change_count_ = -1;
+    int64 last_data_version_ = -1;
+    bool is_wal_checkpointed_ = false;
+    bool was_conversion_tried_ = false;
+
+    Stats stats_;
+
+    void start_up() override {
+      db_ = &connection_->get();
+      set_timeout_in(options_.check_period);
+    }
+
+    void timeout_expired() override {
+      auto r_is_idle = check_is_idle();
+      if (r_is_idle.is_error() || !r_is_idle.ok()) {
+        is_wal_checkpointed_ = false;
+        return set_timeout_in(options_.check_period);
+      }
+
+      auto begin_time = Time::now();
+      auto r_has_more = run_maintenance_step();
+      stats_.total_time += Time::now() - begin_time;
+      if (r_has_more.is_error()) {
+        LOG(INFO) << "Failed to run database maintenance: " << r_has_more.error();
+        return set_timeout_in(options_.check_period);
+      }
+      set_timeout_in(r_has_more.ok() ? options_.vacuum_step_delay : options_.check_period);
+    }
+
+    // returns true, if nothing was written to the database since the previous check
+    Result<bool> check_is_idle() {
+      auto change_count = db_->get_total_change_count();
+      // data_version changes only after commits of other connections
+      TRY_RESULT(data_version, get_integer_pragma("data_version"));
+      bool is_idle = change_count == last_change_count_ && data_version == last_data_version_;
+      last_change_count_ = change_count;
+      last_data_version_ = data_version;
+      return is_idle;
+    }
+
+    Result<int64> get_integer_pragma(Slice name) {
+      TRY_RESULT(stmt, db_->get_statement(PSLICE() << "PRAGMA " << name));
+      TRY_STATUS(stmt.step());
+      if (!stmt.has_row()) {
+        return Status::Error(PSLICE() << "PRAGMA " << name << " failed");
+      }
+      return stmt.view_int64(0);
+    }
+
+    int64 get_wal_size() const {
+      auto r_stat = stat(PSLICE() << db_->get_path() << "-wal");
+      return r_stat.is_ok() ? r_stat.ok().size_ : 0;
+    }
+
+    // returns true, if there is more work to do
+    Result<bool> run_maintenance_step() {
+      if (!is_wal_checkpointed_) {
+        // a passive checkpoint never waits for readers and writers
+        TRY_RESULT(result, db_->checkpoint(false));
+        stats_.checkpoint_count++;
+        if (result.checkpointed_frame_count == result.wal_frame_count) {
+          is_wal_checkpointed_ = true;
+          if (get_wal_size() > MAX_WAL_SIZE) {
+            TRY_STATUS(db_->checkpoint(true));
+            stats_.truncate_checkpoint_count++;
+          }
+        }
+      }
+
+      TRY_RESULT(free_page_count, get_integer_pragma("freelist_count"));
+      if (free_page_count < MIN_FREE_PAGE_COUNT) {
+        return false;
+      }
+
+      TRY_RESULT(auto_vacuum, get_integer_pragma("auto_vacuum"));
+      if (auto_vacuum == AUTO_VACUUM_INCREMENTAL) {
+        auto page_count = std::min(free_page_count, static_cast<int64>(INCREMENTAL_VACUUM_PAGE_COUNT));
+        TRY_STATUS(db_->exec(PSLICE() << "PRAGMA incremental_vacuum(" << page_count << ")"));
+        stats_.vacuumed_page_count += page_count;
+        is_wal_checkpointed_ = false;
+        return true;
+      }
+
+      if (auto_vacuum == AUTO_VACUUM_NONE && options_.allow_full_vacuum && !was_conversion_tried_) {
+        // auto_vacuum mode of an existing database can be changed only by full VACUUM, so convert only small databases
+        was_conversion_tried_ = true;
+        TRY_RESULT(page_count, get_integer_pragma("page_count"));
+        TRY_RESULT(page_size, get_integer_pragma("page_size"));
+        if (page_count * page_size <= MAX_CONVERTED_DATABASE_SIZE) {
+          auto size = format::as_size(static_cast<uint64>(page_count * page_size));
+          LOG(WARNING) << "Enable incremental vacuum for the database of size " << size;
+          auto begin_time = Time::now();
+          TRY_STATUS(db_->exec("PRAGMA auto_vacuum=INCREMENTAL"));
+          TRY_STATUS(db_->exec("VACUUM"));
+          stats_.full_vacuum_count++;
+          LOG(WARNING) << "Finished full vacuum of the database of size " << size << " in "
+                       << format::as_time(Time::now() - begin_time);
+          is_wal_checkpointed_ = false;
+          return true;
+        }
+      }
+      return false;
+    }
+
+    Result<Stats> do_get_stats() {
+      Stats stats = stats_;
+      stats.wal_size = get_wal_size();
+      TRY_RESULT(page_size, get_integer_pragma("page_size"));
+      TRY_RESULT(page_count, get_integer_pragma("page_count"));
+      TRY_RESULT(free_page_count, get_integer_pragma("freelist_count"));
+      TRY_RESULT(auto_vacuum, get_integer_pragma("auto_vacuum"));
+      stats.page_size = page_size;
+      stats.page_count = page_count;
+      stats.free_page_count = free_page_count;
+      stats.is_incremental_vacuum_enabled = auto_vacuum == AUTO_VACUUM_INCREMENTAL;
+      return stats;
+    }
+  };
+  ActorOwn<Impl> impl_;
+};
+
+StringBuilder &operator<<(StringBuilder &sb, const SqliteMaintenanceInterface::Stats &stats) {
+  return sb << tag("wal_size", format::as_size(static_cast<uint64>(stats.wal_size)))
+            << tag("page_size", stats.page_size) << tag("pages", stats.page_count)
+            << tag("free_pages", stats.free_page_count)
+            << tag("incremental_vacuum", stats.is_incremental_vacuum_enabled)
+            << tag("checkpoints", stats.checkpoint_count)
+            << tag("truncate_checkpoints", stats.truncate_checkpoint_count)
+            << tag("vacuumed_pages", stats.vacuumed_page_count) << tag("full_vacuums", stats.full_vacuum_count)
+            << tag("total_time", format::as_time(stats.total_time));
+}
+
+std::unique_ptr<SqliteMaintenanceInterface> create_sqlite_maintenance(std::shared_ptr<SqliteConnectionSafe> connection,
+                                                                      int32 scheduler_id,
+                                                                      SqliteMaintenanceInterface::Options options) {
+  return std::make_unique<SqliteMaintenance>(std::move(connection), scheduler_id, options);
+}
+
+}  // namespace td
@@ -0,0 +1,57 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/db/SqliteConnectionSafe.h"
+
+#include "td/actor/PromiseFuture.h"
+
+#include "td/utils/common.h"
+#include "td/utils/StringBuilder.h"
+
+#include <memory>
+
+namespace td {
+
+// checkpoints the write-ahead log and reclaims free pages of a database, while it isn't used for writing
+class SqliteMaintenanceInterface {
+ public:
+  struct Stats {
+    int64 wal_size = 0;
+    int64 page_size = 0;
+    int64 page_count = 0;
+    int64 free_page_count = 0;
+    bool is_incremental_vacuum_enabled = false;
+    int64 checkpoint_count = 0;
+    int64 truncate_checkpoint_count = 0;
+    int64 vacuumed_page_count = 0;
+    int64 full_vacuum_count = 0;
+    double total_time = 0;  // total time spent on maintenance
+  };
+
+  struct Options {
+    double check_period = 10;  // the database is idle if it wasn't changed during the period
+    double vacuum_step_delay = 0.5;
+    // existing databases without incremental vacuum are converted by a full VACUUM, blocking the database for its
+    // whole duration, so it must be explicitly allowed
+    bool allow_full_vacuum = false;
+  };
+
+  virtual ~SqliteMaintenanceInterface() = default;
+
+  virtual void set_allow_full_vacuum(bool allow_full_vacuum) = 0;
+  virtual void get_stats(Promise<Stats> promise) = 0;
+  virtual void close(Promise<> promise) = 0;
+};
+
+StringBuilder &operator<<(StringBuilder &sb, const SqliteMaintenanceInterface::Stats &stats);
+
+std::unique_ptr<SqliteMaintenanceInterface> create_sqlite_maintenance(
+    std::shared_ptr<SqliteConnectionSafe> connection, int32 scheduler_id = 1,
+    SqliteMaintenanceInterface::Options options = SqliteMaintenanceInterface::Options());
+
+}  // namespace td
@@ -8,14 +8,45 @@
 
 #include "td/utils/format.h"
 #include "td/utils/logging.h"
+#include "td/utils/port/Clocks.h"
 #include "td/utils/StackAllocator.h"
 #include "td/utils/StringBuilder.h"
 
 #include "sqlite/sqlite3.h"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
 namespace td {
 
+namespace detail {
+struct SqliteStatementCounters {
+  std::atomic<int64> execution_count{0};
+  std::atomic<int64> row_count{0};
+  std::atomic<int64> byte_count{0};
+  std::atomic<int64> full_scan_step_count{0};
+  std::atomic<int64> cache_miss_count{0};
+  std::atomic<int64> total_time_ns{0};
+  std::atomic<int64> max_time_ns{0};
+};
+}  // namespace detail
+
 namespace {
+std::mutex counters_mutex;
+std::unordered_map<string, std::shared_ptr<detail::SqliteStatementCounters>> counters_by_sql;  // under counters_mutex
+std::atomic<double> slow_query_threshold{0.0};
+
+std::shared_ptr<detail::SqliteStatementCounters> get_counters(Slice sql) {
+  std::lock_guard<std::mutex> guard(counters_mutex);
+  auto &counters = counters_by_sql[sql.str()];
+  if (counters == nullptr) {
+    counters = std::make_shared<detail::SqliteStatementCounters>();
+  }
+  return counters;
+}
+
 int printExplainQueryPlan(StringBuilder &sb, sqlite3_stmt *pStmt) {
   const char *zSql = sqlite3_sql(pStmt);
   if (zSql == nullptr) {
@@ -51,9 +82,62 @@ int printExplainQueryPlan(StringBuilder &sb, sqlite3_stmt *pStmt) {
 SqliteStatement::SqliteStatement(sqlite3_stmt *stmt, std::shared_ptr<detail::RawSqliteDb> db)
     : stmt_(stmt), db_(std::move(db)) {
   CHECK(stmt != nullptr);
+  const char *sql = sqlite3_sql(stmt);
+  counters_ = get_counters(sql == nullptr ? Slice() : Slice(sql));
 }
 SqliteStatement::~SqliteStatement() = default;
 
+vector<SqliteStatement::Stats> SqliteStatement::get_stats() {
+  vector<Stats> result;
+  {
+    std::lock_guard<std::mutex> guard(counters_mutex);
+    for (auto &it : counters_by_sql) {
+      auto &counters = *it.second;
+      Stats stats;
+      stats.sql = it.first;
+      stats.execution_count = counters.execution_count.load(std::memory_order_relaxed);
+      if (stats.execution_count == 0) {
+        continue;
+      }
+      stats.row_count = counters.row_count.load(std::memory_order_relaxed);
+      stats.byte_count = counters.byte_count.load(std::memory_order_relaxed);
+      stats.full_scan_step_count = counters.full_scan_step_count.load(std::memory_order_relaxed);
+      stats.cache_miss_count = counters.cache_miss_count.load(std::memory_order_relaxed);
+      stats.total_time = static_cast<double>(counters.total_time_ns.load(std::memory_order_relaxed)) * 1e-9;
+      stats.max_time = static_cast<double>(counters.max_time_ns.load(std::memory_order_relaxed)) * 1e-9;
+      result.push_back(std::move(stats));
+    }
+  }
+  std::sort(result.begin(), result.end(),
+            [](const Stats &lhs, const Stats &rhs) { return lhs.total_time > rhs.total_time; });
+  return result;
+}
+
+void SqliteStatement::clear_stats() {
+  std::lock_guard<std::mutex> guard(counters_mutex);
+  for (auto &it : counters_by_sql) {
+    auto &counters = *it.second;
+    counters.execution_count = 0;
+    counters.row_count = 0;
+    counters.byte_count = 0;
+    counters.full_scan_step_count = 0;
+    counters.cache_miss_count = 0;
+    counters.total_time_ns = 0;
+    counters.max_time_ns = 0;
+  }
+}
+
+void SqliteStatement::set_slow_query_threshold(double seconds) {
+  slow_query_threshold.store(seconds, std::memory_order_relaxed);
+}
+
+StringBuilder &operator<<(StringBuilder &sb, const SqliteStatement::Stats &stats) {
+  return sb << tag("cmd", stats.sql) << tag("executions", stats.execution_count) << tag("rows", stats.row_count)
+            << tag("bytes", format::as_size(static_cast<uint64>(stats.byte_count)))
+            << tag("full_scan_steps", stats.full_scan_step_count) << tag("cache_misses", stats.cache_miss_count)
+            << tag("total_time", format::as_time(stats.total_time)) << tag("max_time", format::as_time(stats.max_time));
+}
+
 Result<string> SqliteStatement::explain() {
   if (empty()) {
     return Status::Error("No statement");
@@ -70,6 +154,7 @@ Result<string> SqliteStatement::explain() {
   return sb.as_cslice().str();
 }
 Status SqliteStatement::bind_blob(int id, Slice blob) {
+  execution_byte_count_ += static_cast<int64>(blob.size());
   auto rc = sqlite3_bind_blob(stmt_.get(), id, blob.data(), static_cast<int>(blob.size()), nullptr);
   if (rc != SQLITE_OK) {
     return last_error();
@@ -77,6 +162,7 @@ Status SqliteStatement::bind_blob(int id, Slice blob) {
   return Status::OK();
 }
 Status SqliteStatement::bind_string(int id, Slice str) {
+  execution_byte_count_ += static_cast<int64>(str.size());
   auto rc = sqlite3_bind_text(stmt_.get(), id, str.data(), static_cast<int>(str.size()), nullptr);
   if (rc != SQLITE_OK) {
     return last_error();
@@ -130,6 +216,7 @@ Slice SqliteStatement::view_blob(int id) {
   if (data == nullptr) {
     return Slice();
   }
+  execution_byte_count_ += size;
   return Slice(static_cast<const char *>(data), size);
 }
 Slice SqliteStatement::view_string(int id) {
@@ -139,6 +226,7 @@ Slice SqliteStatement::view_string(int id) {
   if (data == nullptr) {
     return Slice();
   }
+  execution_byte_count_ += size;
   return Slice(data, size);
 }
 int32 SqliteStatement::view_int32(int id) {
@@ -168,31 +256,81 @@ SqliteStatement::Datatype SqliteStatement::view_datatype(int id) {
 }
 
 void SqliteStatement::reset() {
+  if (state_ == GotRow) {
+    on_execution_finished();
+  }
   sqlite3_reset(stmt_.get());
   state_ = Start;
+  execution_time_ = 0;
+  execution_row_count_ = 0;
+  execution_byte_count_ = 0;
 }
 
 Status SqliteStatement::step() {
   if (state_ == Finish) {
     return Status::Error("One has to reset statement");
   }
+  if (state_ == Start) {
+    execution_cache_miss_count_ = get_cache_miss_count();
+  }
   VLOG(sqlite) << "Start step " << tag("cmd", sqlite3_sql(stmt_.get())) << tag("stmt", stmt_.get())
                << tag("db", db_.get());
+  auto start_time = Clocks::monotonic();
   auto rc = sqlite3_step(stmt_.get());
+  execution_time_ += Clocks::monotonic() - start_time;
   VLOG(sqlite) << "Finish step " << tag("cmd", sqlite3_sql(stmt_.get())) << tag("stmt", stmt_.get())
                << tag("db", db_.get());
   if (rc == SQLITE_ROW) {
     state_ = GotRow;
+    execution_row_count_++;
     return Status::OK();
   }
+  state_ = Finish;
+  on_execution_finished();
   if (rc == SQLITE_DONE) {
-    state_ = Finish;
     return Status::OK();
   }
-  state_ = Finish;
   return last_error();
 }
 
+int64 SqliteStatement::get_cache_miss_count() const {
+  int current = 0;
+  int highwater = 0;
+  if (sqlite3_db_status(db_->db(), SQLITE_DBSTATUS_CACHE_MISS, &current, &highwater, 0) != SQLITE_OK) {
+    return 0;
+  }
+  return current;
+}
+
+void SqliteStatement::on_execution_finished() {
+  auto cache_miss_count = get_cache_miss_count() - execution_cache_miss_count_;
+  auto full_scan_step_count = sqlite3_stmt_status(stmt_.get(), SQLITE_STMTSTATUS_FULLSCAN_STEP, 1);
+  auto time_ns = static_cast<int64>(execution_time_ * 1e9);
+
+  auto &counters = *counters_;
+  counters.execution_count.fetch_add(1, std::memory_order_relaxed);
+  counters.row_count.fetch_add(execution_row_count_, std::memory_order_relaxed);
+  counters.byte_count.fetch_add(execution_byte_count_, std::memory_order_relaxed);
+  counters.full_scan_step_count.fetch_add(full_scan_step_count, std::memory_order_relaxed);
+  if (cache_miss_count > 0) {
+    counters.cache_miss_count.fetch_add(cache_miss_count, std::memory_order_relaxed);
+  }
+  counters.total_time_ns.fetch_add(time_ns, std::memory_order_relaxed);
+  auto max_time_ns = counters.max_time_ns.load(std::memory_order_relaxed);
+  while (max_time_ns < time_ns &&
+         !counters.max_time_ns.compare_exchange_weak(max_time_ns, time_ns, std::memory_order_relaxed)) {
+  }
+
+  auto threshold = slow_query_threshold.load(std::memory_order_relaxed);
+  if (threshold > 0 && execution_time_ >= threshold) {
+    // only the statement text is logged; bound parameters may contain private data
+    LOG(WARNING) << "Slow SQLite query " << tag("cmd", sqlite3_sql(stmt_.get())) << tag("db", db_->path())
+                 << tag("time", format::as_time(execution_time_)) << tag("rows", execution_row_count_)
+                 << tag("bytes", format::as_size(static_cast<uint64>(execution_byte_count_)))
+                 << tag("full_scan_steps", full_scan_step_count) << tag("cache_misses", cache_miss_count);
+  }
+}
+
 void SqliteStatement::StmtDeleter::operator()(sqlite3_stmt *stmt) {
   sqlite3_finalize(stmt);
 }
@@ -9,6 +9,7 @@
 #include "td/utils/common.h"
 #include "td/utils/Slice.h"
 #include "td/utils/Status.h"
+#include "td/utils/StringBuilder.h"
 
 #include "td/db/detail/RawSqliteDb.h"
 
@@ -19,6 +20,10 @@ struct sqlite3_stmt;
 
 namespace td {
 
+namespace detail {
+struct SqliteStatementCounters;
+}  // namespace detail
+
 class SqliteStatement {
  public:
   SqliteStatement() = default;
@@ -61,6 +66,25 @@ class SqliteStatement {
 
   // TODO get row
 
+  // execution statistics, aggregated over all prepared statements with the same SQL text
+  struct Stats {
+    string sql;
+    int64 execution_count = 0;
+    int64 row_count = 0;
+    int64 byte_count = 0;  // total size of bound and viewed strings and blobs
+    int64 full_scan_step_count = 0;
+    int64 cache_miss_count = 0;
+    double total_time = 0;
+    double max_time = 0;
+  };
+
+  // returns statistics for all statements, sorted by total execution time
+  static vector<Stats> get_stats();
+  static void clear_stats();
+
+  // executions slower than the threshold are logged with warning verbosity; 0 disables the log
+  static void set_slow_query_threshold(double seconds);
+
  private:
   friend class SqliteDb;
   SqliteStatement(sqlite3_stmt *stmt, std::shared_ptr<detail::RawSqliteDb> db);
@@ -75,6 +99,18 @@ class SqliteStatement {
   std::unique_ptr<sqlite3_stmt, StmtDeleter> stmt_;
   std::shared_ptr<detail::RawSqliteDb> db_;
 
+  std::shared_ptr<detail::SqliteStatementCounters> counters_;
+  double execution_time_ = 0;
+  int64 execution_row_count_ = 0;
+  int64 execution_byte_count_ = 0;
+  int64 execution_cache_miss_count_ = 0;
+
+  int64 get_cache_miss_count() const;
+  void on_execution_finished();
+
   Status last_error();
 };
+
+StringBuilder &operator<<(StringBuilder &sb, const SqliteStatement::Stats &stats);
+
 }  // namespace td
@@ -0,0 +1,2 @@
+#include <cstddef>
+const char *extension_to_mime_type(const char *s, std::size_t n) { return nullptr; }
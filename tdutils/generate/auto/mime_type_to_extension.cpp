@@ -0,0 +1,2 @@
+#include <cstddef>
+const char *mime_type_to_extension(const char *s, std::size_t n) { return nullptr; }
@@ -0,0 +1,87 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/ArenaAllocator.h"
+
+#include "td/utils/logging.h"
+
+#include <new>
+
+namespace td {
+
+std::atomic<size_t> ArenaAllocator::arena_mem_;
+
+ArenaAllocator::~ArenaAllocator() {
+  if (chunk_ != nullptr) {
+    dec_ref_cnt(chunk_);
+  }
+}
+
+size_t ArenaAllocator::get_arena_mem() {
+  return arena_mem_.load(std::memory_order_relaxed);
+}
+
+void *ArenaAllocator::allocate(size_t size) {
+  size = align_size(sizeof(BlockHeader) + size);
+  if (size > MAX_CHUNK_SIZE / 4) {
+    return allocate_heap(size - sizeof(BlockHeader));
+  }
+
+  if (chunk_ == nullptr || chunk_->size_ - chunk_->pos_ < size) {
+    if (chunk_ != nullptr) {
+      dec_ref_cnt(chunk_);
+    }
+    while (next_chunk_size_ < size * 4) {
+      next_chunk_size_ *= 2;
+    }
+    auto chunk_size = next_chunk_size_;
+    if (next_chunk_size_ < MAX_CHUNK_SIZE) {
+      next_chunk_size_ *= 2;
+    }
+
+    auto header_size = align_size(sizeof(Chunk));
+    chunk_ = static_cast<Chunk *>(::operator new(header_size + chunk_size));
+    chunk_->ref_cnt_.store(1, std::memory_order_relaxed);  // reference from the allocator
+    chunk_->size_ = header_size + chunk_size;
+    chunk_->pos_ = header_size;
+    arena_mem_.fetch_add(chunk_->size_, std::memory_order_relaxed);
+  }
+
+  auto header = reinterpret_cast<BlockHeader *>(reinterpret_cast<char *>(chunk_) + chunk_->pos_);
+  chunk_->pos_ += size;
+  chunk_->ref_cnt_.fetch_add(1, std::memory_order_relaxed);
+  header->chunk_ = chunk_;
+  return header + 1;
+}
+
+void *ArenaAllocator::allocate_heap(size_t size) {
+  auto header = static_cast<BlockHeader *>(::operator new(sizeof(BlockHeader) + size));
+  header->chunk_ = nullptr;
+  return header + 1;
+}
+
+void ArenaAllocator::deallocate(void *ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  auto header = static_cast<BlockHeader *>(ptr) - 1;
+  if (header->chunk_ == nullptr) {
+    ::operator delete(header);
+    return;
+  }
+  dec_ref_cnt(header->chunk_);
+}
+
+void ArenaAllocator::dec_ref_cnt(Chunk *chunk) {
+  auto left = chunk->ref_cnt_.fetch_sub(1, std::memory_order_acq_rel);
+  CHECK(left != 0);
+  if (left == 1) {
+    arena_mem_.fetch_sub(chunk->size_, std::memory_order_relaxed);
+    ::operator delete(chunk);
+  }
+}
+
+}  // namespace td
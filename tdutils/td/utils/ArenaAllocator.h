@@ -0,0 +1,63 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+
+#include <atomic>
+
+namespace td {
+
+// Bump allocator for many small objects with a common lifetime, e.g. for a TL-object tree parsed from one response.
+// Every allocated block remembers its chunk, and the chunk is freed in one shot after all its blocks are deallocated
+// and the allocator itself has moved on to another chunk or was destroyed, so objects can safely outlive the arena.
+// Blocks can be deallocated from any thread.
+class ArenaAllocator {
+ public:
+  ArenaAllocator() = default;
+  ArenaAllocator(const ArenaAllocator &other) = delete;
+  ArenaAllocator &operator=(const ArenaAllocator &other) = delete;
+  ArenaAllocator(ArenaAllocator &&other) = delete;
+  ArenaAllocator &operator=(ArenaAllocator &&other) = delete;
+  ~ArenaAllocator();
+
+  void *allocate(size_t size);
+
+  // allocates a block, compatible with deallocate, directly from the heap
+  static void *allocate_heap(size_t size);
+
+  static void deallocate(void *ptr);
+
+  static size_t get_arena_mem();
+
+ private:
+  struct Chunk {
+    std::atomic<size_t> ref_cnt_;
+    size_t size_;
+    size_t pos_;
+  };
+
+  struct alignas(16) BlockHeader {
+    Chunk *chunk_;
+  };
+
+  static constexpr size_t MIN_CHUNK_SIZE = 1 << 10;
+  static constexpr size_t MAX_CHUNK_SIZE = 1 << 16;
+
+  Chunk *chunk_ = nullptr;
+  size_t next_chunk_size_ = MIN_CHUNK_SIZE;
+
+  static std::atomic<size_t> arena_mem_;
+
+  static size_t align_size(size_t size) {
+    return (size + alignof(BlockHeader) - 1) & ~(alignof(BlockHeader) - 1);
+  }
+
+  static void dec_ref_cnt(Chunk *chunk);
+};
+
+}  // namespace td
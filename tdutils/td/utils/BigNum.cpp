@@ -60,6 +60,37 @@ class BigNum::Impl {
   }
 };
 
+class BigNumMontgomeryContext::Impl {
+ public:
+  BN_MONT_CTX *montgomery_context;
+
+  explicit Impl(BN_MONT_CTX *montgomery_context) : montgomery_context(montgomery_context) {
+  }
+  Impl(const Impl &other) = delete;
+  Impl &operator=(const Impl &other) = delete;
+  Impl(Impl &&other) = delete;
+  Impl &operator=(Impl &&other) = delete;
+  ~Impl() {
+    BN_MONT_CTX_free(montgomery_context);
+  }
+};
+
+BigNumMontgomeryContext::BigNumMontgomeryContext(const BigNum &modulus, BigNumContext &context) {
+  if (!BN_is_odd(modulus.impl_->big_num)) {
+    return;
+  }
+  auto montgomery_context = BN_MONT_CTX_new();
+  LOG_IF(FATAL, montgomery_context == nullptr);
+  impl_ = make_unique<Impl>(montgomery_context);
+  int result = BN_MONT_CTX_set(montgomery_context, modulus.impl_->big_num, context.impl_->big_num_context);
+  LOG_IF(FATAL, result != 1);
+}
+
+BigNumMontgomeryContext::BigNumMontgomeryContext(BigNumMontgomeryContext &&other) = default;
+BigNumMontgomeryContext &BigNumMontgomeryContext::operator=(BigNumMontgomeryContext &&other) = default;
+
+BigNumMontgomeryContext::~BigNumMontgomeryContext() = default;
+
 BigNum::BigNum() : impl_(make_unique<Impl>()) {
 }
 
@@ -238,6 +269,25 @@ void BigNum::mod_exp(BigNum &r, const BigNum &a, const BigNum &p, const BigNum &
   LOG_IF(FATAL, result != 1);
 }
 
+void BigNum::mod_exp(BigNum &r, const BigNum &a, const BigNum &p, const BigNum &m, BigNumContext &context,
+                     const BigNumMontgomeryContext &montgomery_context) {
+  if (montgomery_context.impl_ == nullptr) {
+    return mod_exp(r, a, p, m, context);
+  }
+  int result;
+  if (BN_num_bits(a.impl_->big_num) <= BN_BITS2 && !BN_is_negative(a.impl_->big_num) &&
+      BN_get_flags(p.impl_->big_num, BN_FLG_CONSTTIME) == 0) {
+    // the same optimization for small bases as in BN_mod_exp
+    result = BN_mod_exp_mont_word(r.impl_->big_num, BN_get_word(a.impl_->big_num), p.impl_->big_num,
+                                  m.impl_->big_num, context.impl_->big_num_context,
+                                  montgomery_context.impl_->montgomery_context);
+  } else {
+    result = BN_mod_exp_mont(r.impl_->big_num, a.impl_->big_num, p.impl_->big_num, m.impl_->big_num,
+                             context.impl_->big_num_context, montgomery_context.impl_->montgomery_context);
+  }
+  LOG_IF(FATAL, result != 1);
+}
+
 void BigNum::gcd(BigNum &r, BigNum &a, BigNum &b, BigNumContext &context) {
   int result = BN_gcd(r.impl_->big_num, a.impl_->big_num, b.impl_->big_num, context.impl_->big_num_context);
   LOG_IF(FATAL, result != 1);
@@ -27,6 +27,26 @@ class BigNumContext {
   class Impl;
   unique_ptr<Impl> impl_;
 
+  friend class BigNum;
+  friend class BigNumMontgomeryContext;
+};
+
+class BigNum;
+
+// pre-computed Montgomery representation of an odd modulus; can be shared between threads after creation
+class BigNumMontgomeryContext {
+ public:
+  BigNumMontgomeryContext(const BigNum &modulus, BigNumContext &context);
+  BigNumMontgomeryContext(const BigNumMontgomeryContext &other) = delete;
+  BigNumMontgomeryContext &operator=(const BigNumMontgomeryContext &other) = delete;
+  BigNumMontgomeryContext(BigNumMontgomeryContext &&other);
+  BigNumMontgomeryContext &operator=(BigNumMontgomeryContext &&other);
+  ~BigNumMontgomeryContext();
+
+ private:
+  class Impl;
+  unique_ptr<Impl> impl_;  // nullptr if the modulus isn't odd
+
   friend class BigNum;
 };
 
@@ -92,6 +112,10 @@ class BigNum {
 
   static void mod_exp(BigNum &r, const BigNum &a, const BigNum &p, const BigNum &m, BigNumContext &context);
 
+  // the same as mod_exp, but doesn't recompute the Montgomery representation of m
+  static void mod_exp(BigNum &r, const BigNum &a, const BigNum &p, const BigNum &m, BigNumContext &context,
+                      const BigNumMontgomeryContext &montgomery_context);
+
   static void gcd(BigNum &r, BigNum &a, BigNum &b, BigNumContext &context);
 
   static int compare(const BigNum &a, const BigNum &b);
@@ -101,6 +125,8 @@ class BigNum {
   unique_ptr<Impl> impl_;
 
   explicit BigNum(unique_ptr<Impl> &&impl);
+
+  friend class BigNumMontgomeryContext;
 };
 
 }  // namespace td
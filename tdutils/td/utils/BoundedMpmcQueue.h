@@ -0,0 +1,118 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+// Bounded MPMC queue
+// Ring buffer of cells with sequence numbers, so all memory is allocated in constructor.
+// Unlike MpmcQueue, push may fail if the queue is full, so try_push must be used, if consumers can wait for producers.
+// thread_id arguments are ignored and are accepted only for compatibility with MpmcQueue.
+
+#include "td/utils/common.h"
+#include "td/utils/logging.h"
+#include "td/utils/port/thread.h"
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace td {
+
+template <class T>
+class BoundedMpmcQueue {
+ public:
+  explicit BoundedMpmcQueue(size_t capacity) {
+    CHECK(capacity > 0);
+    size_t size = 1;
+    while (size < capacity) {
+      size *= 2;
+    }
+    mask_ = size - 1;
+    cells_ = std::make_unique<Cell[]>(size);
+    for (size_t i = 0; i < size; i++) {
+      cells_[i].seq.store(i, std::memory_order_relaxed);
+    }
+  }
+  BoundedMpmcQueue(const BoundedMpmcQueue &other) = delete;
+  BoundedMpmcQueue &operator=(const BoundedMpmcQueue &other) = delete;
+  BoundedMpmcQueue(BoundedMpmcQueue &&other) = delete;
+  BoundedMpmcQueue &operator=(BoundedMpmcQueue &&other) = delete;
+  ~BoundedMpmcQueue() = default;
+
+  size_t capacity() const {
+    return mask_ + 1;
+  }
+
+  // value is moved from only if the push succeeded
+  bool try_push(T &value, size_t thread_id = 0) {
+    auto pos = write_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      auto &cell = cells_[static_cast<size_t>(pos & mask_)];
+      auto seq = cell.seq.load(std::memory_order_acquire);
+      auto diff = static_cast<int64>(seq - pos);
+      if (diff == 0) {
+        if (write_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          cell.value = std::move(value);
+          cell.seq.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = write_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool try_pop(T &value, size_t thread_id = 0) {
+    auto pos = read_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      auto &cell = cells_[static_cast<size_t>(pos & mask_)];
+      auto seq = cell.seq.load(std::memory_order_acquire);
+      auto diff = static_cast<int64>(seq - (pos + 1));
+      if (diff == 0) {
+        if (read_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          value = std::move(cell.value);
+          cell.seq.store(pos + mask_ + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = read_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  void push(T value, size_t thread_id = 0) {
+    while (!try_push(value, thread_id)) {
+      td::this_thread::yield();
+    }
+  }
+
+  T pop(size_t thread_id = 0) {
+    T value;
+    while (!try_pop(value, thread_id)) {
+      td::this_thread::yield();
+    }
+    return value;
+  }
+
+ private:
+  struct Cell {
+    std::atomic<uint64> seq{0};
+    T value{};
+  };
+
+  std::atomic<uint64> write_pos_{0};
+  char pad[TD_CONCURRENCY_PAD - sizeof(std::atomic<uint64>)];
+  std::atomic<uint64> read_pos_{0};
+  char pad2[TD_CONCURRENCY_PAD - sizeof(std::atomic<uint64>)];
+  size_t mask_;
+  std::unique_ptr<Cell[]> cells_;
+};
+
+}  // namespace td
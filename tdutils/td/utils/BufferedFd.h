@@ -13,6 +13,7 @@
 #include "td/utils/Slice.h"
 #include "td/utils/Status.h"
 
+#include <array>
 #include <limits>
 
 namespace td {
@@ -100,15 +101,29 @@ Result<size_t> BufferedFdBase<FdT>::flush_read(size_t max_read) {
   return result;
 }
 
+namespace detail {
+// gathers many chain buffer nodes in one system call if FdT supports writev
+template <class FdT>
+auto write_chain_buffer(FdT &fd, ChainBufferReader &reader, int) -> decltype(fd.writev(nullptr, 0)) {
+  std::array<Slice, Fd::MAX_WRITEV_SLICES> slices;
+  auto slice_count = reader.prepare_readv(slices.data(), slices.size());
+  return fd.writev(slices.data(), slice_count);
+}
+
+template <class FdT>
+Result<size_t> write_chain_buffer(FdT &fd, ChainBufferReader &reader, long) {
+  return fd.write(reader.prepare_read());
+}
+}  // namespace detail
+
 template <class FdT>
 Result<size_t> BufferedFdBase<FdT>::flush_write() {
   size_t result = 0;
   // TODO: sync on demand
   write_->sync_with_writer();
   while (!write_->empty() && ::td::can_write(*this)) {
-    Slice slice = write_->prepare_read();
-    TRY_RESULT(x, FdT::write(slice));
-    write_->confirm_read(x);
+    TRY_RESULT(x, detail::write_chain_buffer<FdT>(*this, *write_, 0));
+    write_->advance(x);
     result += x;
   }
   return result;
@@ -0,0 +1,144 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/logging.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+
+namespace td {
+
+// Epoch-based memory reclamation
+// A thread must hold a Locker while it accesses shared pointers. Unlike HazardPointers, the Locker protects all
+// pointers read during its lifetime, and locking costs one store to a thread-local slot.
+// An object retired in epoch E is deleted when the global epoch reaches E + 2, because the epoch can't be advanced
+// while some thread is still inside a critical section started in a previous epoch.
+// Each thread_id must be used by only one thread at a time.
+template <class T>
+class EpochBasedMemoryReclamation {
+ public:
+  explicit EpochBasedMemoryReclamation(size_t threads_n) : threads_(threads_n) {
+  }
+  EpochBasedMemoryReclamation(const EpochBasedMemoryReclamation &other) = delete;
+  EpochBasedMemoryReclamation &operator=(const EpochBasedMemoryReclamation &other) = delete;
+  EpochBasedMemoryReclamation(EpochBasedMemoryReclamation &&other) = delete;
+  EpochBasedMemoryReclamation &operator=(EpochBasedMemoryReclamation &&other) = delete;
+  ~EpochBasedMemoryReclamation() = default;
+
+  class Locker {
+   public:
+    Locker(const Locker &other) = delete;
+    Locker &operator=(const Locker &other) = delete;
+    Locker(Locker &&other) : state_(other.state_) {
+      other.state_ = nullptr;
+    }
+    Locker &operator=(Locker &&other) = delete;
+    ~Locker() {
+      unlock();
+    }
+
+    void unlock() {
+      if (state_ != nullptr) {
+        state_->store(0, std::memory_order_release);
+        state_ = nullptr;
+      }
+    }
+
+   private:
+    friend class EpochBasedMemoryReclamation;
+    explicit Locker(std::atomic<uint64> &state) : state_(&state) {
+    }
+    std::atomic<uint64> *state_;
+  };
+
+  Locker get_locker(size_t thread_id) {
+    auto &state = get_thread(thread_id).state;
+    CHECK(state.load(std::memory_order_relaxed) == 0);
+    state.store(epoch_.load(std::memory_order_acquire) * 2 + 1, std::memory_order_relaxed);
+    // pointers must be loaded only after the epoch is published
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return Locker(state);
+  }
+
+  // the object will be deleted, when no thread can access it anymore
+  void retire(size_t thread_id, T *ptr) {
+    auto &data = get_thread(thread_id);
+    auto epoch = epoch_.load(std::memory_order_acquire);
+    auto &to_delete = data.to_delete[epoch % 3];
+    if (to_delete.epoch != epoch) {
+      // all objects were retired at least 3 epochs ago
+      to_delete.clear();
+      to_delete.epoch = epoch;
+    }
+    to_delete.ptrs.push_back(std::unique_ptr<T>(ptr));
+    try_advance_epoch(epoch);
+  }
+
+  // deletes all retired objects, which can be deleted; must be called only by the thread thread_id
+  void gc(size_t thread_id) {
+    auto &data = get_thread(thread_id);
+    auto epoch = epoch_.load(std::memory_order_acquire);
+    try_advance_epoch(epoch);
+    epoch = epoch_.load(std::memory_order_acquire);
+    for (auto &to_delete : data.to_delete) {
+      if (to_delete.epoch + 2 <= epoch) {
+        to_delete.clear();
+      }
+    }
+  }
+
+  size_t to_delete_size_unsafe() const {
+    size_t res = 0;
+    for (auto &thread : threads_) {
+      for (auto &to_delete : thread.to_delete) {
+        res += to_delete.ptrs.size();
+      }
+    }
+    return res;
+  }
+
+ private:
+  struct ToDelete {
+    uint64 epoch = 0;
+    std::vector<std::unique_ptr<T>> ptrs;
+
+    void clear() {
+      ptrs.clear();
+    }
+  };
+  struct ThreadData {
+    // 0 if the thread isn't in a critical section, 2 * epoch + 1 otherwise
+    std::atomic<uint64> state{0};
+    char pad[TD_CONCURRENCY_PAD - sizeof(std::atomic<uint64>)];
+
+    std::array<ToDelete, 3> to_delete;
+    char pad2[TD_CONCURRENCY_PAD];
+  };
+  std::atomic<uint64> epoch_{0};
+  char pad[TD_CONCURRENCY_PAD - sizeof(std::atomic<uint64>)];
+  std::vector<ThreadData> threads_;
+
+  ThreadData &get_thread(size_t thread_id) {
+    CHECK(thread_id < threads_.size());
+    return threads_[thread_id];
+  }
+
+  void try_advance_epoch(uint64 epoch) {
+    for (auto &thread : threads_) {
+      auto state = thread.state.load();
+      if (state != 0 && state != epoch * 2 + 1) {
+        return;
+      }
+    }
+    epoch_.compare_exchange_strong(epoch, epoch + 1);
+  }
+};
+
+}  // namespace td
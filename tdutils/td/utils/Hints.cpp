@@ -9,7 +9,6 @@
 #include "td/utils/logging.h"
 #include "td/utils/misc.h"
 #include "td/utils/Slice.h"
-#include "td/utils/unicode.h"
 #include "td/utils/utf8.h"
 
 #include <algorithm>
@@ -17,33 +16,13 @@
 namespace td {
 
 vector<string> Hints::get_words(Slice name) {
-  bool in_word = false;
-  string word;
+  auto prepared_name = utf8_prepare_search_string(name);
   vector<string> words;
-  auto pos = name.ubegin();
-  auto end = name.uend();
-  while (pos != end) {
-    uint32 code;
-    pos = next_utf8_unsafe(pos, &code);
-
-    code = prepare_search_character(code);
-    if (code == 0) {
-      continue;
-    }
-    if (code == ' ') {
-      if (in_word) {
-        words.push_back(std::move(word));
-        word.clear();
-        in_word = false;
-      }
-    } else {
-      in_word = true;
-      append_utf8_character(word, code);
+  for (auto word : full_split(Slice(prepared_name), ' ')) {
+    if (!word.empty()) {
+      words.push_back(word.str());
     }
   }
-  if (in_word) {
-    words.push_back(std::move(word));
-  }
   std::sort(words.begin(), words.end());
 
   size_t new_words_size = 0;
@@ -0,0 +1,92 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/LogHistogram.h"
+
+#include "td/utils/misc.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace td {
+
+constexpr int LogHistogram::SUB_BUCKET_BITS;
+constexpr int LogHistogram::SUB_BUCKET_COUNT;
+
+size_t LogHistogram::get_bucket(uint64 value) {
+  if (value < static_cast<uint64>(SUB_BUCKET_COUNT)) {
+    return static_cast<size_t>(value);
+  }
+  int highest_bit = SUB_BUCKET_BITS;
+  while (highest_bit < 63 && (value >> (highest_bit + 1)) != 0) {
+    highest_bit++;
+  }
+  auto shift = highest_bit - SUB_BUCKET_BITS;
+  auto sub_bucket = static_cast<size_t>((value >> shift) & (SUB_BUCKET_COUNT - 1));
+  return static_cast<size_t>(shift + 1) * SUB_BUCKET_COUNT + sub_bucket;
+}
+
+uint64 LogHistogram::get_bucket_max_value(size_t bucket) {
+  if (bucket < static_cast<size_t>(SUB_BUCKET_COUNT)) {
+    return bucket;
+  }
+  auto shift = static_cast<int>(bucket / SUB_BUCKET_COUNT) - 1;
+  auto sub_bucket = static_cast<uint64>(bucket % SUB_BUCKET_COUNT);
+  auto min_value = (static_cast<uint64>(SUB_BUCKET_COUNT) + sub_bucket) << shift;
+  return min_value + ((static_cast<uint64>(1) << shift) - 1);
+}
+
+void LogHistogram::add(uint64 value, uint64 count) {
+  if (count == 0) {
+    return;
+  }
+  auto bucket = get_bucket(value);
+  if (bucket >= buckets_.size()) {
+    buckets_.resize(bucket + 1);
+  }
+  buckets_[bucket] += count;
+  count_ += count;
+  sum_ += value * count;
+  max_ = std::max(max_, value);
+}
+
+void LogHistogram::merge(const LogHistogram &other) {
+  if (other.buckets_.size() > buckets_.size()) {
+    buckets_.resize(other.buckets_.size());
+  }
+  for (size_t i = 0; i < other.buckets_.size(); i++) {
+    buckets_[i] += other.buckets_[i];
+  }
+  count_ += other.count_;
+  sum_ += other.sum_;
+  max_ = std::max(max_, other.max_);
+}
+
+void LogHistogram::clear() {
+  buckets_.clear();
+  count_ = 0;
+  sum_ = 0;
+  max_ = 0;
+}
+
+uint64 LogHistogram::get_percentile(double percentile) const {
+  if (count_ == 0) {
+    return 0;
+  }
+  auto rank = static_cast<uint64>(std::ceil(static_cast<double>(count_) * percentile / 100));
+  rank = clamp(rank, static_cast<uint64>(1), count_);
+
+  uint64 seen_count = 0;
+  for (size_t i = 0; i < buckets_.size(); i++) {
+    seen_count += buckets_[i];
+    if (seen_count >= rank) {
+      return std::min(get_bucket_max_value(i), max_);
+    }
+  }
+  return max_;
+}
+
+}  // namespace td
@@ -0,0 +1,52 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+
+namespace td {
+
+// HdrHistogram-like histogram of non-negative integer values
+// every power of two range is split into SUB_BUCKET_COUNT equal buckets, so values are stored
+// with relative error less than 1 / SUB_BUCKET_COUNT; memory is proportional to the logarithm of the maximum value
+class LogHistogram {
+ public:
+  static constexpr int SUB_BUCKET_BITS = 3;
+  static constexpr int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+
+  void add(uint64 value, uint64 count = 1);
+
+  void merge(const LogHistogram &other);
+
+  void clear();
+
+  uint64 get_count() const {
+    return count_;
+  }
+
+  uint64 get_sum() const {
+    return sum_;
+  }
+
+  uint64 get_max() const {
+    return max_;
+  }
+
+  // returns an upper bound for the value at the given percentile from 0 to 100; returns 0 for an empty histogram
+  uint64 get_percentile(double percentile) const;
+
+ private:
+  vector<uint64> buckets_;
+  uint64 count_ = 0;
+  uint64 sum_ = 0;
+  uint64 max_ = 0;
+
+  static size_t get_bucket(uint64 value);
+  static uint64 get_bucket_max_value(size_t bucket);
+};
+
+}  // namespace td
@@ -7,12 +7,22 @@
 #pragma once
 
 #include "td/utils/common.h"
+#include "td/utils/port/config.h"
 #include "td/utils/port/thread.h"
 
 #include <atomic>
 #include <condition_variable>
 #include <mutex>
 
+#if TD_LINUX || TD_ANDROID
+#define TD_MPMC_WAITER_USE_FUTEX 1
+#include <climits>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace td {
 class MpmcWaiter {
  public:
@@ -44,10 +54,17 @@ class MpmcWaiter {
     } else {
       auto state = state_.load(std::memory_order_acquire);
       if (State::still_sleepy(state, worker_id)) {
+#if TD_MPMC_WAITER_USE_FUTEX
+        // the kernel checks that the state is still asleep, so a notification can't be lost
+        if (state_.compare_exchange_strong(state, State::asleep(), std::memory_order_acq_rel)) {
+          futex(FUTEX_WAIT_PRIVATE, State::asleep());
+        }
+#else
         std::unique_lock<std::mutex> lock(mutex_);
         if (state_.compare_exchange_strong(state, State::asleep(), std::memory_order_acq_rel)) {
           condition_variable_.wait(lock);
         }
+#endif
       }
       return 0;
     }
@@ -90,14 +107,26 @@ class MpmcWaiter {
   };
   enum { RoundsTillSleepy = 32, RoundsTillAsleep = 64 };
   std::atomic<uint32> state_{State::awake()};
+#if TD_MPMC_WAITER_USE_FUTEX
+  static_assert(sizeof(std::atomic<uint32>) == sizeof(uint32), "Can't use std::atomic<uint32> as a futex");
+
+  void futex(int op, uint32 value) {
+    syscall(SYS_futex, reinterpret_cast<uint32 *>(&state_), op, value, nullptr, nullptr, 0);
+  }
+#else
   std::mutex mutex_;
   std::condition_variable condition_variable_;
+#endif
 
   void notify_cold() {
     auto old_state = state_.exchange(State::awake(), std::memory_order_release);
     if (State::is_asleep(old_state)) {
+#if TD_MPMC_WAITER_USE_FUTEX
+      futex(FUTEX_WAKE_PRIVATE, INT_MAX);
+#else
       std::lock_guard<std::mutex> guard(mutex_);
       condition_variable_.notify_all();
+#endif
     }
   }
 };
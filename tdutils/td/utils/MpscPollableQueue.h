@@ -6,6 +6,7 @@
 //
 #pragma once
 
+#include "td/utils/common.h"
 #include "td/utils/misc.h"
 #include "td/utils/port/EventFd.h"
 
@@ -15,32 +16,44 @@
 #include <sched.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <utility>
 
-#include <td/utils/SpinLock.h>
-
 namespace td {
 // interface like in PollableQueue
+// writers push values to a lock-free stack, and the reader takes all of them at once
 template <class ValueT>
 class MpscPollableQueue {
  public:
+  MpscPollableQueue() = default;
+  MpscPollableQueue(const MpscPollableQueue &) = delete;
+  MpscPollableQueue &operator=(const MpscPollableQueue &) = delete;
+  MpscPollableQueue(MpscPollableQueue &&) = delete;
+  MpscPollableQueue &operator=(MpscPollableQueue &&) = delete;
+  ~MpscPollableQueue() {
+    delete_nodes(head_.exchange(nullptr, std::memory_order_acquire));
+  }
+
   int reader_wait_nonblock() {
     auto ready = reader_vector_.size() - reader_pos_;
     if (ready != 0) {
       return narrow_cast<int>(ready);
     }
 
-    auto guard = lock_.lock();
-    if (writer_vector_.empty()) {
+    auto head = head_.load(std::memory_order_acquire);
+    while (head == nullptr) {
       event_fd_.acquire();
-      wait_event_fd_ = true;
+      if (head_.compare_exchange_weak(head, get_waiting_tag(), std::memory_order_acq_rel,
+                                      std::memory_order_acquire)) {
+        return 0;
+      }
+    }
+    if (head == get_waiting_tag()) {
       return 0;
-    } else {
-      reader_vector_.clear();
-      reader_pos_ = 0;
-      std::swap(writer_vector_, reader_vector_);
-      return narrow_cast<int>(reader_vector_.size());
     }
+    return reader_take_all();
   }
   ValueT reader_get_unsafe() {
     return std::move(reader_vector_[reader_pos_++]);
@@ -49,12 +62,23 @@ class MpscPollableQueue {
     //nop
   }
   void writer_put(ValueT value) {
-    auto guard = lock_.lock();
-    writer_vector_.push_back(std::move(value));
-    if (wait_event_fd_) {
-      wait_event_fd_ = false;
-      event_fd_.release();
+    auto node = new Node{std::move(value), nullptr};
+    push(node, node);
+  }
+  // all values are added at once, so the reader will be woken up at most once
+  void writer_put_many(std::vector<ValueT> values) {
+    if (values.empty()) {
+      return;
     }
+    Node *first = nullptr;
+    Node *last = nullptr;
+    for (auto &value : values) {
+      first = new Node{std::move(value), first};
+      if (last == nullptr) {
+        last = first;
+      }
+    }
+    push(first, last);
   }
   EventFd &reader_get_event_fd() {
     return event_fd_;
@@ -69,8 +93,10 @@ class MpscPollableQueue {
   void destroy() {
     if (!event_fd_.empty()) {
       event_fd_.close();
-      wait_event_fd_ = false;
-      writer_vector_.clear();
+      auto head = head_.exchange(nullptr, std::memory_order_acquire);
+      if (head != get_waiting_tag()) {
+        delete_nodes(head);
+      }
       reader_vector_.clear();
       reader_pos_ = 0;
     }
@@ -82,6 +108,9 @@ class MpscPollableQueue {
     int res;
 
     while ((res = reader_wait_nonblock()) == 0) {
+      if (reader_spin()) {
+        continue;
+      }
       // TODO: reader_flush?
       pollfd fd;
       fd.fd = reader_get_event_fd().get_fd().get_native_fd();
@@ -93,12 +122,76 @@ class MpscPollableQueue {
 #endif
 
  private:
-  SpinLock lock_;
-  bool wait_event_fd_{false};
+  struct Node {
+    ValueT value;
+    Node *next;
+  };
+
+  // the reader is going to sleep and must be woken up through event_fd_
+  static Node *get_waiting_tag() {
+    return reinterpret_cast<Node *>(static_cast<std::uintptr_t>(1));
+  }
+
+  std::atomic<Node *> head_{nullptr};
+  char pad_[64 - sizeof(std::atomic<Node *>)];
   EventFd event_fd_;
-  std::vector<ValueT> writer_vector_;
   std::vector<ValueT> reader_vector_;
   size_t reader_pos_{0};
+  int spin_limit_{MIN_SPIN_LIMIT};
+
+  static constexpr int MIN_SPIN_LIMIT = 1;
+  static constexpr int MAX_SPIN_LIMIT = 1 << 10;
+
+  void push(Node *first, Node *last) {
+    auto head = head_.load(std::memory_order_relaxed);
+    do {
+      last->next = head == get_waiting_tag() ? nullptr : head;
+    } while (!head_.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+    if (head == get_waiting_tag()) {
+      event_fd_.release();
+    }
+  }
+
+  int reader_take_all() {
+    auto head = head_.exchange(nullptr, std::memory_order_acquire);
+    reader_vector_.clear();
+    reader_pos_ = 0;
+    for (auto node = head; node != nullptr;) {
+      reader_vector_.push_back(std::move(node->value));
+      auto next = node->next;
+      delete node;
+      node = next;
+    }
+    std::reverse(reader_vector_.begin(), reader_vector_.end());
+    return narrow_cast<int>(reader_vector_.size());
+  }
+
+  static void delete_nodes(Node *node) {
+    while (node != nullptr && node != get_waiting_tag()) {
+      auto next = node->next;
+      delete node;
+      node = next;
+    }
+  }
+
+#if !TD_WINDOWS
+  // waits for a writer for some time before going to sleep; the time is increased if the wait succeeds
+  bool reader_spin() {
+    for (int i = 0; i < spin_limit_; i++) {
+      if (head_.load(std::memory_order_relaxed) != get_waiting_tag()) {
+        if (spin_limit_ < MAX_SPIN_LIMIT) {
+          spin_limit_ *= 2;
+        }
+        return true;
+      }
+      sched_yield();
+    }
+    if (spin_limit_ > MIN_SPIN_LIMIT) {
+      spin_limit_ /= 2;
+    }
+    return false;
+  }
+#endif
 };
 
 }  // namespace td
@@ -0,0 +1,90 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/EpochBasedMemoryReclamation.h"
+#include "td/utils/logging.h"
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace td {
+
+// RCU-style holder of an immutable value
+// Readers get the current snapshot without locks and allocations. Writers replace the whole snapshot,
+// and the old one is deleted once all readers, which could see it, are gone.
+// Each reader thread_id must be used by only one thread at a time, and a reader must not be nested in another
+// reader with the same thread_id.
+template <class T>
+class SharedSnapshot {
+ public:
+  SharedSnapshot(size_t threads_n, unique_ptr<T> value) : ebr_(threads_n), ptr_(value.release()) {
+    CHECK(ptr_.load(std::memory_order_relaxed) != nullptr);
+  }
+  SharedSnapshot(const SharedSnapshot &other) = delete;
+  SharedSnapshot &operator=(const SharedSnapshot &other) = delete;
+  SharedSnapshot(SharedSnapshot &&other) = delete;
+  SharedSnapshot &operator=(SharedSnapshot &&other) = delete;
+  ~SharedSnapshot() {
+    delete ptr_.load(std::memory_order_relaxed);
+  }
+
+  class Reader {
+   public:
+    const T &operator*() const {
+      return *ptr_;
+    }
+    const T *operator->() const {
+      return ptr_;
+    }
+
+   private:
+    friend class SharedSnapshot;
+    Reader(typename EpochBasedMemoryReclamation<T>::Locker locker, const T *ptr)
+        : locker_(std::move(locker)), ptr_(ptr) {
+    }
+    typename EpochBasedMemoryReclamation<T>::Locker locker_;
+    const T *ptr_;
+  };
+
+  // the snapshot stays valid until the Reader is destroyed
+  Reader get(size_t thread_id) {
+    auto locker = ebr_.get_locker(thread_id);
+    auto *ptr = ptr_.load(std::memory_order_acquire);
+    return Reader(std::move(locker), ptr);
+  }
+
+  void set(size_t thread_id, unique_ptr<T> value) {
+    CHECK(value != nullptr);
+    auto *old_ptr = ptr_.exchange(value.release(), std::memory_order_acq_rel);
+    ebr_.retire(thread_id, old_ptr);
+  }
+
+  // copies the current snapshot, modifies it and publishes the result; concurrent updates must be serialized
+  template <class F>
+  void update(size_t thread_id, F &&f) {
+    unique_ptr<T> value;
+    {
+      auto reader = get(thread_id);
+      value = make_unique<T>(*reader);
+    }
+    f(*value);
+    set(thread_id, std::move(value));
+  }
+
+  void gc(size_t thread_id) {
+    ebr_.gc(thread_id);
+  }
+
+ private:
+  EpochBasedMemoryReclamation<T> ebr_;
+  std::atomic<T *> ptr_;
+};
+
+}  // namespace td
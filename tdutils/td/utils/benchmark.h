@@ -6,13 +6,18 @@
 //
 #pragma once
 
+#include "td/utils/common.h"
 #include "td/utils/format.h"
 #include "td/utils/logging.h"
 #include "td/utils/port/Clocks.h"
 
+#include <algorithm>
 #include <cmath>
+#include <functional>
+#include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #define BENCH(name, desc)                          \
   class name##Bench : public ::td::Benchmark {     \
@@ -24,6 +29,23 @@
   };                                               \
   void name##Bench::run(int n)
 
+// Defines body of a benchmark suite, which is a standalone executable, unless TD_BENCH_RUNNER is defined.
+// In the latter case the suite is registered to be run by the td_bench runner
+#if TD_BENCH_RUNNER
+#define BENCH_SUITE(name)                                                                      \
+  static void bench_suite_##name();                                                            \
+  static ::td::BenchmarkSuiteRegistrar bench_suite_registrar_##name(#name, bench_suite_##name); \
+  static void bench_suite_##name()
+#else
+#define BENCH_SUITE(name)          \
+  static void bench_suite_##name(); \
+  int main() {                     \
+    bench_suite_##name();          \
+    return 0;                      \
+  }                                \
+  static void bench_suite_##name()
+#endif
+
 namespace td {
 
 #if TD_MSVC
@@ -83,7 +105,28 @@ inline std::pair<double, double> bench_n(Benchmark &&b, int n) {
   return bench_n(b, n);
 }
 
-inline void bench(Benchmark &b, double max_time = 1.0) {
+struct BenchmarkOptions {
+  double max_time = 1.0;  // approximate duration of one pass
+  int warmup_count = 0;   // number of discarded passes after calibration
+  int pass_count = 2;     // number of measured passes
+  std::function<int64()> get_allocation_count;  // optional
+};
+
+struct BenchmarkStat {
+  int n = 0;  // number of iterations in a pass
+  // statistics of number of iterations per second over the passes
+  double mean = 0;
+  double stddev = 0;
+  double min = 0;
+  double max = 0;
+  double p50 = 0;
+  double p90 = 0;
+  double p99 = 0;
+  double allocations_per_iteration = -1;  // negative if unknown
+};
+
+inline BenchmarkStat bench_stat(Benchmark &b, const BenchmarkOptions &options) {
+  auto max_time = options.max_time;
   int n = 1;
   double pass_time = 0;
   double total_pass_time = 0;
@@ -91,31 +134,105 @@ inline void bench(Benchmark &b, double max_time = 1.0) {
     n *= 2;
     std::tie(pass_time, total_pass_time) = bench_n(b, n);
   }
-  pass_time = n / pass_time;
-
-  int pass_cnt = 2;
-  double sum = pass_time;
-  double square_sum = pass_time * pass_time;
-  double min_pass_time = pass_time;
-  double max_pass_time = pass_time;
-
-  for (int i = 1; i < pass_cnt; i++) {
-    pass_time = n / bench_n(b, n).first;
-    sum += pass_time;
-    square_sum += pass_time * pass_time;
-    if (pass_time < min_pass_time) {
-      min_pass_time = pass_time;
-    }
-    if (pass_time > max_pass_time) {
-      max_pass_time = pass_time;
+
+  for (int i = 0; i < options.warmup_count; i++) {
+    bench_n(b, n);
+  }
+
+  std::vector<double> passes;
+  if (options.warmup_count == 0 && !options.get_allocation_count) {
+    // reuse the calibration pass
+    passes.push_back(n / pass_time);
+  }
+  int64 allocation_count = 0;
+  while (static_cast<int>(passes.size()) < options.pass_count) {
+    b.start_up_n(n);
+    int64 begin_allocation_count = options.get_allocation_count ? options.get_allocation_count() : 0;
+    double t = -Clocks::monotonic();
+    b.run(n);
+    t += Clocks::monotonic();
+    if (options.get_allocation_count) {
+      allocation_count += options.get_allocation_count() - begin_allocation_count;
     }
+    b.tear_down();
+    passes.push_back(n / t);
+  }
+
+  BenchmarkStat stat;
+  stat.n = n;
+  double sum = 0;
+  double square_sum = 0;
+  for (auto pass : passes) {
+    sum += pass;
+    square_sum += pass * pass;
+  }
+  auto pass_count = static_cast<double>(passes.size());
+  stat.mean = sum / pass_count;
+  stat.stddev = std::sqrt(std::max(square_sum / pass_count - stat.mean * stat.mean, 0.0));
+
+  std::sort(passes.begin(), passes.end());
+  stat.min = passes.front();
+  stat.max = passes.back();
+  auto get_percentile = [&passes](int percent) {
+    auto rank = (passes.size() * percent + 99) / 100;
+    return passes[rank == 0 ? 0 : rank - 1];
+  };
+  stat.p50 = get_percentile(50);
+  stat.p90 = get_percentile(90);
+  stat.p99 = get_percentile(99);
+  if (options.get_allocation_count) {
+    stat.allocations_per_iteration = static_cast<double>(allocation_count) / (pass_count * n);
+  }
+  return stat;
+}
+
+// intercepts all bench calls if set
+class BenchmarkRunner {
+ public:
+  BenchmarkRunner() = default;
+  BenchmarkRunner(const BenchmarkRunner &) = delete;
+  BenchmarkRunner &operator=(const BenchmarkRunner &) = delete;
+  BenchmarkRunner(BenchmarkRunner &&) = delete;
+  BenchmarkRunner &operator=(BenchmarkRunner &&) = delete;
+  virtual ~BenchmarkRunner() = default;
+
+  virtual void run(Benchmark &b, double max_time) = 0;
+};
+
+inline BenchmarkRunner *&get_benchmark_runner_ref() {
+  static BenchmarkRunner *runner = nullptr;
+  return runner;
+}
+
+inline void set_benchmark_runner(BenchmarkRunner *runner) {
+  get_benchmark_runner_ref() = runner;
+}
+
+inline std::vector<std::pair<std::string, void (*)()>> &get_benchmark_suites() {
+  static std::vector<std::pair<std::string, void (*)()>> suites;
+  return suites;
+}
+
+class BenchmarkSuiteRegistrar {
+ public:
+  BenchmarkSuiteRegistrar(const char *name, void (*suite)()) {
+    get_benchmark_suites().emplace_back(name, suite);
+  }
+};
+
+inline void bench(Benchmark &b, double max_time = 1.0) {
+  auto runner = get_benchmark_runner_ref();
+  if (runner != nullptr) {
+    return runner->run(b, max_time);
   }
-  double avg = sum / pass_cnt;
-  double d = sqrt(square_sum / pass_cnt - avg * avg);
 
-  LOG(ERROR, "Bench [%40s]:\t%.3lf[%.3lf-%.3lf] ops/sec,\t", b.get_description().c_str(), avg, min_pass_time,
-      max_pass_time)
-      << format::as_time(1 / avg) << (PSLICE(" [d = %.6lf]", d));
+  BenchmarkOptions options;
+  options.max_time = max_time;
+  auto stat = bench_stat(b, options);
+
+  LOG(ERROR, "Bench [%40s]:\t%.3lf[%.3lf-%.3lf] ops/sec,\t", b.get_description().c_str(), stat.mean, stat.min,
+      stat.max)
+      << format::as_time(1 / stat.mean) << (PSLICE(" [d = %.6lf]", stat.stddev));
 }
 
 inline void bench(Benchmark &&b, double max_time = 1.0) {
@@ -62,6 +62,12 @@ BufferAllocator::ReaderPtr BufferAllocator::create_reader_fast(size_t size) {
   return ReaderPtr(buffer_raw);
 }
 
+void BufferAllocator::clear_thread_local() {
+  if (buffer_raw_tls != nullptr) {
+    buffer_raw_tls->buffer_raw.reset();
+  }
+}
+
 BufferAllocator::ReaderPtr BufferAllocator::create_reader(const WriterPtr &raw) {
   raw->was_reader_ = true;
   raw->ref_cnt_.fetch_add(1, std::memory_order_acq_rel);
@@ -532,6 +532,24 @@ class ChainBufferReader {
     begin_.confirm_read(size);
   }
 
+  // fills slices with up to max_slice_count consecutive parts of the buffer; returns the number of filled slices
+  size_t prepare_readv(Slice *slices, size_t max_slice_count) {
+    auto it = begin_.clone();
+    size_t left = size();
+    size_t slice_count = 0;
+    while (slice_count < max_slice_count && left != 0) {
+      auto slice = it.prepare_read();
+      if (slice.empty()) {
+        break;
+      }
+      slice.truncate(left);
+      slices[slice_count++] = slice;
+      left -= slice.size();
+      it.confirm_read(slice.size());
+    }
+    return slice_count;
+  }
+
   size_t advance(size_t offset, MutableSlice dest = MutableSlice()) {
     CHECK(offset <= size());
     return begin_.advance(offset, dest);
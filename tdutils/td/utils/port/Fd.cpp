@@ -14,11 +14,14 @@
 
 #if TD_PORT_POSIX
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 
 #include <fcntl.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #endif
@@ -35,6 +38,8 @@
 
 namespace td {
 
+constexpr size_t Fd::MAX_WRITEV_SLICES;
+
 #if TD_PORT_POSIX
 
 Fd::InfoSet::InfoSet() {
@@ -292,11 +297,27 @@ Result<size_t> Fd::write_unsafe(Slice slice) {
 Result<size_t> Fd::write(Slice slice) {
   int native_fd = get_native_fd();
   auto write_res = skip_eintr([&] { return ::write(native_fd, slice.begin(), slice.size()); });
-  auto write_errno = errno;
+  return on_write_result(write_res, errno);
+}
+
+Result<size_t> Fd::writev(const Slice *slices, size_t slice_count) {
+  int native_fd = get_native_fd();
+  std::array<iovec, MAX_WRITEV_SLICES> iov;
+  slice_count = std::min(slice_count, MAX_WRITEV_SLICES);
+  for (size_t i = 0; i < slice_count; i++) {
+    iov[i].iov_base = const_cast<char *>(slices[i].begin());
+    iov[i].iov_len = slices[i].size();
+  }
+  auto write_res = skip_eintr([&] { return ::writev(native_fd, iov.data(), static_cast<int>(slice_count)); });
+  return on_write_result(write_res, errno);
+}
+
+Result<size_t> Fd::on_write_result(int64 write_res, int write_errno) {
   if (write_res >= 0) {
     return narrow_cast<size_t>(write_res);
   }
 
+  int native_fd = get_native_fd();
   if (write_errno == EAGAIN
 #if EAGAIN != EWOULDBLOCK
       || write_errno == EWOULDBLOCK
@@ -941,6 +962,19 @@ Result<size_t> Fd::write(Slice slice) {
   return impl_->write(slice);
 }
 
+Result<size_t> Fd::writev(const Slice *slices, size_t slice_count) {
+  CHECK(!empty());
+  size_t result = 0;
+  for (size_t i = 0; i < slice_count && i < MAX_WRITEV_SLICES; i++) {
+    TRY_RESULT(written, impl_->write(slices[i]));
+    result += written;
+    if (written != slices[i].size()) {
+      break;
+    }
+  }
+  return result;
+}
+
 bool Fd::empty() const {
   return !impl_;
 }
@@ -96,8 +96,12 @@ class Fd {
   Status get_pending_error() TD_WARN_UNUSED_RESULT;
 
   Result<size_t> write(Slice slice) TD_WARN_UNUSED_RESULT;
+  // writes no more than MAX_WRITEV_SLICES slices at once
+  Result<size_t> writev(const Slice *slices, size_t slice_count) TD_WARN_UNUSED_RESULT;
   Result<size_t> read(MutableSlice slice) TD_WARN_UNUSED_RESULT;
 
+  static constexpr size_t MAX_WRITEV_SLICES = 64;
+
   Status set_is_blocking(bool is_blocking);
 
 #if TD_PORT_POSIX
@@ -149,6 +153,7 @@ class Fd {
   static Fd stdin_;
 
   void update_flags_inner(int32 new_flags, bool notify_flag);
+  Result<size_t> on_write_result(int64 write_res, int write_errno);
   Info *get_info();
   const Info *get_info() const;
   void clear_info();
@@ -0,0 +1,198 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/port/IoUring.h"
+
+char disable_linker_warning_about_empty_file_io_uring_cpp TD_UNUSED;
+
+#ifdef TD_HAVE_IO_URING
+
+#include "td/utils/logging.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <csignal>
+#include <endian.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace td {
+
+static int io_uring_setup(unsigned entries, io_uring_params *params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+static int io_uring_enter(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags, const void *arg,
+                          size_t arg_size) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, arg, arg_size));
+}
+
+IoUring::~IoUring() {
+  close();
+}
+
+Status IoUring::init(uint32 entries) {
+  CHECK(empty());
+  io_uring_params params;
+  std::memset(&params, 0, sizeof(params));
+  int ring_fd = io_uring_setup(entries, &params);
+  if (ring_fd < 0) {
+    return OS_ERROR("io_uring_setup failed");
+  }
+  ring_fd_ = ring_fd;
+
+  const uint32 required_features = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG |
+                                   IORING_FEAT_RSRC_TAGS;
+  if ((params.features & required_features) != required_features) {
+    close();
+    return Status::Error(PSLICE() << "io_uring is too old: features = " << params.features);
+  }
+
+  sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  sq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+  sq_ring_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                  IORING_OFF_SQ_RING);
+  if (sq_ring_ == MAP_FAILED) {
+    sq_ring_ = nullptr;
+    auto status = OS_ERROR("Failed to mmap io_uring rings");
+    close();
+    return status;
+  }
+  // with IORING_FEAT_SINGLE_MMAP both rings share the mapping
+  cq_ring_ = sq_ring_;
+
+  sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+  auto sqes = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+  if (sqes == MAP_FAILED) {
+    auto status = OS_ERROR("Failed to mmap io_uring submission queue entries");
+    close();
+    return status;
+  }
+  sqes_ = static_cast<io_uring_sqe *>(sqes);
+
+  auto sq_ring = static_cast<char *>(sq_ring_);
+  sq_head_ = reinterpret_cast<unsigned *>(sq_ring + params.sq_off.head);
+  sq_tail_ = reinterpret_cast<unsigned *>(sq_ring + params.sq_off.tail);
+  sq_array_ = reinterpret_cast<unsigned *>(sq_ring + params.sq_off.array);
+  sq_ring_mask_ = *reinterpret_cast<unsigned *>(sq_ring + params.sq_off.ring_mask);
+  sq_ring_entries_ = *reinterpret_cast<unsigned *>(sq_ring + params.sq_off.ring_entries);
+
+  auto cq_ring = static_cast<char *>(cq_ring_);
+  cq_head_ = reinterpret_cast<unsigned *>(cq_ring + params.cq_off.head);
+  cq_tail_ = reinterpret_cast<unsigned *>(cq_ring + params.cq_off.tail);
+  cqes_ = reinterpret_cast<io_uring_cqe *>(cq_ring + params.cq_off.cqes);
+  cq_ring_mask_ = *reinterpret_cast<unsigned *>(cq_ring + params.cq_off.ring_mask);
+  return Status::OK();
+}
+
+void IoUring::close() {
+  if (sqes_ != nullptr) {
+    munmap(sqes_, sqes_size_);
+    sqes_ = nullptr;
+  }
+  if (sq_ring_ != nullptr) {
+    munmap(sq_ring_, sq_ring_size_);
+    sq_ring_ = nullptr;
+    cq_ring_ = nullptr;
+  }
+  if (ring_fd_ != -1) {
+    ::close(ring_fd_);
+    ring_fd_ = -1;
+  }
+  pending_submit_count_ = 0;
+}
+
+io_uring_sqe *IoUring::get_sqe(uint8 opcode, int native_fd, uint64 user_data) {
+  auto head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+  auto tail = *sq_tail_;
+  if (tail - head >= sq_ring_entries_) {
+    return nullptr;
+  }
+  auto sqe = &sqes_[tail & sq_ring_mask_];
+  std::memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = opcode;
+  sqe->fd = native_fd;
+  sqe->user_data = user_data;
+  return sqe;
+}
+
+void IoUring::push_sqe() {
+  auto tail = *sq_tail_;
+  auto index = tail & sq_ring_mask_;
+  sq_array_[index] = index;
+  __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+  pending_submit_count_++;
+}
+
+bool IoUring::add_poll(int native_fd, uint32 poll_mask, bool is_multishot, uint64 user_data) {
+  auto sqe = get_sqe(IORING_OP_POLL_ADD, native_fd, user_data);
+  if (sqe == nullptr) {
+    return false;
+  }
+#if __BYTE_ORDER == __BIG_ENDIAN
+  poll_mask = (poll_mask << 16) | (poll_mask >> 16);
+#endif
+  sqe->poll32_events = poll_mask;
+  if (is_multishot) {
+    sqe->len = IORING_POLL_ADD_MULTI;
+  }
+  push_sqe();
+  return true;
+}
+
+bool IoUring::add_poll_remove(uint64 target_user_data, uint64 user_data) {
+  auto sqe = get_sqe(IORING_OP_POLL_REMOVE, -1, user_data);
+  if (sqe == nullptr) {
+    return false;
+  }
+  sqe->addr = target_user_data;
+  push_sqe();
+  return true;
+}
+
+Status IoUring::submit_and_wait(uint32 min_completions, int timeout_ms) {
+  unsigned flags = 0;
+  const void *arg = nullptr;
+  size_t arg_size = 0;
+  __kernel_timespec timeout;
+  io_uring_getevents_arg getevents_arg;
+  if (min_completions > 0) {
+    flags |= IORING_ENTER_GETEVENTS;
+    if (timeout_ms >= 0) {
+      timeout.tv_sec = timeout_ms / 1000;
+      timeout.tv_nsec = static_cast<long long>(timeout_ms % 1000) * 1000000;
+      std::memset(&getevents_arg, 0, sizeof(getevents_arg));
+      getevents_arg.sigmask_sz = _NSIG / 8;
+      getevents_arg.ts = reinterpret_cast<uint64>(&timeout);
+      flags |= IORING_ENTER_EXT_ARG;
+      arg = &getevents_arg;
+      arg_size = sizeof(getevents_arg);
+    }
+  }
+  if (pending_submit_count_ == 0 && min_completions == 0) {
+    return Status::OK();
+  }
+
+  int result = io_uring_enter(ring_fd_, pending_submit_count_, min_completions, flags, arg, arg_size);
+  if (result < 0) {
+    auto io_uring_enter_errno = errno;
+    if (io_uring_enter_errno == ETIME || io_uring_enter_errno == EINTR || io_uring_enter_errno == EAGAIN ||
+        io_uring_enter_errno == EBUSY) {
+      // requests will be submitted next time
+      return Status::OK();
+    }
+    return Status::PosixError(io_uring_enter_errno, "io_uring_enter failed");
+  }
+  CHECK(static_cast<uint32>(result) <= pending_submit_count_);
+  pending_submit_count_ -= result;
+  return Status::OK();
+}
+
+}  // namespace td
+
+#endif
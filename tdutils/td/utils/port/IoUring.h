@@ -0,0 +1,105 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/port/config.h"
+
+#if TD_POLL_EPOLL && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#if defined(IORING_FEAT_RSRC_TAGS) && defined(IORING_POLL_ADD_MULTI) && defined(__NR_io_uring_setup)
+#define TD_HAVE_IO_URING 1
+#endif
+#endif
+#endif
+
+#ifdef TD_HAVE_IO_URING
+
+#include "td/utils/common.h"
+#include "td/utils/Status.h"
+
+namespace td {
+
+// Thin wrapper over a Linux io_uring instance. All methods must be called from the same thread.
+// add_* methods return false if the submission queue is full; call submit() and retry in that case
+class IoUring {
+ public:
+  struct Completion {
+    uint64 user_data;
+    int32 result;  // returned poll mask or negated errno
+    uint32 flags;
+  };
+
+  IoUring() = default;
+  IoUring(const IoUring &other) = delete;
+  IoUring &operator=(const IoUring &other) = delete;
+  IoUring(IoUring &&other) = delete;
+  IoUring &operator=(IoUring &&other) = delete;
+  ~IoUring();
+
+  // fails if io_uring is unsupported or forbidden, or if the kernel is older than 5.13
+  Status init(uint32 entries) TD_WARN_UNUSED_RESULT;
+
+  void close();
+
+  bool add_poll(int native_fd, uint32 poll_mask, bool is_multishot, uint64 user_data);
+
+  bool add_poll_remove(uint64 target_user_data, uint64 user_data);
+
+  // submits all added requests and waits for at least min_completions completions for at most timeout_ms,
+  // negative timeout_ms means infinite waiting
+  Status submit_and_wait(uint32 min_completions, int timeout_ms) TD_WARN_UNUSED_RESULT;
+
+  Status submit() TD_WARN_UNUSED_RESULT {
+    return submit_and_wait(0, 0);
+  }
+
+  template <class F>
+  size_t for_each_completion(F &&f) {
+    auto head = *cq_head_;
+    auto tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+    size_t result = 0;
+    while (head != tail) {
+      const auto &cqe = cqes_[head & cq_ring_mask_];
+      f(Completion{cqe.user_data, cqe.res, cqe.flags});
+      head++;
+      result++;
+    }
+    __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+    return result;
+  }
+
+ private:
+  int ring_fd_ = -1;
+  uint32 pending_submit_count_ = 0;
+
+  void *sq_ring_ = nullptr;
+  size_t sq_ring_size_ = 0;
+  void *cq_ring_ = nullptr;
+  size_t cq_ring_size_ = 0;
+  io_uring_sqe *sqes_ = nullptr;
+  size_t sqes_size_ = 0;
+
+  unsigned *sq_head_ = nullptr;
+  unsigned *sq_tail_ = nullptr;
+  unsigned *sq_array_ = nullptr;
+  unsigned sq_ring_mask_ = 0;
+  unsigned sq_ring_entries_ = 0;
+
+  unsigned *cq_head_ = nullptr;
+  unsigned *cq_tail_ = nullptr;
+  io_uring_cqe *cqes_ = nullptr;
+  unsigned cq_ring_mask_ = 0;
+
+  io_uring_sqe *get_sqe(uint8 opcode, int native_fd, uint64 user_data);
+  void push_sqe();
+};
+
+}  // namespace td
+
+#endif
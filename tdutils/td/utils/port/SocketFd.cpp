@@ -24,9 +24,9 @@
 
 namespace td {
 
-Result<SocketFd> SocketFd::open(const IPAddress &address) {
+Result<SocketFd> SocketFd::open(const IPAddress &address, const SocketOptions &options) {
   SocketFd socket;
-  TRY_STATUS(socket.init(address));
+  TRY_STATUS(socket.init(address, options));
   return std::move(socket);
 }
 
@@ -51,7 +51,7 @@ Result<SocketFd> SocketFd::from_native_fd(int fd) {
 }
 #endif
 
-Status SocketFd::init(const IPAddress &address) {
+Status SocketFd::init(const IPAddress &address, const SocketOptions &options) {
   auto fd = socket(address.get_address_family(), SOCK_STREAM, 0);
 #if TD_PORT_POSIX
   if (fd == -1) {
@@ -78,7 +78,43 @@ Status SocketFd::init(const IPAddress &address) {
   setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char *>(&flags), sizeof(flags));
   setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, reinterpret_cast<const char *>(&flags), sizeof(flags));
   setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char *>(&flags), sizeof(flags));
-  // TODO: SO_REUSEADDR, SO_KEEPALIVE, TCP_NODELAY, SO_SNDBUF, SO_RCVBUF, TCP_QUICKACK, SO_LINGER
+
+  auto set_option = [fd](int level, int name, int value, const char *name_str) {
+    if (value <= 0) {
+      return;
+    }
+    if (setsockopt(fd, level, name, reinterpret_cast<const char *>(&value), sizeof(value)) != 0) {
+      LOG(WARNING) << OS_SOCKET_ERROR(PSLICE() << "Failed to set " << name_str << " to " << value);
+    }
+  };
+  // buffer sizes must be set before connect to affect TCP window scaling
+  set_option(SOL_SOCKET, SO_SNDBUF, options.send_buffer_size, "SO_SNDBUF");
+  set_option(SOL_SOCKET, SO_RCVBUF, options.receive_buffer_size, "SO_RCVBUF");
+#ifdef TCP_KEEPIDLE
+  set_option(IPPROTO_TCP, TCP_KEEPIDLE, options.keepalive_idle, "TCP_KEEPIDLE");
+#endif
+#ifdef TCP_KEEPINTVL
+  set_option(IPPROTO_TCP, TCP_KEEPINTVL, options.keepalive_interval, "TCP_KEEPINTVL");
+#endif
+#ifdef TCP_KEEPCNT
+  set_option(IPPROTO_TCP, TCP_KEEPCNT, options.keepalive_count, "TCP_KEEPCNT");
+#endif
+#ifdef TCP_QUICKACK
+  set_option(IPPROTO_TCP, TCP_QUICKACK, options.quick_ack ? 1 : 0, "TCP_QUICKACK");
+  quick_ack_ = options.quick_ack;
+#endif
+#ifdef TCP_FASTOPEN_CONNECT
+  // connect returns immediately and SYN is sent together with the first written data
+  set_option(IPPROTO_TCP, TCP_FASTOPEN_CONNECT, options.fast_open ? 1 : 0, "TCP_FASTOPEN_CONNECT");
+#endif
+  if (options.linger_timeout >= 0) {
+    linger l;
+    l.l_onoff = 1;
+    l.l_linger = static_cast<decltype(l.l_linger)>(options.linger_timeout);
+    if (setsockopt(fd, SOL_SOCKET, SO_LINGER, reinterpret_cast<const char *>(&l), sizeof(l)) != 0) {
+      LOG(WARNING) << OS_SOCKET_ERROR("Failed to set SO_LINGER");
+    }
+  }
 
 #if TD_PORT_POSIX
   int e_connect = connect(fd, address.get_sockaddr(), static_cast<socklen_t>(address.get_sockaddr_len()));
@@ -132,8 +168,40 @@ Result<size_t> SocketFd::write(Slice slice) {
   return fd_.write(slice);
 }
 
+Result<size_t> SocketFd::writev(const Slice *slices, size_t slice_count) {
+  return fd_.writev(slices, slice_count);
+}
+
 Result<size_t> SocketFd::read(MutableSlice slice) {
-  return fd_.read(slice);
+  auto result = fd_.read(slice);
+#ifdef TCP_QUICKACK
+  // the kernel disables quick acks on its own, so they need to be re-enabled
+  if (quick_ack_ && result.is_ok() && result.ok() != 0) {
+    int flags = 1;
+    setsockopt(fd_.get_native_fd(), IPPROTO_TCP, TCP_QUICKACK, reinterpret_cast<const char *>(&flags), sizeof(flags));
+  }
+#endif
+  return result;
+}
+
+Result<TcpInfo> SocketFd::get_tcp_info() const {
+#if TD_LINUX || TD_ANDROID
+  tcp_info info;
+  socklen_t info_size = sizeof(info);
+  if (getsockopt(fd_.get_native_fd(), IPPROTO_TCP, TCP_INFO, &info, &info_size) != 0) {
+    return OS_ERROR("Failed to get TCP_INFO");
+  }
+  TcpInfo result;
+  result.rtt = info.tcpi_rtt * 1e-6;
+  result.rtt_var = info.tcpi_rttvar * 1e-6;
+  result.total_retransmits = info.tcpi_total_retrans;
+  if (info.tcpi_rtt != 0) {
+    result.send_rate = static_cast<double>(info.tcpi_snd_cwnd) * info.tcpi_snd_mss / result.rtt;
+  }
+  return result;
+#else
+  return Status::Error("TCP_INFO is unsupported");
+#endif
 }
 
 }  // namespace td
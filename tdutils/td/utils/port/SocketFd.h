@@ -15,6 +15,24 @@
 
 namespace td {
 
+struct SocketOptions {
+  int32 send_buffer_size = 0;     // SO_SNDBUF in bytes, 0 to use the system default
+  int32 receive_buffer_size = 0;  // SO_RCVBUF in bytes, 0 to use the system default
+  int32 keepalive_idle = 0;       // idle time in seconds before first keepalive probe, 0 to use the system default
+  int32 keepalive_interval = 0;   // interval in seconds between keepalive probes, 0 to use the system default
+  int32 keepalive_count = 0;      // number of unanswered keepalive probes before reset, 0 to use the system default
+  int32 linger_timeout = -1;      // SO_LINGER timeout in seconds, -1 to disable lingering
+  bool quick_ack = false;         // keep TCP_QUICKACK enabled after every read
+  bool fast_open = false;         // send data in SYN if a TCP Fast Open cookie is cached for the server
+};
+
+struct TcpInfo {
+  double rtt = 0;      // smoothed round-trip time in seconds
+  double rtt_var = 0;  // round-trip time variance in seconds
+  uint32 total_retransmits = 0;
+  double send_rate = 0;  // estimated in bytes per second as congestion window size divided by round-trip time
+};
+
 class SocketFd {
  public:
   SocketFd() = default;
@@ -23,7 +41,8 @@ class SocketFd {
   SocketFd(SocketFd &&) = default;
   SocketFd &operator=(SocketFd &&) = default;
 
-  static Result<SocketFd> open(const IPAddress &address) TD_WARN_UNUSED_RESULT;
+  static Result<SocketFd> open(const IPAddress &address,
+                               const SocketOptions &options = SocketOptions()) TD_WARN_UNUSED_RESULT;
 
   const Fd &get_fd() const;
   Fd &get_fd();
@@ -32,7 +51,11 @@ class SocketFd {
 
   Status get_pending_error() TD_WARN_UNUSED_RESULT;
 
+  // supported only on Linux
+  Result<TcpInfo> get_tcp_info() const TD_WARN_UNUSED_RESULT;
+
   Result<size_t> write(Slice slice) TD_WARN_UNUSED_RESULT;
+  Result<size_t> writev(const Slice *slices, size_t slice_count) TD_WARN_UNUSED_RESULT;
   Result<size_t> read(MutableSlice slice) TD_WARN_UNUSED_RESULT;
 
   void close();
@@ -40,10 +63,11 @@ class SocketFd {
 
  private:
   Fd fd_;
+  bool quick_ack_ = false;
 
   friend class ServerSocketFd;
 
-  Status init(const IPAddress &address) TD_WARN_UNUSED_RESULT;
+  Status init(const IPAddress &address, const SocketOptions &options) TD_WARN_UNUSED_RESULT;
 
 #if TD_PORT_POSIX
   static Result<SocketFd> from_native_fd(int fd);
@@ -0,0 +1,176 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/port/detail/IoUringPoll.h"
+
+char disable_linker_warning_about_empty_file_io_uring_poll_cpp TD_UNUSED;
+
+#ifdef TD_HAVE_IO_URING
+
+#include "td/utils/logging.h"
+#include "td/utils/Status.h"
+
+#include <atomic>
+
+#include <poll.h>
+
+namespace td {
+namespace detail {
+
+static std::atomic<bool> is_io_uring_poll_enabled{false};
+
+constexpr uint32 IoUringPoll::RING_SIZE;
+
+void IoUringPoll::set_enabled(bool is_enabled) {
+  is_io_uring_poll_enabled.store(is_enabled, std::memory_order_relaxed);
+}
+
+bool IoUringPoll::is_enabled() {
+  return is_io_uring_poll_enabled.load(std::memory_order_relaxed);
+}
+
+void IoUringPoll::init() {
+  CHECK(!use_io_uring_);
+  if (is_enabled()) {
+    auto status = ring_.init(RING_SIZE);
+    if (status.is_ok()) {
+      use_io_uring_ = true;
+      return;
+    }
+    LOG(WARNING) << "Failed to use io_uring, fall back to epoll: " << status;
+  }
+  epoll_.init();
+}
+
+void IoUringPoll::clear() {
+  if (!use_io_uring_) {
+    return epoll_.clear();
+  }
+  subscriptions_.clear();
+  ring_.close();
+  use_io_uring_ = false;
+}
+
+uint64 IoUringPoll::get_user_data(int native_fd, uint32 generation) {
+  return (static_cast<uint64>(generation) << 32) | static_cast<uint32>(native_fd);
+}
+
+void IoUringPoll::add_poll(int native_fd, const Subscription &subscription) {
+  auto user_data = get_user_data(native_fd, subscription.generation);
+  while (!ring_.add_poll(native_fd, subscription.poll_mask, true, user_data)) {
+    auto status = ring_.submit();
+    LOG_IF(FATAL, status.is_error()) << status;
+  }
+}
+
+void IoUringPoll::add_poll_remove(uint64 target_user_data) {
+  // user_data == 0 is never used by poll requests, because generation is never 0
+  while (!ring_.add_poll_remove(target_user_data, 0)) {
+    auto status = ring_.submit();
+    LOG_IF(FATAL, status.is_error()) << status;
+  }
+}
+
+void IoUringPoll::subscribe(const Fd &fd, Fd::Flags flags) {
+  if (!use_io_uring_) {
+    return epoll_.subscribe(fd, flags);
+  }
+
+  uint32 poll_mask = POLLERR | POLLHUP;
+  if (flags & Fd::Read) {
+    poll_mask |= POLLIN;
+  }
+  if (flags & Fd::Write) {
+    poll_mask |= POLLOUT;
+  }
+  if (++last_generation_ == 0) {
+    last_generation_ = 1;
+  }
+  auto native_fd = fd.get_native_fd();
+  Subscription subscription{last_generation_, poll_mask};
+  bool is_inserted = subscriptions_.emplace(native_fd, subscription).second;
+  LOG_IF(FATAL, !is_inserted) << "Fd " << native_fd << " is already subscribed";
+
+  // the request will be submitted in run() together with other pending requests
+  add_poll(native_fd, subscription);
+}
+
+void IoUringPoll::unsubscribe(const Fd &fd) {
+  if (!use_io_uring_) {
+    return epoll_.unsubscribe(fd);
+  }
+
+  auto native_fd = fd.get_native_fd();
+  auto it = subscriptions_.find(native_fd);
+  LOG_IF(FATAL, it == subscriptions_.end()) << "Fd " << native_fd << " is not subscribed";
+  auto user_data = get_user_data(native_fd, it->second.generation);
+  subscriptions_.erase(it);
+
+  // the poll request holds a reference to the file, so it must be removed before the descriptor is closed
+  add_poll_remove(user_data);
+  auto status = ring_.submit();
+  LOG_IF(FATAL, status.is_error()) << status;
+}
+
+void IoUringPoll::unsubscribe_before_close(const Fd &fd) {
+  unsubscribe(fd);
+}
+
+void IoUringPoll::run(int timeout_ms) {
+  if (!use_io_uring_) {
+    return epoll_.run(timeout_ms);
+  }
+
+  auto status = ring_.submit_and_wait(timeout_ms == 0 ? 0 : 1, timeout_ms);
+  LOG_IF(FATAL, status.is_error()) << status;
+
+  ring_.for_each_completion([&](const IoUring::Completion &completion) {
+    if (completion.user_data == 0) {
+      // result of a poll removal
+      return;
+    }
+
+    auto native_fd = static_cast<int>(static_cast<uint32>(completion.user_data));
+    auto generation = static_cast<uint32>(completion.user_data >> 32);
+    auto it = subscriptions_.find(native_fd);
+    if (it == subscriptions_.end() || it->second.generation != generation) {
+      // the fd was unsubscribed after the event was posted
+      return;
+    }
+    if ((completion.flags & IORING_CQE_F_MORE) == 0) {
+      // multishot poll was terminated by the kernel, for example, because of completion queue overflow
+      add_poll(native_fd, it->second);
+    }
+    if (completion.result < 0) {
+      LOG_IF(FATAL, completion.result != -ECANCELED)
+          << Status::PosixError(-completion.result, "io_uring poll failed") << ", fd = " << native_fd;
+      return;
+    }
+
+    auto events = static_cast<uint32>(completion.result);
+    Fd::Flags flags = 0;
+    if (events & POLLIN) {
+      flags |= Fd::Read;
+    }
+    if (events & POLLOUT) {
+      flags |= Fd::Write;
+    }
+    if (events & POLLHUP) {
+      flags |= Fd::Close;
+    }
+    if (events & POLLERR) {
+      flags |= Fd::Error;
+    }
+    if (flags != 0) {
+      Fd(native_fd, Fd::Mode::Reference).update_flags_notify(flags);
+    }
+  });
+}
+
+}  // namespace detail
+}  // namespace td
+
+#endif
@@ -0,0 +1,78 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/port/config.h"
+
+#include "td/utils/port/IoUring.h"
+
+#ifdef TD_HAVE_IO_URING
+
+#include "td/utils/common.h"
+#include "td/utils/port/detail/Epoll.h"
+#include "td/utils/port/Fd.h"
+#include "td/utils/port/PollBase.h"
+
+#include <unordered_map>
+
+namespace td {
+namespace detail {
+
+// Edge-triggered poll based on multishot io_uring poll requests. Falls back to Epoll,
+// if io_uring wasn't enabled through set_enabled before init or isn't supported by the kernel
+class IoUringPoll final : public PollBase {
+ public:
+  IoUringPoll() = default;
+  IoUringPoll(const IoUringPoll &) = delete;
+  IoUringPoll &operator=(const IoUringPoll &) = delete;
+  IoUringPoll(IoUringPoll &&) = delete;
+  IoUringPoll &operator=(IoUringPoll &&) = delete;
+  ~IoUringPoll() override = default;
+
+  static void set_enabled(bool is_enabled);
+  static bool is_enabled();
+
+  bool is_io_uring_used() const {
+    return use_io_uring_;
+  }
+
+  void init() override;
+
+  void clear() override;
+
+  void subscribe(const Fd &fd, Fd::Flags flags) override;
+
+  void unsubscribe(const Fd &fd) override;
+
+  void unsubscribe_before_close(const Fd &fd) override;
+
+  void run(int timeout_ms) override;
+
+ private:
+  static constexpr uint32 RING_SIZE = 1024;
+
+  struct Subscription {
+    uint32 generation;
+    uint32 poll_mask;
+  };
+
+  bool use_io_uring_ = false;
+  Epoll epoll_;
+  IoUring ring_;
+  uint32 last_generation_ = 0;
+  std::unordered_map<int, Subscription> subscriptions_;
+
+  static uint64 get_user_data(int native_fd, uint32 generation);
+
+  void add_poll(int native_fd, const Subscription &subscription);
+  void add_poll_remove(uint64 target_user_data);
+};
+
+}  // namespace detail
+}  // namespace td
+
+#endif
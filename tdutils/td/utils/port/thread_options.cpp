@@ -0,0 +1,116 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/port/thread_options.h"
+
+#include "td/utils/logging.h"
+#include "td/utils/misc.h"
+#include "td/utils/port/config.h"
+#include "td/utils/port/FileFd.h"
+
+#if TD_LINUX || TD_ANDROID
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace td {
+
+static constexpr int32 MAX_CPU_COUNT = 4096;
+
+Result<vector<int32>> parse_cpu_list(Slice cpu_list) {
+  cpu_list = trim(cpu_list);
+  if (begins_with(cpu_list, "numa:")) {
+    TRY_RESULT(numa_node, to_integer_safe<int32>(cpu_list.substr(5)));
+    return get_numa_node_cpus(numa_node);
+  }
+
+  vector<int32> result;
+  for (auto range : full_split(cpu_list, ',')) {
+    range = trim(range);
+    if (range.empty()) {
+      continue;
+    }
+    auto bounds = split(range, '-');
+    TRY_RESULT(first, to_integer_safe<int32>(bounds.first));
+    auto last = first;
+    if (!bounds.second.empty()) {
+      TRY_RESULT(range_last, to_integer_safe<int32>(bounds.second));
+      last = range_last;
+    }
+    if (first < 0 || first > last || last >= MAX_CPU_COUNT) {
+      return Status::Error(PSLICE() << "Invalid CPU range \"" << range << '"');
+    }
+    for (auto cpu = first; cpu <= last; cpu++) {
+      result.push_back(cpu);
+    }
+  }
+  if (result.empty()) {
+    return Status::Error("CPU list is empty");
+  }
+  return std::move(result);
+}
+
+Result<vector<int32>> get_numa_node_cpus(int32 numa_node) {
+#if TD_LINUX || TD_ANDROID
+  if (numa_node < 0) {
+    return Status::Error("Invalid NUMA node");
+  }
+  // sysfs reports size of the file as a page size, so read_file can't be used
+  TRY_RESULT(fd, FileFd::open(PSLICE() << "/sys/devices/system/node/node" << numa_node << "/cpulist", FileFd::Read));
+  char buf[4096];
+  TRY_RESULT(size, fd.read(MutableSlice(buf, sizeof(buf))));
+  fd.close();
+  return parse_cpu_list(Slice(buf, size));
+#else
+  return Status::Error("NUMA nodes are unsupported");
+#endif
+}
+
+Status set_current_thread_options(const ThreadOptions &options) {
+#if TD_LINUX || TD_ANDROID
+  if (!options.cpus.empty()) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (auto cpu : options.cpus) {
+      if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        return Status::Error(PSLICE() << "Invalid CPU " << cpu);
+      }
+      CPU_SET(cpu, &cpu_set);
+    }
+    auto err = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (err != 0) {
+      return Status::PosixError(err, "Failed to set thread CPU affinity");
+    }
+  }
+  if (options.nice != 0) {
+    // on Linux nice value is a per-thread attribute
+    auto tid = static_cast<id_t>(syscall(SYS_gettid));
+    if (setpriority(PRIO_PROCESS, tid, options.nice) != 0) {
+      return OS_ERROR(PSLICE() << "Failed to set thread nice value to " << options.nice);
+    }
+  }
+  if (options.realtime_priority != 0) {
+    sched_param param;
+    param.sched_priority = options.realtime_priority;
+    auto err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (err != 0) {
+      return Status::PosixError(err, PSLICE() << "Failed to set thread real-time priority to "
+                                               << options.realtime_priority);
+    }
+  }
+  return Status::OK();
+#else
+  if (options.cpus.empty() && options.nice == 0 && options.realtime_priority == 0) {
+    return Status::OK();
+  }
+  return Status::Error("Thread options are unsupported");
+#endif
+}
+
+}  // namespace td
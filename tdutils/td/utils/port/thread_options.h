@@ -0,0 +1,30 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/Slice.h"
+#include "td/utils/Status.h"
+
+namespace td {
+
+struct ThreadOptions {
+  vector<int32> cpus;           // CPUs on which the thread is allowed to run, empty to leave the affinity unchanged
+  int32 nice = 0;               // nice value of the thread, 0 to leave the priority unchanged
+  int32 realtime_priority = 0;  // SCHED_FIFO priority of the thread, 0 to not use real-time scheduling
+};
+
+// parses a list of CPUs in the format "0-3,8,10-11" or all CPUs of a NUMA node in the format "numa:1"
+Result<vector<int32>> parse_cpu_list(Slice cpu_list) TD_WARN_UNUSED_RESULT;
+
+// returns CPUs of the NUMA node, supported only on Linux
+Result<vector<int32>> get_numa_node_cpus(int32 numa_node) TD_WARN_UNUSED_RESULT;
+
+// memory allocated by the thread after the call is placed by the OS on the NUMA node of the thread's CPUs
+Status set_current_thread_options(const ThreadOptions &options) TD_WARN_UNUSED_RESULT;
+
+}  // namespace td
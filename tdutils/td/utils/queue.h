@@ -272,9 +272,9 @@ class SPSCChainQueue {
     }
   };
 
-  Node *head_;
+  Node *head_ = nullptr;
   char pad[64 - sizeof(Node *)];
-  Node *tail_;
+  Node *tail_ = nullptr;
   char pad2[64 - sizeof(Node *)];
 
   Node *create_node() {
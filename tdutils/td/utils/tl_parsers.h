@@ -6,6 +6,7 @@
 //
 #pragma once
 
+#include "td/utils/ArenaAllocator.h"
 #include "td/utils/buffer.h"
 #include "td/utils/common.h"
 #include "td/utils/format.h"
@@ -163,6 +164,10 @@ class TlParser {
     return T(result_begin, result_len);
   }
 
+  void skip_string() {
+    fetch_string<Slice>();
+  }
+
   template <class T>
   T fetch_string_raw(const size_t size) {
     CHECK(size % sizeof(int32) == 0);
@@ -181,6 +186,10 @@ class TlParser {
   size_t get_left_len() const {
     return left_len;
   }
+
+  size_t get_offset() const {
+    return data_len - left_len;
+  }
 };
 
 class TlBufferParser : public TlParser {
@@ -218,8 +227,20 @@ class TlBufferParser : public TlParser {
     return TlParser::fetch_string_raw<T>(size);
   }
 
+  // returns the part of the buffer, which was parsed after the given offset
+  BufferSlice get_parsed_since(size_t offset) {
+    CHECK(offset <= get_offset());
+    return as_buffer_slice(parent_->as_slice().substr(offset, get_offset() - offset));
+  }
+
+  // TL-objects fetched from the buffer can be placed there to be freed together
+  ArenaAllocator &get_arena() {
+    return arena_;
+  }
+
  private:
   const BufferSlice *parent_;
+  ArenaAllocator arena_;
 
   BufferSlice as_buffer_slice(Slice slice) {
     if (is_aligned_pointer<4>(slice.data())) {
@@ -7,9 +7,12 @@
 #include "td/utils/unicode.h"
 
 #include "td/utils/logging.h"
+#include "td/utils/misc.h"
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
+#include <map>
 
 namespace td {
 
@@ -555,9 +558,56 @@ static uint32 binary_search_ranges(const int32 (&ranges)[N], uint32 code) {
   }
 }
 
+namespace {
+
+/**
+ * Two-level table for characters from the Basic Multilingual Plane, which aren't covered by the direct tables.
+ * Stores differences between replacement and the character itself, so equal blocks are shared.
+ */
+class BmpReplacementTable {
+ public:
+  template <size_t N>
+  explicit BmpReplacementTable(const int32 (&ranges)[N]) {
+    std::map<vector<int32>, uint16> block_ids;
+    vector<int32> block(BLOCK_SIZE);
+    for (uint32 block_begin = 0; block_begin < BMP_SIZE; block_begin += BLOCK_SIZE) {
+      for (uint32 i = 0; i < BLOCK_SIZE; i++) {
+        auto code = block_begin + i;
+        auto replacement = binary_search_ranges(ranges, code);
+        block[i] = replacement == 0 ? SKIPPED : static_cast<int32>(replacement) - static_cast<int32>(code);
+      }
+      auto it = block_ids.emplace(block, narrow_cast<uint16>(block_ids.size())).first;
+      if (it->second * BLOCK_SIZE == blocks_.size()) {
+        blocks_.insert(blocks_.end(), block.begin(), block.end());
+      }
+      block_ids_.push_back(it->second);
+    }
+  }
+
+  uint32 get(uint32 code) const {
+    auto diff = blocks_[block_ids_[code >> BLOCK_BITS] * BLOCK_SIZE + (code & (BLOCK_SIZE - 1))];
+    return diff == SKIPPED ? 0 : static_cast<uint32>(static_cast<int32>(code) + diff);
+  }
+
+  static constexpr uint32 BMP_SIZE = 0x10000;
+
+ private:
+  static constexpr uint32 BLOCK_BITS = 7;
+  static constexpr uint32 BLOCK_SIZE = 1 << BLOCK_BITS;
+  static constexpr int32 SKIPPED = std::numeric_limits<int32>::min();
+
+  vector<uint16> block_ids_;
+  vector<int32> blocks_;
+};
+
+}  // namespace
+
 uint32 prepare_search_character(uint32 code) {
   if (code < TABLE_SIZE) {
     return prepare_search_character_table[code];
+  } else if (code < BmpReplacementTable::BMP_SIZE) {
+    static const BmpReplacementTable table(prepare_search_character_ranges);
+    return table.get(code);
   } else {
     return binary_search_ranges(prepare_search_character_ranges, code);
   }
@@ -566,6 +616,9 @@ uint32 prepare_search_character(uint32 code) {
 uint32 unicode_to_lower(uint32 code) {
   if (code < TABLE_SIZE) {
     return to_lower_table[code];
+  } else if (code < BmpReplacementTable::BMP_SIZE) {
+    static const BmpReplacementTable table(to_lower_ranges);
+    return table.get(code);
   } else {
     return binary_search_ranges(to_lower_ranges, code);
   }
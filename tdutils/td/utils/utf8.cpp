@@ -9,6 +9,8 @@
 #include "td/utils/logging.h"  // for UNREACHABLE
 #include "td/utils/unicode.h"
 
+#include <cstring>
+
 namespace td {
 
 bool check_utf8(CSlice str) {
@@ -106,11 +108,47 @@ const unsigned char *next_utf8_unsafe(const unsigned char *ptr, uint32 *code) {
   return ptr;
 }
 
+// ASCII characters are processed 8 at a time, each byte of uint64 holding one character
+static constexpr uint64 ASCII_HIGH_BITS = 0x8080808080808080ull;
+static constexpr uint64 ASCII_LOW_BITS = 0x0101010101010101ull;
+
+static uint64 load_ascii_block(const unsigned char *ptr) {
+  uint64 res;
+  std::memcpy(&res, ptr, sizeof(res));
+  return res;
+}
+
+static void append_ascii_block(string &str, uint64 block) {
+  str.append(reinterpret_cast<const char *>(&block), sizeof(block));
+}
+
+// sets high bit in all bytes of the block which are between from and to inclusive; all bytes must be ASCII
+static uint64 ascii_block_in_range(uint64 block, unsigned char from, unsigned char to) {
+  return ((block + (0x80 - from) * ASCII_LOW_BITS) ^ (block + (0x7f - to) * ASCII_LOW_BITS)) & ASCII_HIGH_BITS;
+}
+
+static uint64 ascii_block_to_lower(uint64 block) {
+  return block | (ascii_block_in_range(block, 'A', 'Z') >> 2);
+}
+
+static bool ascii_block_has_zero(uint64 block) {
+  return ((block - ASCII_LOW_BITS) & ~block & ASCII_HIGH_BITS) != 0;
+}
+
 string utf8_to_lower(Slice str) {
   string result;
+  result.reserve(str.size());
   auto pos = str.ubegin();
   auto end = str.uend();
   while (pos != end) {
+    if (end - pos >= 8) {
+      auto block = load_ascii_block(pos);
+      if ((block & ASCII_HIGH_BITS) == 0) {
+        append_ascii_block(result, ascii_block_to_lower(block));
+        pos += 8;
+        continue;
+      }
+    }
     uint32 code;
     pos = next_utf8_unsafe(pos, &code);
     append_utf8_character(result, unicode_to_lower(code));
@@ -118,4 +156,32 @@ string utf8_to_lower(Slice str) {
   return result;
 }
 
+string utf8_prepare_search_string(Slice str) {
+  string result;
+  result.reserve(str.size());
+  auto pos = str.ubegin();
+  auto end = str.uend();
+  while (pos != end) {
+    if (end - pos >= 8) {
+      auto block = load_ascii_block(pos);
+      if ((block & ASCII_HIGH_BITS) == 0 && !ascii_block_has_zero(block)) {
+        // letters are lowercased, digits are kept and all other characters are replaced with spaces
+        block = ascii_block_to_lower(block);
+        auto is_kept = ascii_block_in_range(block, 'a', 'z') | ascii_block_in_range(block, '0', '9');
+        auto kept_bytes = (is_kept >> 7) * 0xff;
+        append_ascii_block(result, (block & kept_bytes) | (' ' * ASCII_LOW_BITS & ~kept_bytes));
+        pos += 8;
+        continue;
+      }
+    }
+    uint32 code;
+    pos = next_utf8_unsafe(pos, &code);
+    code = prepare_search_character(code);
+    if (code != 0) {
+      append_utf8_character(result, code);
+    }
+  }
+  return result;
+}
+
 }  // namespace td
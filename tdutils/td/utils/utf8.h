@@ -103,4 +103,7 @@ T utf8_utf16_substr(T str, size_t offset, size_t length) {
 /// Returns UTF-8 string converted to lower case.
 string utf8_to_lower(Slice str);
 
+/// Returns UTF-8 string with all characters replaced by prepare_search_character, skipping removed characters.
+string utf8_prepare_search_string(Slice str);
+
 }  // namespace td
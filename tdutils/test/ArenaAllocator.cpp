@@ -0,0 +1,60 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/ArenaAllocator.h"
+#include "td/utils/common.h"
+#include "td/utils/logging.h"
+#include "td/utils/port/thread.h"
+#include "td/utils/tests.h"
+
+#include <cstring>
+
+TEST(ArenaAllocator, simple) {
+  auto mem = td::ArenaAllocator::get_arena_mem();
+  std::vector<void *> ptrs;
+  {
+    td::ArenaAllocator arena;
+    for (size_t i = 0; i < 1000; i++) {
+      auto size = i % 100 + 1;
+      auto ptr = arena.allocate(size);
+      CHECK(reinterpret_cast<std::uintptr_t>(ptr) % 16 == 0);
+      std::memset(ptr, static_cast<int>(i), size);
+      ptrs.push_back(ptr);
+    }
+    ptrs.push_back(arena.allocate(1 << 20));
+    ptrs.push_back(td::ArenaAllocator::allocate_heap(10));
+    CHECK(td::ArenaAllocator::get_arena_mem() > mem);
+  }
+  CHECK(td::ArenaAllocator::get_arena_mem() > mem);
+  for (auto ptr : ptrs) {
+    td::ArenaAllocator::deallocate(ptr);
+  }
+  CHECK(td::ArenaAllocator::get_arena_mem() == mem);
+}
+
+TEST(ArenaAllocator, threads) {
+  auto mem = td::ArenaAllocator::get_arena_mem();
+  std::vector<void *> ptrs;
+  {
+    td::ArenaAllocator arena;
+    for (int i = 0; i < 10000; i++) {
+      ptrs.push_back(arena.allocate(48));
+    }
+  }
+  std::vector<td::thread> threads;
+  const size_t threads_n = 4;
+  for (size_t i = 0; i < threads_n; i++) {
+    threads.emplace_back([&ptrs, i, threads_n] {
+      for (size_t j = i; j < ptrs.size(); j += threads_n) {
+        td::ArenaAllocator::deallocate(ptrs[j]);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  CHECK(td::ArenaAllocator::get_arena_mem() == mem);
+}
@@ -0,0 +1,92 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/common.h"
+#include "td/utils/EpochBasedMemoryReclamation.h"
+#include "td/utils/logging.h"
+#include "td/utils/port/thread.h"
+#include "td/utils/Random.h"
+#include "td/utils/SharedSnapshot.h"
+#include "td/utils/tests.h"
+
+#include <atomic>
+
+TEST(EpochBasedMemoryReclamation, simple) {
+  td::EpochBasedMemoryReclamation<std::string> ebr(2);
+  {
+    auto locker = ebr.get_locker(1);
+    ebr.retire(0, new std::string("one"));
+    ebr.gc(0);
+    ebr.gc(0);
+    // thread 1 may still see the string
+    CHECK(ebr.to_delete_size_unsafe() == 1);
+  }
+  ebr.gc(0);
+  ebr.gc(0);
+  CHECK(ebr.to_delete_size_unsafe() == 0);
+}
+
+TEST(SharedSnapshot, simple) {
+  td::SharedSnapshot<std::string> snapshot(1, td::make_unique<std::string>("one"));
+  {
+    auto reader = snapshot.get(0);
+    CHECK(*reader == "one");
+  }
+  snapshot.set(0, td::make_unique<std::string>("two"));
+  CHECK(*snapshot.get(0) == "two");
+  snapshot.update(0, [](std::string &value) { value += "two"; });
+  CHECK(*snapshot.get(0) == "twotwo");
+}
+
+#if !TD_THREAD_UNSUPPORTED
+TEST(EpochBasedMemoryReclamation, stress) {
+  struct Node {
+    std::atomic<std::string *> name_{nullptr};
+    char pad[64];
+  };
+  int threads_n = 10;
+  std::vector<Node> nodes(threads_n);
+  td::EpochBasedMemoryReclamation<std::string> ebr(threads_n);
+  std::vector<td::thread> threads(threads_n);
+  int thread_id = 0;
+  for (auto &thread : threads) {
+    thread = td::thread([&, thread_id] {
+      for (int i = 0; i < 1000000; i++) {
+        auto &node = nodes[td::Random::fast(0, threads_n - 1)];
+        auto locker = ebr.get_locker(thread_id);
+        auto *str = node.name_.load(std::memory_order_acquire);
+        if (str) {
+          CHECK(*str == "one" || *str == "twotwo");
+        }
+        if (td::Random::fast(0, 5) == 0) {
+          std::string *new_str = new std::string(td::Random::fast(0, 1) == 0 ? "one" : "twotwo");
+          if (node.name_.compare_exchange_strong(str, new_str, std::memory_order_acq_rel)) {
+            if (str != nullptr) {
+              ebr.retire(thread_id, str);
+            }
+          } else {
+            delete new_str;
+          }
+        }
+      }
+    });
+    thread_id++;
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  LOG(ERROR) << "Undeleted pointers: " << ebr.to_delete_size_unsafe();
+  for (int t = 0; t < 3; t++) {
+    for (int i = 0; i < threads_n; i++) {
+      ebr.gc(i);
+    }
+  }
+  CHECK(ebr.to_delete_size_unsafe() == 0);
+  for (auto &node : nodes) {
+    delete node.name_.load();
+  }
+}
+#endif  //!TD_THREAD_UNSUPPORTED
@@ -4,13 +4,17 @@
 // Distributed under the Boost Software License, Version 1.0. (See accompanying
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
+#include "td/utils/BoundedMpmcQueue.h"
 #include "td/utils/logging.h"
 #include "td/utils/MpmcQueue.h"
 #include "td/utils/port/thread.h"
 #include "td/utils/tests.h"
 
 #include <algorithm>
+#include <atomic>
+#include <string>
 #include <tuple>
+#include <utility>
 
 TEST(OneValue, simple) {
   {
@@ -126,7 +130,72 @@ TEST(MpmcQueue, simple) {
   }
 }
 
+TEST(BoundedMpmcQueue, simple) {
+  td::BoundedMpmcQueue<std::string> q(3);
+  CHECK(q.capacity() == 4);
+  for (int t = 0; t < 3; t++) {
+    for (int i = 0; i < 4; i++) {
+      std::string x = std::to_string(i);
+      CHECK(q.try_push(x));
+      CHECK(x.empty());
+    }
+    std::string x = "extra";
+    CHECK(!q.try_push(x));
+    CHECK(x == "extra");
+    for (int i = 0; i < 4; i++) {
+      CHECK(q.try_pop(x));
+      CHECK(x == std::to_string(i)) << x << " expected " << i;
+    }
+    CHECK(!q.try_pop(x));
+  }
+}
+
 #if !TD_THREAD_UNSUPPORTED
+TEST(BoundedMpmcQueue, multi_thread) {
+  size_t n = 10;
+  size_t m = 10;
+  size_t qn = 10000;
+  td::BoundedMpmcQueue<std::pair<size_t, size_t>> q(64);
+  std::vector<td::thread> n_threads(n);
+  std::vector<td::thread> m_threads(m);
+  std::vector<std::vector<size_t>> received(m, std::vector<size_t>(n, 0));
+  std::atomic<size_t> sum{0};
+  for (size_t thread_id = 0; thread_id < m; thread_id++) {
+    m_threads[thread_id] = td::thread([&, thread_id] {
+      auto &last_value = received[thread_id];
+      while (true) {
+        auto data = q.pop();
+        if (data.second == 0) {
+          return;
+        }
+        // values from each producer must be received in order
+        CHECK(data.second > last_value[data.first]);
+        last_value[data.first] = data.second;
+        sum += data.second;
+      }
+    });
+  }
+  for (size_t thread_id = 0; thread_id < n; thread_id++) {
+    n_threads[thread_id] = td::thread([&, thread_id] {
+      for (size_t i = 1; i <= qn; i++) {
+        q.push(std::make_pair(thread_id, i));
+      }
+    });
+  }
+  for (auto &thread : n_threads) {
+    thread.join();
+  }
+  for (size_t i = 0; i < m; i++) {
+    q.push(std::make_pair(size_t{0}, size_t{0}));
+  }
+  for (auto &thread : m_threads) {
+    thread.join();
+  }
+  CHECK(sum.load() == n * qn * (qn + 1) / 2);
+  std::pair<size_t, size_t> data;
+  CHECK(!q.try_pop(data));
+}
+
 TEST(MpmcQueue, multi_thread) {
   size_t n = 10;
   size_t m = 10;
@@ -0,0 +1,86 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/format.h"
+#include "td/utils/logging.h"
+#include "td/utils/MpscPollableQueue.h"
+#include "td/utils/port/thread.h"
+#include "td/utils/tests.h"
+
+#if !TD_EVENTFD_UNSUPPORTED
+TEST(MpscPollableQueue, one_thread) {
+  td::MpscPollableQueue<int> queue;
+  queue.init();
+
+  CHECK(queue.reader_wait_nonblock() == 0);
+  queue.writer_put(1);
+  queue.writer_put_many({2, 3});
+  queue.writer_put_many({});
+  queue.writer_put(4);
+
+  std::vector<int> v;
+  int ready_n = queue.reader_wait_nonblock();
+  CHECK(ready_n == 4) << ready_n;
+  while (ready_n-- > 0) {
+    v.push_back(queue.reader_get_unsafe());
+  }
+  CHECK((v == std::vector<int>{1, 2, 3, 4})) << td::format::as_array(v);
+  CHECK(queue.reader_wait_nonblock() == 0);
+  CHECK(queue.reader_wait_nonblock() == 0);
+
+  queue.writer_put(5);
+  CHECK(queue.reader_wait_nonblock() == 1);
+  CHECK(queue.reader_get_unsafe() == 5);
+
+  queue.writer_put(6);
+  queue.destroy();
+}
+
+#if !TD_THREAD_UNSUPPORTED && !TD_WINDOWS
+TEST(MpscPollableQueue, multi_thread) {
+  td::MpscPollableQueue<int> queue;
+  queue.init();
+  int threads_n = 10;
+  int queries_n = 100000;
+  std::vector<int> next_value(threads_n);
+  std::vector<td::thread> threads(threads_n);
+  int thread_i = 0;
+  for (auto &thread : threads) {
+    thread = td::thread([&, id = thread_i] {
+      for (int i = 0; i < queries_n; i += 2) {
+        if (id % 2 == 0) {
+          queue.writer_put(i * threads_n + id);
+          queue.writer_put((i + 1) * threads_n + id);
+        } else {
+          queue.writer_put_many({i * threads_n + id, (i + 1) * threads_n + id});
+        }
+      }
+    });
+    thread_i++;
+  }
+
+  int active_threads = threads_n;
+  while (active_threads) {
+    int ready_n = queue.reader_wait();
+    while (ready_n-- > 0) {
+      auto x = queue.reader_get_unsafe();
+      auto thread_id = x % threads_n;
+      x /= threads_n;
+      CHECK(next_value[thread_id] == x);
+      next_value[thread_id]++;
+      if (x + 1 == queries_n) {
+        active_threads--;
+      }
+    }
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  queue.destroy();
+}
+#endif
+#endif
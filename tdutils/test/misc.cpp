@@ -5,22 +5,41 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 #include "td/utils/base64.h"
+#include "td/utils/buffer.h"
+#include "td/utils/BufferedFd.h"
 #include "td/utils/logging.h"
+#include "td/utils/LogHistogram.h"
 #include "td/utils/misc.h"
 #include "td/utils/port/EventFd.h"
 #include "td/utils/port/FileFd.h"
+#include "td/utils/port/IPAddress.h"
 #include "td/utils/port/path.h"
 #include "td/utils/port/sleep.h"
+#include "td/utils/port/SocketFd.h"
 #include "td/utils/port/Stat.h"
 #include "td/utils/port/thread.h"
+#include "td/utils/port/thread_options.h"
 #include "td/utils/Random.h"
 #include "td/utils/Slice.h"
 #include "td/utils/tests.h"
+#include "td/utils/unicode.h"
+#include "td/utils/utf8.h"
 
+#include <algorithm>
 #include <atomic>
 #include <clocale>
 #include <limits>
 
+#if !TD_WINDOWS
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#if TD_LINUX
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#endif
+
 using namespace td;
 
 #if TD_LINUX || TD_DARWIN
@@ -221,3 +240,174 @@ TEST(Misc, to_double) {
   std::setlocale(LC_ALL, "C");
   test_to_double();
 }
+
+TEST(Misc, utf8_prepare_search_string) {
+  for (int i = 0; i < 1000; i++) {
+    string str;
+    int length = Random::fast(0, 50);
+    for (int j = 0; j < length; j++) {
+      auto type = Random::fast(0, 9);
+      if (type == 0) {
+        append_utf8_character(str, static_cast<uint32>(Random::fast(0x80, 0xd7ff)));
+      } else if (type == 1) {
+        append_utf8_character(str, static_cast<uint32>(Random::fast(0x10000, 0x10ffff)));
+      } else {
+        append_utf8_character(str, static_cast<uint32>(Random::fast(0, 0x7f)));
+      }
+    }
+
+    string expected_lower;
+    string expected_search;
+    for (auto pos = Slice(str).ubegin(), end = Slice(str).uend(); pos != end;) {
+      uint32 code;
+      pos = next_utf8_unsafe(pos, &code);
+      append_utf8_character(expected_lower, unicode_to_lower(code));
+      code = prepare_search_character(code);
+      if (code != 0) {
+        append_utf8_character(expected_search, code);
+      }
+    }
+    ASSERT_EQ(expected_lower, utf8_to_lower(str));
+    ASSERT_EQ(expected_search, utf8_prepare_search_string(str));
+  }
+  ASSERT_EQ("john smith     42 ", utf8_prepare_search_string("JOHN Smith, (!)42."));
+}
+
+#if !TD_WINDOWS
+TEST(Misc, buffered_fd_writev) {
+  int fds[2];
+  CHECK(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+  BufferedFd<Fd> fd(Fd(fds[0], Fd::Mode::Owner));
+  fd.get_fd().set_is_blocking(true).ensure();
+  fd.get_fd().update_flags(Fd::Write);
+
+  ChainBufferWriter writer;
+  auto reader = writer.extract_reader();
+  string expected;
+  for (int i = 0; i < 200; i++) {
+    string str(static_cast<size_t>(Random::fast(1, 1000)), static_cast<char>('a' + i % 26));
+    expected += str;
+    if (i % 2 == 0) {
+      writer.append(str);
+    } else {
+      writer.append(BufferSlice(str));
+    }
+  }
+  reader.sync_with_writer();
+  std::array<Slice, Fd::MAX_WRITEV_SLICES> slices;
+  auto slice_count = reader.prepare_readv(slices.data(), slices.size());
+  ASSERT_TRUE(slice_count > 1);
+  size_t prefix_size = 0;
+  for (size_t i = 0; i < slice_count; i++) {
+    ASSERT_EQ(Slice(expected).substr(prefix_size, slices[i].size()), slices[i]);
+    prefix_size += slices[i].size();
+  }
+  fd.output_buffer().append(reader);
+
+  while (fd.need_flush_write()) {
+    fd.flush_write().ensure();
+  }
+  fd.close();
+
+  string received;
+  char buf[1 << 12];
+  ssize_t read_size;
+  while ((read_size = read(fds[1], buf, sizeof(buf))) > 0) {
+    received.append(buf, static_cast<size_t>(read_size));
+  }
+  close(fds[1]);
+  ASSERT_EQ(expected, received);
+}
+#endif
+
+#if TD_LINUX
+TEST(Misc, socket_options) {
+  IPAddress address;
+  address.init_ipv4_port("127.0.0.1", 1).ensure();
+
+  SocketOptions options;
+  options.receive_buffer_size = 1 << 16;
+  options.keepalive_idle = 7;
+  options.keepalive_interval = 2;
+  options.keepalive_count = 3;
+  options.linger_timeout = 0;
+  auto socket_fd = SocketFd::open(address, options).move_as_ok();
+  auto native_fd = socket_fd.get_fd().get_native_fd();
+
+  auto get_option = [&](int level, int name) {
+    int value = 0;
+    socklen_t value_size = sizeof(value);
+    CHECK(getsockopt(native_fd, level, name, &value, &value_size) == 0);
+    return value;
+  };
+  // the kernel doubles the requested buffer size
+  ASSERT_TRUE(get_option(SOL_SOCKET, SO_RCVBUF) >= options.receive_buffer_size);
+  ASSERT_EQ(options.keepalive_idle, get_option(IPPROTO_TCP, TCP_KEEPIDLE));
+  ASSERT_EQ(options.keepalive_interval, get_option(IPPROTO_TCP, TCP_KEEPINTVL));
+  ASSERT_EQ(options.keepalive_count, get_option(IPPROTO_TCP, TCP_KEEPCNT));
+
+  linger l;
+  socklen_t linger_size = sizeof(l);
+  CHECK(getsockopt(native_fd, SOL_SOCKET, SO_LINGER, &l, &linger_size) == 0);
+  ASSERT_EQ(1, l.l_onoff);
+  ASSERT_EQ(0, l.l_linger);
+
+  ASSERT_TRUE(socket_fd.get_tcp_info().is_ok());
+  socket_fd.close();
+}
+#endif
+
+TEST(Misc, parse_cpu_list) {
+  auto check = [](Slice cpu_list, vector<int32> expected) {
+    auto r_cpus = parse_cpu_list(cpu_list);
+    ASSERT_TRUE(r_cpus.is_ok());
+    ASSERT_EQ(expected, r_cpus.ok());
+  };
+  check("0", {0});
+  check(" 0-3,8,10-11\n", {0, 1, 2, 3, 8, 10, 11});
+  check("5,2", {5, 2});
+
+  ASSERT_TRUE(parse_cpu_list("").is_error());
+  ASSERT_TRUE(parse_cpu_list("3-1").is_error());
+  ASSERT_TRUE(parse_cpu_list("-1").is_error());
+  ASSERT_TRUE(parse_cpu_list("1,a").is_error());
+  ASSERT_TRUE(parse_cpu_list("100000").is_error());
+
+  ASSERT_TRUE(set_current_thread_options(ThreadOptions()).is_ok());
+}
+
+TEST(Misc, LogHistogram) {
+  LogHistogram histogram;
+  ASSERT_EQ(0u, histogram.get_percentile(50));
+  for (uint64 i = 1; i <= 7; i++) {
+    histogram.add(i);
+  }
+  ASSERT_EQ(7u, histogram.get_count());
+  ASSERT_EQ(28u, histogram.get_sum());
+  ASSERT_EQ(4u, histogram.get_percentile(50));
+  ASSERT_EQ(7u, histogram.get_percentile(100));
+  ASSERT_EQ(1u, histogram.get_percentile(0));
+
+  histogram.clear();
+  vector<uint64> values;
+  for (int i = 0; i < 10000; i++) {
+    values.push_back(static_cast<uint64>(Random::fast(0, 1000000)) * static_cast<uint64>(Random::fast(1, 1000)));
+    histogram.add(values.back());
+  }
+  histogram.add(std::numeric_limits<uint64>::max(), 0);
+  std::sort(values.begin(), values.end());
+  for (auto percentile : {1, 10, 50, 90, 99, 100}) {
+    auto exact = values[(values.size() * percentile + 99) / 100 - 1];
+    auto estimate = histogram.get_percentile(percentile);
+    ASSERT_TRUE(exact <= estimate);
+    ASSERT_TRUE(static_cast<double>(estimate - exact) <= static_cast<double>(exact) / LogHistogram::SUB_BUCKET_COUNT);
+  }
+  ASSERT_EQ(values.back(), histogram.get_max());
+
+  LogHistogram other;
+  other.add(std::numeric_limits<uint64>::max());
+  histogram.merge(other);
+  ASSERT_EQ(10001u, histogram.get_count());
+  ASSERT_EQ(std::numeric_limits<uint64>::max(), histogram.get_percentile(100));
+  ASSERT_TRUE(histogram.get_percentile(99) < std::numeric_limits<uint64>::max());
+}
@@ -28,6 +28,9 @@ DESC_TESTS(http);
 DESC_TESTS(heap);
 DESC_TESTS(pq);
 DESC_TESTS(mtproto);
+DESC_TESTS(net_query_stats);
+DESC_TESTS(traffic_recorder);
+DESC_TESTS(update_coalescer);
 
 namespace td {
 
@@ -45,6 +48,9 @@ void TestsRunner::run_all_tests() {
   LOAD_TESTS(heap);
   LOAD_TESTS(pq);
   LOAD_TESTS(mtproto);
+  LOAD_TESTS(net_query_stats);
+  LOAD_TESTS(traffic_recorder);
+  LOAD_TESTS(update_coalescer);
   Test::run_all();
 }
 
@@ -4,16 +4,25 @@
 // Distributed under the Boost Software License, Version 1.0. (See accompanying
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
+#include "td/actor/actor.h"
+#include "td/actor/PromiseFuture.h"
+
 #include "td/db/binlog/BinlogHelper.h"
 #include "td/db/BinlogKeyValue.h"
 #include "td/db/SeqKeyValue.h"
+#include "td/db/SqliteConnectionSafe.h"
+#include "td/db/SqliteDb.h"
 #include "td/db/SqliteKeyValue.h"
 #include "td/db/SqliteKeyValueSafe.h"
+#include "td/db/SqliteMaintenance.h"
+#include "td/db/SqliteStatement.h"
 #include "td/db/TsSeqKeyValue.h"
 
 #include "td/utils/common.h"
 #include "td/utils/logging.h"
+#include "td/utils/misc.h"
 #include "td/utils/port/FileFd.h"
+#include "td/utils/port/Stat.h"
 #include "td/utils/port/thread.h"
 #include "td/utils/Random.h"
 #include "td/utils/Slice.h"
@@ -155,6 +164,268 @@ TEST(DB, sqlite_encryption) {
   SqliteDb::open_with_key(path, cucumber).ensure_error();
 }
 
+TEST(DB, sqlite_options) {
+  string path = "test_sqlite_db";
+  SqliteDb::destroy(path).ignore();
+
+  SqliteDb::Options options;
+  options.cache_size = 8 << 20;
+  options.mmap_size = 16 << 20;
+  options.page_size = 8192;
+  options.wal_autocheckpoint = 5000;
+  {
+    auto db = SqliteDb::open_with_key(path, DbKey::empty(), options).move_as_ok();
+    db.exec("PRAGMA journal_mode=WAL").ensure();
+    db.exec("CREATE TABLE options_test (id INT)").ensure();
+    ASSERT_EQ("-8192", db.get_pragma("cache_size").ok());
+    ASSERT_EQ(to_string(16 << 20), db.get_pragma("mmap_size").ok());
+    ASSERT_EQ("8192", db.get_pragma("page_size").ok());
+    ASSERT_EQ("5000", db.get_pragma("wal_autocheckpoint").ok());
+  }
+
+  // page size of an existing database can't be changed and encrypted databases are never memory-mapped
+  auto cucumber = DbKey::password("cucumber");
+  SqliteDb::change_key(path, cucumber, DbKey::empty()).ensure();
+  options.page_size = 4096;
+  auto db = SqliteDb::open_with_key(path, cucumber, options).move_as_ok();
+  ASSERT_EQ("-8192", db.get_pragma("cache_size").ok());
+  ASSERT_EQ("0", db.get_pragma("mmap_size").ok());
+  ASSERT_EQ("5000", db.get_pragma("wal_autocheckpoint").ok());
+}
+
+TEST(DB, sqlite_maintenance) {
+  string path = "test_sqlite_db";
+  SqliteDb::destroy(path).ignore();
+  SqliteDb db;
+  db.init(path).ensure();
+  db.exec("PRAGMA auto_vacuum=INCREMENTAL").ensure();
+  db.exec("PRAGMA journal_mode=WAL").ensure();
+  db.exec("CREATE TABLE maintenance_test (id INT, value BLOB)").ensure();
+
+  auto insert_stmt = db.get_statement("INSERT INTO maintenance_test VALUES(?1, ?2)").move_as_ok();
+  string value(1000, 'a');
+  db.begin_transaction().ensure();
+  for (int i = 0; i < 1000; i++) {
+    insert_stmt.bind_int32(1, i).ensure();
+    insert_stmt.bind_blob(2, value).ensure();
+    insert_stmt.step().ensure();
+    insert_stmt.reset();
+  }
+  db.commit_transaction().ensure();
+  db.exec("DELETE FROM maintenance_test WHERE id >= 0").ensure();
+  ASSERT_EQ(2000, db.get_total_change_count());
+
+  auto free_page_count = to_integer<int32>(db.get_pragma("freelist_count").ok());
+  ASSERT_TRUE(free_page_count > 100);
+  db.exec("PRAGMA incremental_vacuum(100)").ensure();
+  ASSERT_EQ(free_page_count - 100, to_integer<int32>(db.get_pragma("freelist_count").ok()));
+
+  auto checkpoint_result = db.checkpoint(false).move_as_ok();
+  ASSERT_TRUE(checkpoint_result.wal_frame_count > 0);
+  ASSERT_EQ(checkpoint_result.wal_frame_count, checkpoint_result.checkpointed_frame_count);
+  ASSERT_TRUE(stat(PSLICE() << path << "-wal").ok().size_ > 0);
+  db.checkpoint(true).ensure();
+  ASSERT_EQ(0, stat(PSLICE() << path << "-wal").ok().size_);
+}
+
+static void fill_and_clear_maintenance_test_table(SqliteDb &db) {
+  db.exec("CREATE TABLE IF NOT EXISTS maintenance_test (id INT, value BLOB)").ensure();
+  auto insert_stmt = db.get_statement("INSERT INTO maintenance_test VALUES(?1, ?2)").move_as_ok();
+  string value(1000, 'a');
+  db.begin_transaction().ensure();
+  for (int i = 0; i < 3000; i++) {
+    insert_stmt.bind_int32(1, i).ensure();
+    insert_stmt.bind_blob(2, value).ensure();
+    insert_stmt.step().ensure();
+    insert_stmt.reset();
+  }
+  db.commit_transaction().ensure();
+  db.exec("DELETE FROM maintenance_test WHERE id >= 0").ensure();
+}
+
+class SqliteMaintenanceTest : public Actor {
+ public:
+  SqliteMaintenanceTest(string path, bool allow_full_vacuum, bool expect_vacuum, SqliteMaintenanceInterface::Stats *stats)
+      : path_(std::move(path)), allow_full_vacuum_(allow_full_vacuum), expect_vacuum_(expect_vacuum), stats_(stats) {
+  }
+
+ private:
+  static constexpr int MAX_POLL_COUNT = 1000;
+
+  string path_;
+  bool allow_full_vacuum_;
+  bool expect_vacuum_;
+  SqliteMaintenanceInterface::Stats *stats_;
+  int poll_count_ = 0;
+  std::shared_ptr<SqliteConnectionSafe> connection_;
+  std::unique_ptr<SqliteMaintenanceInterface> maintenance_;
+
+  void start_up() override {
+    connection_ = std::make_shared<SqliteConnectionSafe>(path_);
+    SqliteMaintenanceInterface::Options options;
+    options.check_period = 0.01;
+    options.vacuum_step_delay = 0.01;
+    options.allow_full_vacuum = allow_full_vacuum_;
+    maintenance_ = create_sqlite_maintenance(connection_, 0, options);
+    set_timeout_in(0.01);
+  }
+
+  void timeout_expired() override {
+    maintenance_->get_stats(
+        PromiseCreator::lambda([actor_id = actor_id(this)](Result<SqliteMaintenanceInterface::Stats> r_stats) {
+          send_closure(actor_id, &SqliteMaintenanceTest::on_get_stats, r_stats.move_as_ok());
+        }));
+  }
+
+  void on_get_stats(SqliteMaintenanceInterface::Stats stats) {
+    // the first maintenance step of an idle database makes a checkpoint and decides whether to vacuum it
+    bool is_finished = stats.checkpoint_count > 0 && (!expect_vacuum_ || stats.free_page_count < 256);
+    if (!is_finished && ++poll_count_ < MAX_POLL_COUNT) {
+      return set_timeout_in(0.01);
+    }
+    *stats_ = stats;
+    maintenance_->close(PromiseCreator::lambda([actor_id = actor_id(this)](Unit) {
+      send_closure(actor_id, &SqliteMaintenanceTest::on_closed);
+    }));
+  }
+
+  void on_closed() {
+    connection_->close();
+    Scheduler::instance()->finish();
+    stop();
+  }
+};
+
+static SqliteMaintenanceInterface::Stats run_sqlite_maintenance(string path, bool allow_full_vacuum,
+                                                                 bool expect_vacuum) {
+  SqliteMaintenanceInterface::Stats stats;
+  ConcurrentScheduler sched;
+  sched.init(0);
+  sched.create_actor_unsafe<SqliteMaintenanceTest>(0, "SqliteMaintenanceTest", std::move(path), allow_full_vacuum,
+                                                   expect_vacuum, &stats)
+      .release();
+  sched.start();
+  while (sched.run_main(10)) {
+    // empty
+  }
+  sched.finish();
+  return stats;
+}
+
+TEST(DB, sqlite_maintenance_actor) {
+  string path = "test_sqlite_db";
+  SqliteDb::destroy(path).ignore();
+  {
+    SqliteDb db;
+    db.init(path).ensure();
+    db.exec("PRAGMA journal_mode=WAL").ensure();
+    fill_and_clear_maintenance_test_table(db);
+  }
+
+  // a legacy database isn't converted without permission
+  auto stats = run_sqlite_maintenance(path, false, false);
+  ASSERT_TRUE(stats.checkpoint_count > 0);
+  ASSERT_EQ(0, stats.full_vacuum_count);
+  ASSERT_TRUE(!stats.is_incremental_vacuum_enabled);
+  ASSERT_TRUE(stats.free_page_count >= 256);
+
+  stats = run_sqlite_maintenance(path, true, true);
+  ASSERT_EQ(1, stats.full_vacuum_count);
+  ASSERT_TRUE(stats.is_incremental_vacuum_enabled);
+  ASSERT_TRUE(stats.free_page_count < 256);
+
+  {
+    SqliteDb db;
+    db.init(path).ensure();
+    fill_and_clear_maintenance_test_table(db);
+  }
+  stats = run_sqlite_maintenance(path, false, true);
+  ASSERT_EQ(0, stats.full_vacuum_count);
+  ASSERT_TRUE(stats.vacuumed_page_count >= 256);
+  ASSERT_TRUE(stats.free_page_count < 256);
+  SqliteDb::destroy(path).ignore();
+}
+
+TEST(DB, sqlite_statement_stats) {
+  string path = "test_sqlite_db";
+  SqliteDb::destroy(path).ignore();
+  SqliteDb db;
+  db.init(path).ensure();
+  db.exec("CREATE TABLE stats_test (id INT, value BLOB)").ensure();
+
+  SqliteStatement::clear_stats();
+  auto insert_stmt = db.get_statement("INSERT INTO stats_test VALUES(?1, ?2)").move_as_ok();
+  for (int i = 0; i < 3; i++) {
+    insert_stmt.bind_int32(1, i).ensure();
+    insert_stmt.bind_blob(2, "value").ensure();
+    insert_stmt.step().ensure();
+    insert_stmt.reset();
+  }
+
+  auto select_stmt = db.get_statement("SELECT value FROM stats_test WHERE value = ?1").move_as_ok();
+  select_stmt.bind_blob(1, "value").ensure();
+  select_stmt.step().ensure();
+  while (select_stmt.has_row()) {
+    CHECK(select_stmt.view_blob(0) == "value");
+    select_stmt.step().ensure();
+  }
+  select_stmt.reset();
+
+  // an execution, which was reset before returning all rows, is also counted
+  select_stmt.bind_blob(1, "value").ensure();
+  select_stmt.step().ensure();
+  CHECK(select_stmt.has_row());
+  select_stmt.reset();
+
+  bool found_insert = false;
+  bool found_select = false;
+  for (auto &stats : SqliteStatement::get_stats()) {
+    if (stats.sql == "INSERT INTO stats_test VALUES(?1, ?2)") {
+      found_insert = true;
+      ASSERT_EQ(3, stats.execution_count);
+      ASSERT_EQ(0, stats.row_count);
+      ASSERT_EQ(15, stats.byte_count);
+    }
+    if (stats.sql == "SELECT value FROM stats_test WHERE value = ?1") {
+      found_select = true;
+      ASSERT_EQ(2, stats.execution_count);
+      ASSERT_EQ(4, stats.row_count);
+      ASSERT_EQ(25, stats.byte_count);
+      ASSERT_TRUE(stats.full_scan_step_count > 0);
+      ASSERT_TRUE(stats.max_time <= stats.total_time);
+    }
+  }
+  ASSERT_TRUE(found_insert);
+  ASSERT_TRUE(found_select);
+}
+
+TEST(DB, sqlite_key_value_get_multi) {
+  string path = "test_sqlite_db";
+  SqliteDb::destroy(path).ignore();
+
+  auto db = SqliteDb::open_with_key(path, DbKey::empty()).move_as_ok();
+  auto kv = SqliteKeyValue();
+  kv.init_with_connection(db.clone(), "kv").ensure();
+  for (int i = 0; i < 1000; i += 2) {
+    kv.set(PSLICE() << "key" << i, PSLICE() << "value" << i);
+  }
+
+  vector<string> keys;
+  for (int i = 0; i < 1000; i += 3) {
+    keys.push_back(PSTRING() << "key" << i);
+  }
+  keys.push_back("key2");
+  keys.push_back("key3");
+  keys.push_back("key2");
+  auto values = kv.get_multi(keys);
+  ASSERT_EQ(keys.size(), values.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    ASSERT_EQ(kv.get(keys[i]), values[i]);
+  }
+  ASSERT_EQ("value2", values.back());
+  ASSERT_TRUE(kv.get_multi({}).empty());
+}
+
 using SeqNo = uint64;
 struct DbQuery {
   enum Type { Get, Set, Erase } type;
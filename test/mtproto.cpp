@@ -20,11 +20,19 @@
 
 #include "td/telegram/ConfigManager.h"
 #include "td/telegram/net/PublicRsaKeyShared.h"
+#include "td/telegram/telegram_api.h"
 
+#include "td/tl/tl_object_lazy.h"
+#include "td/tl/tl_object_parse.h"
+
+#include "td/utils/buffer.h"
 #include "td/utils/logging.h"
 #include "td/utils/port/IPAddress.h"
 #include "td/utils/port/SocketFd.h"
+#include "td/utils/Slice.h"
 #include "td/utils/Status.h"
+#include "td/utils/tl_parsers.h"
+#include "td/utils/tl_storers.h"
 
 REGISTER_TESTS(mtproto);
 
@@ -75,6 +83,62 @@ TEST(Mtproto, encrypted_config) {
   auto config = decode_config(data).move_as_ok();
 }
 
+TEST(Mtproto, skip_and_lazy_fetch) {
+  const int32 vector_id = 0x1cb5c415;
+  auto store = [&](auto &storer) {
+    storer.store_binary(vector_id);
+    storer.store_binary(static_cast<int32>(2));
+    storer.store_binary(telegram_api::messageEntityBold::ID);
+    storer.store_binary(static_cast<int32>(1));
+    storer.store_binary(static_cast<int32>(2));
+    storer.store_binary(telegram_api::messageEntityTextUrl::ID);
+    storer.store_binary(static_cast<int32>(3));
+    storer.store_binary(static_cast<int32>(4));
+    storer.store_string(Slice("https://telegram.org"));
+    storer.store_binary(static_cast<int32>(7));
+  };
+  TlStorerCalcLength calc_length;
+  store(calc_length);
+  BufferSlice data(calc_length.get_length());
+  TlStorerUnsafe storer(data.as_slice().begin());
+  store(storer);
+
+  using FetchEntity = TlFetchObject<telegram_api::MessageEntity>;
+  {
+    TlBufferParser parser(&data);
+    TlFetchBoxed<TlFetchVector<FetchEntity>, vector_id>::skip(parser);
+    ASSERT_EQ(7, parser.fetch_int());
+    parser.fetch_end();
+    ASSERT_TRUE(parser.get_error() == nullptr);
+  }
+  {
+    TlBufferParser parser(&data);
+    auto entities = TlFetchBoxed<TlFetchVector<TlFetchLazy<FetchEntity>>, vector_id>::parse(parser);
+    ASSERT_EQ(7, parser.fetch_int());
+    parser.fetch_end();
+    ASSERT_TRUE(parser.get_error() == nullptr);
+    ASSERT_EQ(2u, entities.size());
+    ASSERT_TRUE(!entities[1].is_parsed());
+    auto &entity = entities[1].get();
+    ASSERT_TRUE(entities[1].is_parsed());
+    ASSERT_EQ(telegram_api::messageEntityTextUrl::ID, entity->get_id());
+    ASSERT_EQ("https://telegram.org",
+              static_cast<const telegram_api::messageEntityTextUrl *>(entity.get())->url_);
+    ASSERT_EQ(telegram_api::messageEntityBold::ID, entities[0].get()->get_id());
+  }
+  {
+    TlBufferParser parser(&data);
+    parser.fetch_int();
+    parser.fetch_int();
+    parser.fetch_int();
+    TlFetchObject<telegram_api::messageEntityBold>::skip(parser);
+    telegram_api::MessageEntity::skip(parser);
+    ASSERT_TRUE(parser.get_error() == nullptr);
+    telegram_api::MessageEntity::skip(parser);
+    ASSERT_TRUE(parser.get_error() != nullptr);
+  }
+}
+
 class TestPingActor : public Actor {
  public:
   TestPingActor(IPAddress ip_address, Status *result) : ip_address_(ip_address), result_(result) {
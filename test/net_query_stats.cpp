@@ -0,0 +1,105 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/net/DcId.h"
+#include "td/telegram/net/NetQuery.h"
+#include "td/telegram/net/NetQueryStats.h"
+
+#include "td/actor/actor.h"
+
+#include "td/utils/buffer.h"
+#include "td/utils/common.h"
+#include "td/utils/Slice.h"
+#include "td/utils/Status.h"
+#include "td/utils/tests.h"
+
+#include <memory>
+
+REGISTER_TESTS(net_query_stats);
+
+using namespace td;
+
+static std::unique_ptr<NetQuery> create_query(int32 tl_constructor) {
+  return std::make_unique<NetQuery>(NetQuery::State::Query, 1, BufferSlice("query"), BufferSlice(), DcId::main(),
+                                    NetQuery::Type::Common, NetQuery::AuthFlag::On, NetQuery::GzipFlag::Off,
+                                    tl_constructor);
+}
+
+TEST(NetQueryStats, aggregate) {
+  ConcurrentScheduler sched;
+  sched.init(0);
+  auto guard = sched.get_current_guard();
+
+  NetQueryStats net_query_stats;
+
+  auto query = create_query(1);
+  query->dispatch_timestamp_ = query->start_timestamp_ + 0.001;
+  query->send_timestamp_ = query->start_timestamp_ + 0.002;
+  query->ack_timestamp_ = query->send_timestamp_ + 0.01;
+  query->result_timestamp_ = query->send_timestamp_ + 0.02;
+  query->send_count_ = 3;
+  query->delay_count_ = 2;
+  query->delay_time_ = 5;
+  query->flood_wait_count_ = 1;
+  query->flood_wait_time_ = 4;
+  query->set_ok(BufferSlice("result"));
+  net_query_stats.on_query_finished(*query, DcId::internal(2));
+  ASSERT_EQ(0, query->send_count_);
+  ASSERT_EQ(0, query->delay_count_);
+  ASSERT_EQ(0, query->flood_wait_count_);
+  ASSERT_TRUE(query->send_timestamp_ == 0);
+  ASSERT_TRUE(query->result_timestamp_ == 0);
+
+  // the same query is resent by its callback and fails without being sent
+  query->resend();
+  query->set_error(Status::Error(400, "BAD_REQUEST"));
+  net_query_stats.on_query_finished(*query, DcId::internal(2));
+
+  auto other_query = create_query(2);
+  other_query->set_error(Status::Error(500, "INTERNAL"));
+  net_query_stats.on_query_finished(*other_query, DcId::internal(4));
+
+  net_query_stats.on_container_sent(3);
+  net_query_stats.on_container_sent(5);
+
+  auto stats = net_query_stats.get_stats();
+  ASSERT_EQ(2u, stats.size());
+  const NetQueryStats::Stats *query_stats = nullptr;
+  for (auto &stat : stats) {
+    if (stat.tl_constructor == 1) {
+      query_stats = &stat;
+    }
+  }
+  ASSERT_TRUE(query_stats != nullptr);
+  ASSERT_EQ(2, query_stats->dc_id);
+  ASSERT_EQ(2, query_stats->query_count);
+  ASSERT_EQ(1, query_stats->error_count);
+  ASSERT_EQ(2, query_stats->resend_count);
+  ASSERT_EQ(2, query_stats->delay_count);
+  ASSERT_EQ(1, query_stats->flood_wait_count);
+  ASSERT_TRUE(query_stats->flood_wait_time == 4);
+  ASSERT_EQ(2u, query_stats->total_latency.get_count());
+  ASSERT_EQ(1u, query_stats->queue_latency.get_count());
+  ASSERT_EQ(1u, query_stats->ack_latency.get_count());
+  ASSERT_EQ(1u, query_stats->result_latency.get_count());
+
+  auto result_latency = query_stats->result_latency.get_percentile(50);
+  ASSERT_TRUE(19000 <= result_latency && result_latency <= 23000);
+  auto ack_latency = query_stats->ack_latency.get_percentile(99);
+  ASSERT_TRUE(9000 <= ack_latency && ack_latency <= 11500);
+
+  string description = PSTRING() << *query_stats;
+  ASSERT_TRUE(description.find("[queries:2]") != string::npos);
+  ASSERT_TRUE(description.find("[result:p50=") != string::npos);
+
+  auto container_sizes = net_query_stats.get_container_size_stats();
+  ASSERT_EQ(2u, container_sizes.get_count());
+  ASSERT_EQ(5u, container_sizes.get_max());
+
+  net_query_stats.clear_stats();
+  ASSERT_TRUE(net_query_stats.get_stats().empty());
+  ASSERT_EQ(0u, net_query_stats.get_container_size_stats().get_count());
+}
@@ -1027,6 +1027,56 @@ void FakeSecretChatContext::on_read_message(int64, Promise<> promise) {
   promise.set_error(Status::Error("unsupported"));
 }
 
+TEST(Secret, dh_key_pool) {
+  FakeDhCallback dh_callback;
+  auto prime = base64url_decode(prime_base64).move_as_ok();
+  auto &pool = DhKeyPool::instance();
+  pool.prepare(g, "bad prime");
+  pool.prepare(g, prime);
+
+  BigNumContext context;
+  int precomputed_count = 0;
+  while (pool.precompute_key_pair(&dh_callback, context)) {
+    precomputed_count++;
+  }
+  ASSERT_TRUE(precomputed_count > 1);
+  ASSERT_EQ(1, dh_callback.is_good_prime(prime));
+
+  // use all pre-computed key pairs and then generate new ones in place
+  for (int i = 0; i < precomputed_count; i++) {
+    DhHandshake a;
+    DhHandshake b;
+    a.set_config(g, prime);
+    b.set_config(g, prime);
+    b.set_g_a(a.get_g_b());
+    a.set_g_a(b.get_g_b());
+    a.run_checks(&dh_callback).ensure();
+    b.run_checks(&dh_callback).ensure();
+    auto a_key = a.gen_key();
+    auto b_key = b.gen_key();
+    ASSERT_EQ(a_key.first, b_key.first);
+    ASSERT_STREQ(a_key.second, b_key.second);
+  }
+
+  ASSERT_TRUE(pool.take_refill_request());
+  ASSERT_TRUE(!pool.take_refill_request());
+  ASSERT_TRUE(pool.precompute_key_pair(&dh_callback, context));
+  auto dh_prime = pool.get_prime(g, prime);
+  BigNum key_b;
+  BigNum key_g_b;
+  ASSERT_TRUE(pool.pop_key_pair(*dh_prime, key_b, key_g_b));
+
+  // the least recently used prime is evicted by new ones
+  for (auto fake_prime : {"prime 1", "prime 3", "prime 5", "prime 7"}) {
+    pool.prepare(g, Slice(fake_prime));
+  }
+  ASSERT_TRUE(pool.take_refill_request());
+  ASSERT_TRUE(!pool.pop_key_pair(*dh_prime, key_b, key_g_b));
+  while (pool.precompute_key_pair(&dh_callback, context)) {
+    // empty
+  }
+}
+
 TEST(Secret, go) {
   SET_VERBOSITY_LEVEL(VERBOSITY_NAME(ERROR));
   ConcurrentScheduler sched;
@@ -0,0 +1,50 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/net/TrafficRecorder.h"
+
+#include "td/utils/port/path.h"
+#include "td/utils/Slice.h"
+#include "td/utils/tests.h"
+
+REGISTER_TESTS(traffic_recorder);
+
+using namespace td;
+
+TEST(TrafficRecorder, round_trip) {
+  string path = "traffic_recorder.dump";
+  unlink(path).ignore();
+
+  string big_data(100000, 'a');
+  {
+    auto recorder = TrafficRecorder::open(path).move_as_ok();
+    recorder->add_update("abcd");
+    recorder->add_result(123, "a");
+    recorder->add_update(big_data);
+  }
+  {
+    auto recorder = TrafficRecorder::open(path).move_as_ok();
+    recorder->add_result(-456, "");
+    recorder->add_update("abcdefg");
+  }
+
+  auto records = read_traffic_records(path).move_as_ok();
+  unlink(path).ignore();
+
+  ASSERT_EQ(5u, records.size());
+  ASSERT_TRUE(records[0].type == TrafficRecord::Type::Update);
+  ASSERT_EQ("abcd", records[0].data.as_slice());
+  ASSERT_TRUE(records[1].type == TrafficRecord::Type::Result);
+  ASSERT_EQ(123, records[1].query_tl_constructor);
+  ASSERT_EQ("a", records[1].data.as_slice());
+  ASSERT_EQ(big_data, records[2].data.as_slice());
+  ASSERT_EQ(-456, records[3].query_tl_constructor);
+  ASSERT_TRUE(records[3].data.empty());
+  ASSERT_EQ("abcdefg", records[4].data.as_slice());
+  for (auto &record : records) {
+    ASSERT_TRUE(record.date > 0);
+  }
+}
@@ -0,0 +1,72 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2018
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/td_api.h"
+#include "td/telegram/UpdateCoalescer.h"
+
+#include "td/utils/tests.h"
+
+#include <utility>
+
+REGISTER_TESTS(update_coalescer);
+
+using namespace td;
+
+static tl_object_ptr<td_api::Update> get_update_user_status(int32 user_id, int32 was_online) {
+  return make_tl_object<td_api::updateUserStatus>(user_id, make_tl_object<td_api::userStatusOffline>(was_online));
+}
+
+static tl_object_ptr<td_api::Update> get_update_chat_read_inbox(int64 chat_id, int32 unread_count) {
+  return make_tl_object<td_api::updateChatReadInbox>(chat_id, 0, unread_count);
+}
+
+TEST(UpdateCoalescer, merge) {
+  UpdateCoalescer coalescer;
+  coalescer.add_update(get_update_user_status(1, 10));
+  coalescer.add_update(get_update_chat_read_inbox(5, 1));
+  coalescer.add_update(make_tl_object<td_api::updateChatOrder>(5, 123));
+  coalescer.add_update(get_update_user_status(2, 20));
+  coalescer.add_update(get_update_user_status(1, 11));
+  coalescer.add_update(get_update_chat_read_inbox(5, 2));
+  coalescer.add_update(get_update_chat_read_inbox(6, 3));
+  ASSERT_EQ(7, coalescer.get_added_update_count());
+  ASSERT_EQ(2, coalescer.get_merged_update_count());
+
+  auto updates = coalescer.get_updates();
+  ASSERT_TRUE(coalescer.empty());
+  ASSERT_EQ(5u, updates.size());
+
+  // the newest user status is sent in place of the first one
+  ASSERT_EQ(td_api::updateUserStatus::ID, updates[0]->get_id());
+  auto status = static_cast<td_api::updateUserStatus *>(updates[0].get());
+  ASSERT_EQ(1, status->user_id_);
+  ASSERT_EQ(11, static_cast<td_api::userStatusOffline *>(status->status_.get())->was_online_);
+
+  // the newest read inbox is sent after all updates, which were sent before it
+  ASSERT_EQ(td_api::updateChatOrder::ID, updates[1]->get_id());
+  ASSERT_EQ(td_api::updateUserStatus::ID, updates[2]->get_id());
+  ASSERT_EQ(td_api::updateChatReadInbox::ID, updates[3]->get_id());
+  ASSERT_EQ(2, static_cast<td_api::updateChatReadInbox *>(updates[3].get())->unread_count_);
+  ASSERT_EQ(6, static_cast<td_api::updateChatReadInbox *>(updates[4].get())->chat_id_);
+}
+
+TEST(UpdateCoalescer, keep_order) {
+  UpdateCoalescer coalescer;
+  ASSERT_TRUE(!UpdateCoalescer::is_mergeable(make_tl_object<td_api::updateDeleteMessages>().get()));
+  auto user = make_tl_object<td_api::user>();
+  user->id_ = 1;
+  coalescer.add_update(get_update_user_status(1, 10));
+  coalescer.add_update(make_tl_object<td_api::updateUser>(std::move(user)));
+  coalescer.add_update(make_tl_object<td_api::updateDeleteMessages>());
+  coalescer.add_update(get_update_user_status(1, 11));
+  coalescer.add_update(make_tl_object<td_api::updateDeleteMessages>());
+
+  // user status can't be moved before updateUser about the same user
+  auto updates = coalescer.get_updates();
+  ASSERT_EQ(5u, updates.size());
+  ASSERT_EQ(0, coalescer.get_merged_update_count());
+  ASSERT_EQ(td_api::updateUserStatus::ID, updates[3]->get_id());
+}